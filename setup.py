@@ -60,6 +60,8 @@ sources = [
     os.path.join(src_main_c_dir, 'jpy_jobj.c'),
     os.path.join(src_main_c_dir, 'jpy_jmethod.c'),
     os.path.join(src_main_c_dir, 'jpy_jfield.c'),
+    os.path.join(src_main_c_dir, 'jpy_jfuture.c'),
+    os.path.join(src_main_c_dir, 'jpy_jcoll.c'),
     os.path.join(src_main_c_dir, 'jni/org_jpy_PyLib.c'),
 ]
 
@@ -73,6 +75,8 @@ headers = [
     os.path.join(src_main_c_dir, 'jpy_jobj.h'),
     os.path.join(src_main_c_dir, 'jpy_jmethod.h'),
     os.path.join(src_main_c_dir, 'jpy_jfield.h'),
+    os.path.join(src_main_c_dir, 'jpy_jfuture.h'),
+    os.path.join(src_main_c_dir, 'jpy_jcoll.h'),
     os.path.join(src_main_c_dir, 'jni/org_jpy_PyLib.h'),
 ]
 
@@ -98,6 +102,10 @@ python_java_jpy_tests = [
     os.path.join(src_test_py_dir, 'jpy_gettype_test.py'),
 ]
 
+# asyncio integration requires Python 3.5+
+if sys.version_info >= (3, 5):
+    python_java_jpy_tests.append(os.path.join(src_test_py_dir, 'jpy_async_test.py'))
+
 # e.g. jdk_home_dir = '/home/marta/jdk1.7.0_15'
 jdk_home_dir = jpyutil.find_jdk_home_dir()
 if jdk_home_dir is None:
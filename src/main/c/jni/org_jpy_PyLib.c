@@ -22,6 +22,7 @@
 #include "jpy_jtype.h"
 #include "jpy_jobj.h"
 #include "jpy_conv.h"
+#include "jpy_jcoll.h"
 
 #include "org_jpy_PyLib.h"
 #include "org_jpy_PyLib_Diag.h"
@@ -31,6 +32,7 @@
 
 PyObject* PyLib_GetAttributeObject(JNIEnv* jenv, PyObject* pyValue, jstring jName);
 PyObject* PyLib_CallAndReturnObject(JNIEnv *jenv, PyObject* pyValue, jboolean isMethodCall, jstring jName, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses);
+PyObject* PyLib_CallCallable(JNIEnv *jenv, PyObject* pyCallable, const char* nameChars, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses);
 void PyLib_HandlePythonException(JNIEnv* jenv);
 void PyLib_RedirectStdOut(void);
 
@@ -46,9 +48,42 @@ static int JPy_InitThreads = 0;
 
 #define JPy_GIL_AWARE
 
+// The thread state of the sub-interpreter the current thread is pinned to, see Java_org_jpy_PyLib_runInSubInterpreter().
+// The PyGILState API always uses the main interpreter, so pinned threads acquire the GIL of their own interpreter instead.
+static JPY_THREAD_LOCAL PyThreadState* JPy_PinnedThreadState = NULL;
+
+#define JPy_GIL_MODE_ENSURED  0
+#define JPy_GIL_MODE_PINNED   1
+#define JPy_GIL_MODE_HELD     2
+
+static int PyLib_AcquireGIL(PyGILState_STATE* gilState)
+{
+    PyThreadState* pinnedState = JPy_PinnedThreadState;
+    if (pinnedState == NULL) {
+        *gilState = PyGILState_Ensure();
+        return JPy_GIL_MODE_ENSURED;
+    }
+#if defined(JPY_COMPAT_MODULE_STATE)
+    if (JPy_GET_THREAD_STATE_UNCHECKED() == pinnedState) {
+        return JPy_GIL_MODE_HELD;
+    }
+#endif
+    PyEval_RestoreThread(pinnedState);
+    return JPy_GIL_MODE_PINNED;
+}
+
+static void PyLib_ReleaseGIL(int gilMode, PyGILState_STATE gilState)
+{
+    if (gilMode == JPy_GIL_MODE_ENSURED) {
+        PyGILState_Release(gilState);
+    } else if (gilMode == JPy_GIL_MODE_PINNED) {
+        PyEval_SaveThread();
+    }
+}
+
 #ifdef JPy_GIL_AWARE
-    #define JPy_BEGIN_GIL_STATE  { PyGILState_STATE gilState; if (!JPy_InitThreads) {JPy_InitThreads = 1; PyEval_InitThreads(); PyEval_SaveThread(); } gilState = PyGILState_Ensure();
-    #define JPy_END_GIL_STATE    PyGILState_Release(gilState); }
+    #define JPy_BEGIN_GIL_STATE  { PyGILState_STATE gilState = PyGILState_UNLOCKED; int gilMode; if (!JPy_InitThreads) {JPy_InitThreads = 1; PyEval_InitThreads(); PyEval_SaveThread(); } gilMode = PyLib_AcquireGIL(&gilState);
+    #define JPy_END_GIL_STATE    PyLib_ReleaseGIL(gilMode, gilState); }
 #else
     #define JPy_BEGIN_GIL_STATE
     #define JPy_END_GIL_STATE
@@ -423,7 +458,7 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_incRef
     if (Py_IsInitialized()) {
         JPy_BEGIN_GIL_STATE
 
-        refCount = pyObject->ob_refcnt;
+        refCount = Py_REFCNT(pyObject);
         JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "Java_org_jpy_PyLib_incRef: pyObject=%p, refCount=%d, type='%s'\n", pyObject, refCount, Py_TYPE(pyObject)->tp_name);
         Py_INCREF(pyObject);
 
@@ -436,10 +471,10 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_incRef
 /*
  * Class:     org_jpy_python_PyLib
  * Method:    decRef
- * Signature: (J)V
+ * Signature: (JI)V
  */
 JNIEXPORT void JNICALL Java_org_jpy_PyLib_decRef
-  (JNIEnv* jenv, jclass jLibClass, jlong objId)
+  (JNIEnv* jenv, jclass jLibClass, jlong objId, jint count)
 {
     PyObject* pyObject;
     Py_ssize_t refCount;
@@ -449,12 +484,15 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_decRef
     if (Py_IsInitialized()) {
         JPy_BEGIN_GIL_STATE
 
-        refCount = pyObject->ob_refcnt;
-        if (refCount <= 0) {
-            JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_decRef: error: refCount <= 0: pyObject=%p, refCount=%d\n", pyObject, refCount);
+        refCount = Py_REFCNT(pyObject);
+        if (refCount < count) {
+            JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_decRef: error: refCount < count: pyObject=%p, refCount=%d, count=%d\n", pyObject, refCount, count);
         } else {
-            JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "Java_org_jpy_PyLib_decRef: pyObject=%p, refCount=%d, type='%s'\n", pyObject, refCount, Py_TYPE(pyObject)->tp_name);
-            Py_DECREF(pyObject);
+            JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "Java_org_jpy_PyLib_decRef: pyObject=%p, refCount=%d, count=%d, type='%s'\n", pyObject, refCount, count, Py_TYPE(pyObject)->tp_name);
+            // A PyObject instance owns 'count' references, see org.jpy.PyObject.wrap()
+            for (; count > 0; count--) {
+                Py_DECREF(pyObject);
+            }
         }
 
         JPy_END_GIL_STATE
@@ -623,6 +661,72 @@ error:
     return jObject;
 }
 
+/**
+ * Returns the jpy type of the given class, java.lang.Object if classRef is NULL.
+ */
+static JPy_JType* PyLib_GetCollectionType(JNIEnv* jenv, jclass classRef)
+{
+    return classRef != NULL ? JType_GetType(jenv, classRef, JNI_FALSE) : JPy_JObject;
+}
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    getListValue
+ * Signature: (JLjava/lang/Class;)Ljava/util/List;
+ */
+JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_getListValue
+  (JNIEnv* jenv, jclass jLibClass, jlong objId, jclass itemClassRef)
+{
+    PyObject* pyObject;
+    JPy_JType* itemType;
+    jobject jList;
+
+    JPy_BEGIN_GIL_STATE
+
+    pyObject = (PyObject*) objId;
+
+    itemType = PyLib_GetCollectionType(jenv, itemClassRef);
+    if (itemType == NULL || JColl_ToJavaList(jenv, pyObject, itemType, &jList) < 0) {
+        jList = NULL;
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_getListValue: error: failed to convert Python object to Java List\n");
+        PyLib_HandlePythonException(jenv);
+    }
+
+    JPy_END_GIL_STATE
+
+    return jList;
+}
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    getMapValue
+ * Signature: (JLjava/lang/Class;Ljava/lang/Class;)Ljava/util/Map;
+ */
+JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_getMapValue
+  (JNIEnv* jenv, jclass jLibClass, jlong objId, jclass keyClassRef, jclass valueClassRef)
+{
+    PyObject* pyObject;
+    JPy_JType* keyType;
+    JPy_JType* valueType;
+    jobject jMap;
+
+    JPy_BEGIN_GIL_STATE
+
+    pyObject = (PyObject*) objId;
+
+    keyType = PyLib_GetCollectionType(jenv, keyClassRef);
+    valueType = keyType != NULL ? PyLib_GetCollectionType(jenv, valueClassRef) : NULL;
+    if (valueType == NULL || JColl_ToJavaMap(jenv, pyObject, keyType, valueType, &jMap) < 0) {
+        jMap = NULL;
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_getMapValue: error: failed to convert Python object to Java Map\n");
+        PyLib_HandlePythonException(jenv);
+    }
+
+    JPy_END_GIL_STATE
+
+    return jMap;
+}
+
 
 /*
  * Class:     org_jpy_python_PyLib
@@ -706,6 +810,7 @@ JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_getAttributeValue
         JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_getAttributeValue: error: failed to convert attribute value\n");
         PyLib_HandlePythonException(jenv);
     }
+    Py_DECREF(pyValue);
 
 error:
     JPy_END_GIL_STATE
@@ -723,6 +828,7 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_setAttributeValue
   (JNIEnv* jenv, jclass jLibClass, jlong objId, jstring jName, jobject jValue, jclass jValueClass)
 {
     PyObject* pyObject;
+    PyObject* pyName;
     const char* nameChars;
     PyObject* pyValue;
     JPy_JType* valueType;
@@ -730,8 +836,15 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_setAttributeValue
     JPy_BEGIN_GIL_STATE
 
     pyObject = (PyObject*) objId;
+    pyValue = NULL;
 
-    nameChars = (*jenv)->GetStringUTFChars(jenv, jName, NULL);
+    // Note: pyName is a new reference to an interned string
+    pyName = JPy_FromJStringInterned(jenv, jName);
+    if (pyName == NULL) {
+        PyLib_HandlePythonException(jenv);
+        goto error;
+    }
+    nameChars = JPy_AS_UTF8(pyName);
     JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "Java_org_jpy_PyLib_setAttributeValue: objId=%p, name='%s', jValue=%p, jValueClass=%p\n", pyObject, nameChars, jValue, jValueClass);
 
     if (jValueClass != NULL) {
@@ -752,14 +865,15 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_setAttributeValue
         goto error;
     }
 
-    if (PyObject_SetAttrString(pyObject, nameChars, pyValue) < 0) {
-        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_setAttributeValue: error: PyObject_SetAttrString failed on attribute '%s'\n", nameChars);
+    if (PyObject_SetAttr(pyObject, pyName, pyValue) < 0) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_setAttributeValue: error: PyObject_SetAttr failed on attribute '%s'\n", nameChars);
         PyLib_HandlePythonException(jenv);
         goto error;
     }
 
 error:
-    (*jenv)->ReleaseStringUTFChars(jenv, jName, nameChars);
+    Py_XDECREF(pyName);
+    Py_XDECREF(pyValue);
 
     JPy_END_GIL_STATE
 }
@@ -812,11 +926,53 @@ JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_callAndReturnValue
     if (JPy_AsJObjectWithClass(jenv, pyReturnValue, &jReturnValue, jReturnClass) < 0) {
         JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_callAndReturnValue: error: failed to convert attribute value\n");
         PyLib_HandlePythonException(jenv);
-        Py_DECREF(pyReturnValue);
         jReturnValue = NULL;
+    }
+    Py_DECREF(pyReturnValue);
+
+error:
+    JPy_END_GIL_STATE
+
+    return jReturnValue;
+}
+
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    callCallableAndReturnValue
+ * Signature: (JI[Ljava/lang/Object;[Ljava/lang/Class;Ljava/lang/Class;)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_callCallableAndReturnValue
+  (JNIEnv *jenv, jclass jLibClass, jlong callableId, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses, jclass jReturnClass)
+{
+    PyObject* pyCallable;
+    PyObject* pyReturnValue;
+    jobject jReturnValue;
+
+    if (!Py_IsInitialized()) {
+        (*jenv)->ThrowNew(jenv, JPy_RuntimeException_JClass, "PyLib not initialized");
+        return NULL;
+    }
+
+    JPy_BEGIN_GIL_STATE
+
+    pyCallable = (PyObject*) callableId;
+    jReturnValue = NULL;
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_METH, "Java_org_jpy_PyLib_callCallableAndReturnValue: callable=%p, type='%s', argCount=%d\n", pyCallable, Py_TYPE(pyCallable)->tp_name, argCount);
+
+    pyReturnValue = PyLib_CallCallable(jenv, pyCallable, Py_TYPE(pyCallable)->tp_name, argCount, jArgs, jParamClasses);
+    if (pyReturnValue == NULL) {
         goto error;
     }
 
+    if (JPy_AsJObjectWithClass(jenv, pyReturnValue, &jReturnValue, jReturnClass) < 0) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_callCallableAndReturnValue: error: failed to convert return value\n");
+        PyLib_HandlePythonException(jenv);
+        jReturnValue = NULL;
+    }
+    Py_DECREF(pyReturnValue);
+
 error:
     JPy_END_GIL_STATE
 
@@ -824,6 +980,234 @@ error:
 }
 
 
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    runWithGil
+ * Signature: (Ljava/lang/Runnable;)V
+ */
+JNIEXPORT void JNICALL Java_org_jpy_PyLib_runWithGil
+  (JNIEnv* jenv, jclass jLibClass, jobject jRunnable)
+{
+    jclass runnableClass;
+    jmethodID runMID;
+
+    JPy_BEGIN_GIL_STATE
+
+    // While the runnable runs, the calling thread holds the GIL, so that all PyLib calls made
+    // by the runnable only need to increment the thread's GIL state counter.
+    runnableClass = (*jenv)->GetObjectClass(jenv, jRunnable);
+    runMID = (*jenv)->GetMethodID(jenv, runnableClass, "run", "()V");
+    if (runMID != NULL) {
+        (*jenv)->CallVoidMethod(jenv, jRunnable, runMID);
+    }
+    (*jenv)->DeleteLocalRef(jenv, runnableClass);
+
+    JPy_END_GIL_STATE
+}
+
+
+/**
+ * Copies the entries of the current interpreter's 'sys.path' into a NULL-terminated array of UTF-8 strings,
+ * so that they can be passed to another interpreter. Returns NULL and sets a Python exception on failure.
+ */
+char** PyLib_CopySysPath(void)
+{
+    PyObject* pyPathList;
+    Py_ssize_t pathCount, i;
+    char** paths;
+
+    pyPathList = PySys_GetObject("path");
+    pathCount = pyPathList != NULL && PyList_Check(pyPathList) ? PyList_Size(pyPathList) : 0;
+
+    paths = (char**) calloc(pathCount + 1, sizeof (char*));
+    if (paths == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    for (i = 0; i < pathCount; i++) {
+        PyObject* pyPath = PyList_GetItem(pyPathList, i);
+        const char* pathChars = JPy_IS_STR(pyPath) ? JPy_AS_UTF8(pyPath) : NULL;
+        if (pathChars != NULL) {
+            paths[i] = strdup(pathChars);
+        }
+    }
+    PyErr_Clear();
+
+    return paths;
+}
+
+/**
+ * Sets the current interpreter's 'sys.path' to the given paths, see PyLib_CopySysPath().
+ */
+int PyLib_SetSysPath(char** paths)
+{
+    PyObject* pyPathList;
+    PyObject* pyPath;
+    int result;
+
+    pyPathList = PyList_New(0);
+    if (pyPathList == NULL) {
+        return -1;
+    }
+    for (; *paths != NULL; paths++) {
+        pyPath = JPy_FROM_CSTR(*paths);
+        if (pyPath == NULL || PyList_Append(pyPathList, pyPath) < 0) {
+            Py_XDECREF(pyPath);
+            Py_DECREF(pyPathList);
+            return -1;
+        }
+        Py_DECREF(pyPath);
+    }
+    result = PySys_SetObject("path", pyPathList);
+    Py_DECREF(pyPathList);
+    return result;
+}
+
+void PyLib_FreeSysPath(char** paths)
+{
+    char** path;
+    for (path = paths; *path != NULL; path++) {
+        free(*path);
+    }
+    free(paths);
+}
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    runInSubInterpreter
+ * Signature: (Ljava/lang/Runnable;Z)V
+ */
+JNIEXPORT void JNICALL Java_org_jpy_PyLib_runInSubInterpreter
+  (JNIEnv* jenv, jclass jLibClass, jobject jRunnable, jboolean ownGil)
+{
+#if defined(JPY_COMPAT_MODULE_STATE)
+    PyGILState_STATE gilState;
+    PyThreadState* mainThreadState;
+    PyThreadState* subThreadState;
+    PyObject* pyModule;
+    char** paths;
+    jclass runnableClass;
+    jmethodID runMID;
+
+    if (JPy_PinnedThreadState != NULL) {
+        (*jenv)->ThrowNew(jenv, JPy_RuntimeException_JClass, "Current thread already runs a Python sub-interpreter.");
+        return;
+    }
+
+    #if !defined(JPY_COMPAT_OWN_GIL)
+    if (ownGil) {
+        (*jenv)->ThrowNew(jenv, JPy_RuntimeException_JClass, "Python sub-interpreters with their own GIL require Python 3.12+.");
+        return;
+    }
+    #endif
+
+    runnableClass = (*jenv)->GetObjectClass(jenv, jRunnable);
+    runMID = (*jenv)->GetMethodID(jenv, runnableClass, "run", "()V");
+    if (runMID == NULL) {
+        (*jenv)->DeleteLocalRef(jenv, runnableClass);
+        return;
+    }
+
+    if (!JPy_InitThreads) {
+        JPy_InitThreads = 1;
+        PyEval_InitThreads();
+        PyEval_SaveThread();
+    }
+    gilState = PyGILState_Ensure();
+    mainThreadState = PyThreadState_Get();
+
+    // The new interpreter shall find the same modules (including 'jpy') as the main interpreter
+    paths = PyLib_CopySysPath();
+    if (paths == NULL) {
+        PyLib_HandlePythonException(jenv);
+        PyGILState_Release(gilState);
+        (*jenv)->DeleteLocalRef(jenv, runnableClass);
+        return;
+    }
+
+    #if defined(JPY_COMPAT_OWN_GIL)
+    {
+        PyInterpreterConfig config;
+        PyStatus status;
+
+        memset(&config, 0, sizeof (config));
+        config.allow_threads = 1;
+        if (ownGil) {
+            // Objects must not be shared with an interpreter which has its own GIL,
+            // so it needs its own object allocator and extension modules supporting this.
+            config.use_main_obmalloc = 0;
+            config.check_multi_interp_extensions = 1;
+            config.gil = PyInterpreterConfig_OWN_GIL;
+        } else {
+            config.use_main_obmalloc = 1;
+            config.allow_daemon_threads = 1;
+            config.gil = PyInterpreterConfig_SHARED_GIL;
+        }
+        subThreadState = NULL;
+        status = Py_NewInterpreterFromConfig(&subThreadState, &config);
+        if (PyStatus_Exception(status)) {
+            subThreadState = NULL;
+        }
+    }
+    #else
+    subThreadState = Py_NewInterpreter();
+    #endif
+
+    if (subThreadState == NULL) {
+        PyLib_FreeSysPath(paths);
+        PyGILState_Release(gilState);
+        (*jenv)->DeleteLocalRef(jenv, runnableClass);
+        (*jenv)->ThrowNew(jenv, JPy_RuntimeException_JClass, "Failed to create Python sub-interpreter.");
+        return;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_runInSubInterpreter: created sub-interpreter: subThreadState=%p, ownGil=%d\n", subThreadState, ownGil);
+
+    // The current thread now holds the GIL of the new interpreter, the GIL of the main interpreter has been released
+    // if the new one has its own. Import 'jpy', so that the interpreter gets its own jpy module state.
+    pyModule = NULL;
+    if (PyLib_SetSysPath(paths) == 0) {
+        pyModule = PyImport_ImportModule("jpy");
+    }
+    PyLib_FreeSysPath(paths);
+
+    if (pyModule != NULL) {
+        Py_DECREF(pyModule);
+
+        // Pin the current thread to the new interpreter while the runnable runs, see PyLib_AcquireGIL()
+        JPy_PinnedThreadState = subThreadState;
+        PyEval_SaveThread();
+        (*jenv)->CallVoidMethod(jenv, jRunnable, runMID);
+        PyEval_RestoreThread(subThreadState);
+        JPy_PinnedThreadState = NULL;
+    } else {
+        PyLib_HandlePythonException(jenv);
+    }
+
+    Py_EndInterpreter(subThreadState);
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "Java_org_jpy_PyLib_runInSubInterpreter: ended sub-interpreter: subThreadState=%p\n", subThreadState);
+
+    // Switch back to the main interpreter
+    #if defined(JPY_COMPAT_OWN_GIL)
+    if (ownGil) {
+        PyEval_RestoreThread(mainThreadState);
+    } else {
+        PyThreadState_Swap(mainThreadState);
+    }
+    #else
+    PyThreadState_Swap(mainThreadState);
+    #endif
+    PyGILState_Release(gilState);
+
+    (*jenv)->DeleteLocalRef(jenv, runnableClass);
+#else
+    (*jenv)->ThrowNew(jenv, JPy_RuntimeException_JClass, "Python sub-interpreters require Python 3.9+.");
+#endif
+}
+
+
 /*
  * Class:     org_jpy_python_PyLib
  * Method:    getDiagFlags
@@ -853,55 +1237,83 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_00024Diag_setFlags
 PyObject* PyLib_GetAttributeObject(JNIEnv* jenv, PyObject* pyObject, jstring jName)
 {
     PyObject* pyValue;
-    const char* nameChars;
+    PyObject* pyName;
 
-    nameChars = (*jenv)->GetStringUTFChars(jenv, jName, NULL);
-    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "PyLib_GetAttributeObject: objId=%p, name='%s'\n", pyObject, nameChars);
+    /* Note: pyName is a new reference to an interned string */
+    pyName = JPy_FromJStringInterned(jenv, jName);
+    if (pyName == NULL) {
+        PyLib_HandlePythonException(jenv);
+        return NULL;
+    }
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "PyLib_GetAttributeObject: objId=%p, name='%s'\n", pyObject, JPy_AS_UTF8(pyName));
     /* Note: pyValue is a new reference */
-    pyValue = PyObject_GetAttrString(pyObject, nameChars);
+    pyValue = PyObject_GetAttr(pyObject, pyName);
     if (pyValue == NULL) {
-        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_GetAttributeObject: error: attribute not found '%s'\n", nameChars);
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_GetAttributeObject: error: attribute not found '%s'\n", JPy_AS_UTF8(pyName));
         PyLib_HandlePythonException(jenv);
     }
-    (*jenv)->ReleaseStringUTFChars(jenv, jName, nameChars);
+    Py_DECREF(pyName);
     return pyValue;
 }
 
 PyObject* PyLib_CallAndReturnObject(JNIEnv *jenv, PyObject* pyObject, jboolean isMethodCall, jstring jName, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses)
 {
     PyObject* pyCallable;
-    PyObject* pyArgs;
-    PyObject* pyArg;
     PyObject* pyReturnValue;
+    PyObject* pyName;
     const char* nameChars;
-    jint i;
-    jobject jArg;
-    jclass jParamClass;
-    JPy_JType* paramType;
-
-    pyReturnValue = NULL;
 
-    nameChars = (*jenv)->GetStringUTFChars(jenv, jName, NULL);
+    // Note: pyName is a new reference to an interned string
+    pyName = JPy_FromJStringInterned(jenv, jName);
+    if (pyName == NULL) {
+        PyLib_HandlePythonException(jenv);
+        return NULL;
+    }
+    nameChars = JPy_AS_UTF8(pyName);
 
     JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "PyLib_CallAndReturnObject: objId=%p, isMethodCall=%d, name='%s', argCount=%d\n", pyObject, isMethodCall, nameChars, argCount);
 
-    pyArgs = NULL;
-
     // Note: pyCallable is a new reference
-    pyCallable = PyObject_GetAttrString(pyObject, nameChars);
+    pyCallable = PyObject_GetAttr(pyObject, pyName);
     if (pyCallable == NULL) {
         JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallAndReturnObject: error: function or method not found: '%s'\n", nameChars);
         PyLib_HandlePythonException(jenv);
-        goto error;
+        Py_DECREF(pyName);
+        return NULL;
     }
 
+    pyReturnValue = PyLib_CallCallable(jenv, pyCallable, nameChars, argCount, jArgs, jParamClasses);
+
+    Py_DECREF(pyCallable);
+    Py_DECREF(pyName);
+
+    return pyReturnValue;
+}
+
+PyObject* PyLib_CallCallable(JNIEnv *jenv, PyObject* pyCallable, const char* nameChars, jint argCount, jobjectArray jArgs, jobjectArray jParamClasses)
+{
+    PyObject* pyArgs;
+    PyObject* pyArg;
+    PyObject* pyReturnValue;
+    jint i;
+    jobject jArg;
+    jclass jParamClass;
+    JPy_JType* paramType;
+
+    pyReturnValue = NULL;
+
     if (!PyCallable_Check(pyCallable)) {
-        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallAndReturnObject: error: object is not callable: '%s'\n", nameChars);
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallCallable: error: object is not callable: '%s'\n", nameChars);
+        PyErr_Format(PyExc_TypeError, "'%s' object is not callable", Py_TYPE(pyCallable)->tp_name);
         PyLib_HandlePythonException(jenv);
-        goto error;
+        return NULL;
     }
 
     pyArgs = PyTuple_New(argCount);
+    if (pyArgs == NULL) {
+        PyLib_HandlePythonException(jenv);
+        return NULL;
+    }
     for (i = 0; i < argCount; i++) {
         jArg = (*jenv)->GetObjectArrayElement(jenv, jArgs, i);
 
@@ -911,15 +1323,22 @@ PyObject* PyLib_CallAndReturnObject(JNIEnv *jenv, PyObject* pyObject, jboolean i
             jParamClass = NULL;
         }
 
-        if (jParamClass != NULL) {
+        if (jArg == NULL) {
+            // null converts into None, JPy_FromJObject() can't determine its type
+            if (jParamClass != NULL) {
+                (*jenv)->DeleteLocalRef(jenv, jParamClass);
+            }
+            pyArg = JPy_FROM_JNULL();
+        } else if (jParamClass != NULL) {
             paramType = JType_GetType(jenv, jParamClass, JNI_FALSE);
+            (*jenv)->DeleteLocalRef(jenv, jParamClass);
             if (paramType == NULL) {
-                JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallAndReturnObject: error: callable '%s': argument %d: failed to retrieve type\n", nameChars, i);
+                JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallCallable: error: callable '%s': argument %d: failed to retrieve type\n", nameChars, i);
+                (*jenv)->DeleteLocalRef(jenv, jArg);
                 PyLib_HandlePythonException(jenv);
                 goto error;
             }
             pyArg = JPy_FromJObjectWithType(jenv, jArg, paramType);
-            (*jenv)->DeleteLocalRef(jenv, jParamClass);
         } else {
             pyArg = JPy_FromJObject(jenv, jArg);
         }
@@ -927,44 +1346,24 @@ PyObject* PyLib_CallAndReturnObject(JNIEnv *jenv, PyObject* pyObject, jboolean i
         (*jenv)->DeleteLocalRef(jenv, jArg);
 
         if (pyArg == NULL) {
-            JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallAndReturnObject: error: callable '%s': argument %d: failed to convert Java into Python object\n", nameChars, i);
+            JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallCallable: error: callable '%s': argument %d: failed to convert Java into Python object\n", nameChars, i);
             PyLib_HandlePythonException(jenv);
             goto error;
         }
 
         // pyArg reference stolen here
-        PyTuple_SetItem(pyArgs, i, pyArg);
-    }
-
-    // Check why: for some reason, we don't need the following code to invoke object methods.
-    /*
-    if (isMethodCall) {
-        PyObject* pyMethod;
-
-        pyMethod = PyMethod_New(pyCallable, pyObject);
-        if (pyMethod == NULL) {
-            JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "PyLib_CallAndReturnObject: error: callable '%s': no memory\n", nameChars);
-            PyLib_HandlePythonException(jenv);
-            goto error;
-        }
-        Py_DECREF(pyCallable);
-        pyCallable = pyMethod;
+        PyTuple_SET_ITEM(pyArgs, i, pyArg);
     }
-    */
 
     pyReturnValue = PyObject_CallObject(pyCallable, argCount > 0 ? pyArgs : NULL);
     if (pyReturnValue == NULL) {
-        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallAndReturnObject: error: callable '%s': call returned NULL\n", nameChars);
+        JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "PyLib_CallCallable: error: callable '%s': call returned NULL\n", nameChars);
         PyLib_HandlePythonException(jenv);
         goto error;
     }
 
-    Py_INCREF(pyReturnValue);
-
 error:
-    (*jenv)->ReleaseStringUTFChars(jenv, jName, nameChars);
-    Py_XDECREF(pyCallable);
-    Py_XDECREF(pyArgs);
+    Py_DECREF(pyArgs);
 
     return pyReturnValue;
 }
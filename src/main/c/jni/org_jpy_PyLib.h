@@ -66,10 +66,10 @@ JNIEXPORT void JNICALL Java_org_jpy_PyLib_incRef
 /*
  * Class:     org_jpy_PyLib
  * Method:    decRef
- * Signature: (J)V
+ * Signature: (JI)V
  */
 JNIEXPORT void JNICALL Java_org_jpy_PyLib_decRef
-  (JNIEnv *, jclass, jlong);
+  (JNIEnv *, jclass, jlong, jint);
 
 /*
  * Class:     org_jpy_PyLib
@@ -111,6 +111,22 @@ JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_getObjectValue
 JNIEXPORT jobjectArray JNICALL Java_org_jpy_PyLib_getObjectArrayValue
   (JNIEnv *, jclass, jlong, jclass);
 
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    getListValue
+ * Signature: (JLjava/lang/Class;)Ljava/util/List;
+ */
+JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_getListValue
+  (JNIEnv *, jclass, jlong, jclass);
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    getMapValue
+ * Signature: (JLjava/lang/Class;Ljava/lang/Class;)Ljava/util/Map;
+ */
+JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_getMapValue
+  (JNIEnv *, jclass, jlong, jclass, jclass);
+
 /*
  * Class:     org_jpy_PyLib
  * Method:    importModule
@@ -159,6 +175,30 @@ JNIEXPORT jlong JNICALL Java_org_jpy_PyLib_callAndReturnObject
 JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_callAndReturnValue
   (JNIEnv *, jclass, jlong, jboolean, jstring, jint, jobjectArray, jobjectArray, jclass);
 
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    callCallableAndReturnValue
+ * Signature: (JI[Ljava/lang/Object;[Ljava/lang/Class;Ljava/lang/Class;)Ljava/lang/Object;
+ */
+JNIEXPORT jobject JNICALL Java_org_jpy_PyLib_callCallableAndReturnValue
+  (JNIEnv *, jclass, jlong, jint, jobjectArray, jobjectArray, jclass);
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    runWithGil
+ * Signature: (Ljava/lang/Runnable;)V
+ */
+JNIEXPORT void JNICALL Java_org_jpy_PyLib_runWithGil
+  (JNIEnv *, jclass, jobject);
+
+/*
+ * Class:     org_jpy_PyLib
+ * Method:    runInSubInterpreter
+ * Signature: (Ljava/lang/Runnable;Z)V
+ */
+JNIEXPORT void JNICALL Java_org_jpy_PyLib_runInSubInterpreter
+  (JNIEnv *, jclass, jobject, jboolean);
+
 #ifdef __cplusplus
 }
 #endif
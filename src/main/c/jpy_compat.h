@@ -51,6 +51,8 @@ extern "C" {
 #define JPy_AS_WIDE_CHAR_STR(unicode, size)  PyUnicode_AsWideCharString(unicode, size)
 #define JPy_FROM_WIDE_CHAR_STR(wc, size)     PyUnicode_FromKindAndData(PyUnicode_2BYTE_KIND, wc, size)
 
+#define JPy_METHOD_NEW(func, self, type)     PyMethod_New(func, self)
+
 #elif defined(JPY_COMPAT_27)
 
 #define JPy_IS_CLONG(pyArg)      (PyInt_Check(pyArg) || PyLong_Check(pyArg))
@@ -73,6 +75,99 @@ wchar_t* JPy_AsWideCharString_PriorToPy33(PyObject *unicode, Py_ssize_t *size);
 #define JPy_AS_WIDE_CHAR_STR(unicode, size)  JPy_AsWideCharString_PriorToPy33(unicode, size)
 #define JPy_FROM_WIDE_CHAR_STR(wc, size)     PyUnicode_FromWideChar(wc, size)
 
+#define JPy_METHOD_NEW(func, self, type)     PyMethod_New(func, self, type)
+
+#endif
+
+
+// PEP 492 awaitable objects, Python 3.5+
+#if defined(JPY_COMPAT_33P) && PY_VERSION_HEX >= 0x03050000
+#define JPY_COMPAT_ASYNC 1
+#endif
+
+// PEP 590 vectorcall protocol, Python 3.8+
+#if defined(JPY_COMPAT_33P) && PY_VERSION_HEX >= 0x03080000
+#define JPY_COMPAT_VECTORCALL 1
+#ifndef Py_TPFLAGS_HAVE_VECTORCALL
+#define Py_TPFLAGS_HAVE_VECTORCALL _Py_TPFLAGS_HAVE_VECTORCALL
+#endif
+#endif
+
+// Per-interpreter module state (PEP 489 multi-phase init + PyInterpreterState_GetDict()) and heap types
+// created by PyType_FromModuleAndSpec(), Python 3.9+
+#if defined(JPY_COMPAT_33P) && PY_VERSION_HEX >= 0x03090000
+#define JPY_COMPAT_MODULE_STATE 1
+#if PY_VERSION_HEX >= 0x030D0000
+#define JPy_GET_THREAD_STATE_UNCHECKED()  PyThreadState_GetUnchecked()
+#else
+#define JPy_GET_THREAD_STATE_UNCHECKED()  _PyThreadState_UncheckedGet()
+#endif
+#endif
+
+// PEP 684 sub-interpreters with their own GIL, Python 3.12+
+#if defined(JPY_COMPAT_33P) && PY_VERSION_HEX >= 0x030C0000
+#define JPY_COMPAT_OWN_GIL 1
+#endif
+
+// Counters shared between interpreters which have their own GIL
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define JPy_ATOMIC_LOAD_LONG(var)       _InterlockedOr(&(var), 0)
+#define JPy_ATOMIC_INCREMENT_LONG(var)  _InterlockedIncrement(&(var))
+#else
+#define JPy_ATOMIC_LOAD_LONG(var)       __atomic_load_n(&(var), __ATOMIC_SEQ_CST)
+#define JPy_ATOMIC_INCREMENT_LONG(var)  __atomic_add_fetch(&(var), 1, __ATOMIC_SEQ_CST)
+#endif
+
+// PEP 703 free-threaded build (no GIL), Python 3.13+. Flags and counters shared between threads
+// are then accessed atomically, with the GIL they are plain variables.
+#if defined(JPY_COMPAT_33P) && PY_VERSION_HEX >= 0x030D0000 && defined(Py_GIL_DISABLED)
+#define JPY_COMPAT_FREE_THREADING 1
+#define JPy_LOAD_FLAG(flag)            ((char) _Py_atomic_load_uint8((uint8_t*) &(flag)))
+#define JPy_STORE_FLAG(flag, value)    _Py_atomic_store_uint8((uint8_t*) &(flag), (uint8_t) (value))
+#define JPy_ATOMIC_ADD(count, delta)   _Py_atomic_add_int32((int32_t*) &(count), (int32_t) (delta))
+#else
+#define JPy_LOAD_FLAG(flag)            (flag)
+#define JPy_STORE_FLAG(flag, value)    ((flag) = (value))
+#define JPy_ATOMIC_ADD(count, delta)   ((count) += (delta))
+#endif
+
+// Per-object locking of containers iterated while other threads may modify them, a no-op with the GIL
+#if defined(JPY_COMPAT_33P) && PY_VERSION_HEX >= 0x030D0000
+#define JPy_BEGIN_CRITICAL_SECTION(op)  Py_BEGIN_CRITICAL_SECTION(op)
+#define JPy_END_CRITICAL_SECTION()      Py_END_CRITICAL_SECTION()
+#else
+#define JPy_BEGIN_CRITICAL_SECTION(op)  {
+#define JPy_END_CRITICAL_SECTION()      }
+#endif
+
+// Frees an instance of one of jpy's own types. Instances of heap types own a reference to their type.
+#define JPy_FREE_INSTANCE(self) \
+    { \
+        PyTypeObject* freedType = Py_TYPE(self); \
+        freedType->tp_free((PyObject*) (self)); \
+        if ((freedType->tp_flags & Py_TPFLAGS_HEAPTYPE) != 0) { \
+            Py_DECREF(freedType); \
+        } \
+    }
+
+// Py_SET_REFCNT(), Py_SET_TYPE() and Py_SET_SIZE(), Python 3.9+. Since Python 3.10 the results of
+// Py_REFCNT(), Py_TYPE() and Py_SIZE() can no longer be assigned to.
+#if PY_VERSION_HEX < 0x03090000
+#define Py_SET_REFCNT(ob, refcnt)  (Py_REFCNT(ob) = (refcnt))
+#define Py_SET_TYPE(ob, type)      (Py_TYPE(ob) = (type))
+#define Py_SET_SIZE(ob, size)      (Py_SIZE(ob) = (size))
+#endif
+
+// The maximum number of dimensions of buffers, not defined by Python 2.7
+#ifndef PyBUF_MAX_NDIM
+#define PyBUF_MAX_NDIM 64
+#endif
+
+#if defined(_MSC_VER)
+#define JPY_THREAD_LOCAL __declspec(thread)
+#else
+#define JPY_THREAD_LOCAL __thread
 #endif
 
 
@@ -206,26 +206,11 @@ PyObject* JPy_FromJString(JNIEnv* jenv, jstring stringRef)
 
 #if defined(JPY_COMPAT_33P)
 
-    const jchar* jChars;
-    jint length;
-
-    if (stringRef == NULL) {
-        return Py_BuildValue("");
-    }
-
-    length = (*jenv)->GetStringLength(jenv, stringRef);
-    if (length == 0) {
-        return Py_BuildValue("s", "");
-    }
-
-    jChars = (*jenv)->GetStringChars(jenv, stringRef, NULL);
-    if (jChars == NULL) {
-        PyErr_NoMemory();
-        return NULL;
-    }
+    JPy_JCharBuffer buffer;
 
-    returnValue = JPy_FROM_WIDE_CHAR_STR(jChars, length);
-    (*jenv)->ReleaseStringChars(jenv, stringRef, jChars);
+    JPy_InitJCharBuffer(&buffer);
+    returnValue = JPy_FromJStringBuffered(jenv, stringRef, &buffer);
+    JPy_FreeJCharBuffer(&buffer);
 
 #elif defined(JPY_COMPAT_27)
 
@@ -249,11 +234,90 @@ PyObject* JPy_FromJString(JNIEnv* jenv, jstring stringRef)
     return returnValue;
 }
 
+static PyObject* JPy_InternString(PyObject* pyString)
+{
+#if defined(JPY_COMPAT_33P)
+    if (PyUnicode_CheckExact(pyString)) {
+        PyUnicode_InternInPlace(&pyString);
+    }
+#elif defined(JPY_COMPAT_27)
+    if (PyString_CheckExact(pyString)) {
+        PyString_InternInPlace(&pyString);
+    }
+#endif
+    return pyString;
+}
+
+PyObject* JPy_FromJStringInterned(JNIEnv* jenv, jstring stringRef)
+{
+    JPy_ModuleState* state;
+    JPy_NameCacheEntry* entry;
+    PyObject* pyName;
+    jchar chars[JPy_NAME_CACHE_MAX_LENGTH];
+    jint length;
+    jint i;
+    unsigned int hash;
+
+    state = JPy_GetModuleState();
+    length = stringRef != NULL ? (*jenv)->GetStringLength(jenv, stringRef) : 0;
+    if (state->module == NULL || length == 0 || length > JPy_NAME_CACHE_MAX_LENGTH) {
+        pyName = JPy_FromJString(jenv, stringRef);
+        return pyName != NULL ? JPy_InternString(pyName) : NULL;
+    }
+
+    // Copying the characters avoids the allocation made by GetStringUTFChars() and GetStringChars()
+    (*jenv)->GetStringRegion(jenv, stringRef, 0, length, chars);
+    hash = 2166136261u;
+    for (i = 0; i < length; i++) {
+        hash = (hash ^ chars[i]) * 16777619u;
+    }
+    entry = &state->nameCache[hash & (JPy_NAME_CACHE_SIZE - 1)];
+
+    pyName = NULL;
+    JPy_BEGIN_CRITICAL_SECTION(state->module);
+    if (entry->name != NULL && entry->length == length && memcmp(entry->chars, chars, length * sizeof (jchar)) == 0) {
+        pyName = entry->name;
+        Py_INCREF(pyName);
+    }
+    JPy_END_CRITICAL_SECTION();
+    if (pyName != NULL) {
+        return pyName;
+    }
+
+    pyName = JPy_FromJString(jenv, stringRef);
+    if (pyName == NULL) {
+        return NULL;
+    }
+    pyName = JPy_InternString(pyName);
+
+    JPy_BEGIN_CRITICAL_SECTION(state->module);
+    Py_XDECREF(entry->name);
+    Py_INCREF(pyName);
+    entry->name = pyName;
+    entry->length = length;
+    memcpy(entry->chars, chars, length * sizeof (jchar));
+    JPy_END_CRITICAL_SECTION();
+
+    return pyName;
+}
+
 /**
  * Returns a new Java string (a local reference).
  */
 int JPy_AsJString(JNIEnv* jenv, PyObject* arg, jstring* stringRef)
 {
+#if defined(JPY_COMPAT_33P)
+
+    JPy_JCharBuffer buffer;
+    int result;
+
+    JPy_InitJCharBuffer(&buffer);
+    result = JPy_AsJStringBuffered(jenv, arg, &buffer, stringRef);
+    JPy_FreeJCharBuffer(&buffer);
+    return result;
+
+#else
+
     Py_ssize_t length;
     wchar_t* wChars;
 
@@ -262,13 +326,11 @@ int JPy_AsJString(JNIEnv* jenv, PyObject* arg, jstring* stringRef)
         return 0;
     }
 
-#if defined(JPY_COMPAT_27)
     if (PyString_Check(arg)) {
         char* cstr = PyString_AsString(arg);
         *stringRef = (*jenv)->NewStringUTF(jenv, cstr);
         return *stringRef != NULL ? 0 : -1;
     }
-#endif
 
     wChars = JPy_AS_WIDE_CHAR_STR(arg, &length);
     if (wChars == NULL) {
@@ -297,5 +359,269 @@ error:
     PyMem_Del(wChars);
 
     return 0;
+
+#endif
+}
+
+void JPy_InitJCharBuffer(JPy_JCharBuffer* buffer)
+{
+    buffer->chars = buffer->inlineChars;
+    buffer->capacity = JPy_JCHAR_BUFFER_INLINE_SIZE;
+}
+
+void JPy_FreeJCharBuffer(JPy_JCharBuffer* buffer)
+{
+    if (buffer->chars != buffer->inlineChars) {
+        PyMem_Del(buffer->chars);
+    }
+    JPy_InitJCharBuffer(buffer);
+}
+
+/**
+ * Returns the characters of the given buffer, grown to hold at least the given number of characters.
+ * The previous contents are not preserved.
+ */
+static jchar* JPy_ReserveJChars(JPy_JCharBuffer* buffer, Py_ssize_t length)
+{
+    Py_ssize_t capacity;
+    jchar* chars;
+
+    if (length <= buffer->capacity) {
+        return buffer->chars;
+    }
+
+    capacity = length < 2 * buffer->capacity ? 2 * buffer->capacity : length;
+    chars = PyMem_New(jchar, capacity);
+    if (chars == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+    JPy_FreeJCharBuffer(buffer);
+    buffer->chars = chars;
+    buffer->capacity = capacity;
+    return chars;
+}
+
+int JPy_AsJStringBuffered(JNIEnv* jenv, PyObject* arg, JPy_JCharBuffer* buffer, jstring* stringRef)
+{
+#if defined(JPY_COMPAT_33P)
+
+    const void* data;
+    const jchar* chars;
+    jchar* utf16Chars;
+    Py_ssize_t length;
+    Py_ssize_t utf16Length;
+    Py_ssize_t i;
+
+    *stringRef = NULL;
+
+    if (arg == Py_None) {
+        return 0;
+    }
+    if (!PyUnicode_Check(arg)) {
+        PyErr_BadArgument();
+        return -1;
+    }
+
+#if PY_VERSION_HEX < 0x030C0000
+    if (PyUnicode_READY(arg) < 0) {
+        return -1;
+    }
+#endif
+
+    // Transcode the string's canonical representation (PEP 393) into UTF-16 directly
+    length = PyUnicode_GET_LENGTH(arg);
+    data = PyUnicode_DATA(arg);
+    if (PyUnicode_KIND(arg) == PyUnicode_2BYTE_KIND) {
+        chars = (const jchar*) data;
+        utf16Length = length;
+    } else if (PyUnicode_KIND(arg) == PyUnicode_1BYTE_KIND) {
+        utf16Chars = JPy_ReserveJChars(buffer, length);
+        if (utf16Chars == NULL) {
+            return -1;
+        }
+        for (i = 0; i < length; i++) {
+            utf16Chars[i] = ((const Py_UCS1*) data)[i];
+        }
+        chars = utf16Chars;
+        utf16Length = length;
+    } else {
+        // Characters outside the Basic Multilingual Plane become surrogate pairs
+        utf16Chars = JPy_ReserveJChars(buffer, 2 * length);
+        if (utf16Chars == NULL) {
+            return -1;
+        }
+        utf16Length = 0;
+        for (i = 0; i < length; i++) {
+            Py_UCS4 c = ((const Py_UCS4*) data)[i];
+            if (c >= 0x10000) {
+                c -= 0x10000;
+                utf16Chars[utf16Length++] = (jchar) (0xD800 | (c >> 10));
+                utf16Chars[utf16Length++] = (jchar) (0xDC00 | (c & 0x3FF));
+            } else {
+                utf16Chars[utf16Length++] = (jchar) c;
+            }
+        }
+        chars = utf16Chars;
+    }
+
+    if (utf16Length > 0x7FFFFFFF) {
+        PyErr_SetString(PyExc_OverflowError, "jpy: string too long for a Java string");
+        return -1;
+    }
+
+    *stringRef = (*jenv)->NewString(jenv, chars, (jsize) utf16Length);
+    if (*stringRef == NULL) {
+        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+
+#else
+
+    return JPy_AsJString(jenv, arg, stringRef);
+
+#endif
+}
+
+PyObject* JPy_FromJStringBuffered(JNIEnv* jenv, jstring stringRef, JPy_JCharBuffer* buffer)
+{
+#if defined(JPY_COMPAT_33P)
+
+    jchar* chars;
+    jint length;
+    jint i;
+
+    if (stringRef == NULL) {
+        return JPy_FROM_JNULL();
+    }
+
+    length = (*jenv)->GetStringLength(jenv, stringRef);
+    if (length == 0) {
+        return PyUnicode_New(0, 0);
+    }
+
+    // Copying the characters into the buffer avoids the allocation made by GetStringChars()
+    chars = JPy_ReserveJChars(buffer, length);
+    if (chars == NULL) {
+        return NULL;
+    }
+    (*jenv)->GetStringRegion(jenv, stringRef, 0, length, chars);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+
+    for (i = 0; i < length; i++) {
+        if ((chars[i] & 0xF800) == 0xD800) {
+            // Surrogate pairs become characters outside the Basic Multilingual Plane
+            int byteOrder = PY_LITTLE_ENDIAN ? -1 : 1;
+            return PyUnicode_DecodeUTF16((const char*) chars, 2 * (Py_ssize_t) length, "surrogatepass", &byteOrder);
+        }
+    }
+    return PyUnicode_FromKindAndData(PyUnicode_2BYTE_KIND, chars, length);
+
+#else
+
+    return JPy_FromJString(jenv, stringRef);
+
+#endif
+}
+
+int JPy_AsJStringArray(JNIEnv* jenv, PyObject* pyArg, jobjectArray* arrayRef)
+{
+    JPy_JCharBuffer buffer;
+    PyObject* pySeq;
+    PyObject* pyItem;
+    jobject itemRef;
+    Py_ssize_t count;
+    Py_ssize_t index;
+    int result;
+
+    pySeq = PySequence_Fast(pyArg, "jpy: a sequence is required");
+    if (pySeq == NULL) {
+        return -1;
+    }
+
+    JPy_InitJCharBuffer(&buffer);
+    result = 0;
+
+    JPy_BEGIN_CRITICAL_SECTION(pySeq);
+    count = PySequence_Fast_GET_SIZE(pySeq);
+    *arrayRef = (*jenv)->NewObjectArray(jenv, (jsize) count, JPy_String_JClass, NULL);
+    if (*arrayRef == NULL || (*jenv)->ExceptionCheck(jenv)) {
+        JPy_HandleJavaException(jenv);
+        result = -1;
+    }
+    for (index = 0; result == 0 && index < count; index++) {
+        // Converting non-str items may run Python code which modifies a list, see JColl_ConvertItems()
+        if (PySequence_Fast_GET_SIZE(pySeq) != count) {
+            PyErr_SetString(PyExc_RuntimeError, "jpy: sequence changed size during conversion");
+            (*jenv)->DeleteLocalRef(jenv, *arrayRef);
+            result = -1;
+            break;
+        }
+        pyItem = PySequence_Fast_GET_ITEM(pySeq, index);
+        Py_INCREF(pyItem);
+        if (JPy_IS_STR(pyItem)) {
+            result = JPy_AsJStringBuffered(jenv, pyItem, &buffer, &itemRef);
+        } else {
+            result = JType_ConvertPythonToJavaObject(jenv, JPy_JString, pyItem, &itemRef);
+        }
+        if (result == 0) {
+            (*jenv)->SetObjectArrayElement(jenv, *arrayRef, (jsize) index, itemRef);
+            if (itemRef != NULL && !JObj_Check(pyItem)) {
+                (*jenv)->DeleteLocalRef(jenv, itemRef);
+            }
+            if ((*jenv)->ExceptionCheck(jenv)) {
+                JPy_HandleJavaException(jenv);
+                result = -1;
+            }
+        }
+        Py_DECREF(pyItem);
+        if (result < 0) {
+            (*jenv)->DeleteLocalRef(jenv, *arrayRef);
+        }
+    }
+    JPy_END_CRITICAL_SECTION();
+
+    JPy_FreeJCharBuffer(&buffer);
+    Py_DECREF(pySeq);
+    return result;
+}
+
+PyObject* JPy_FromJStringArray(JNIEnv* jenv, jobjectArray arrayRef)
+{
+    JPy_JCharBuffer buffer;
+    PyObject* pyList;
+    PyObject* pyItem;
+    jstring itemRef;
+    jsize length;
+    jsize index;
+
+    length = (*jenv)->GetArrayLength(jenv, arrayRef);
+    pyList = PyList_New(length);
+    if (pyList == NULL) {
+        return NULL;
+    }
+
+    JPy_InitJCharBuffer(&buffer);
+    for (index = 0; index < length; index++) {
+        itemRef = (*jenv)->GetObjectArrayElement(jenv, arrayRef, index);
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+        pyItem = JPy_FromJStringBuffered(jenv, itemRef, &buffer);
+        if (itemRef != NULL) {
+            (*jenv)->DeleteLocalRef(jenv, itemRef);
+        }
+        if (pyItem == NULL) {
+            goto error;
+        }
+        PyList_SET_ITEM(pyList, index, pyItem);
+    }
+    JPy_FreeJCharBuffer(&buffer);
+    return pyList;
+
+error:
+    JPy_FreeJCharBuffer(&buffer);
+    Py_DECREF(pyList);
+    return NULL;
 }
 
@@ -69,6 +69,12 @@ extern "C" {
  */
 PyObject* JPy_FromJString(JNIEnv* jenv, jstring stringRef);
 
+/**
+ * Convert Java string to interned Python string/unicode object, e.g. an attribute name.
+ * Short strings are looked up in a per-interpreter cache first.
+ */
+PyObject* JPy_FromJStringInterned(JNIEnv* jenv, jstring stringRef);
+
 /**
  * Convert any Java Object to Python Object.
  */
@@ -84,6 +90,43 @@ PyObject* JPy_FromJObjectWithType(JNIEnv* jenv, jobject objectRef, JPy_JType* ty
  */
 int JPy_AsJString(JNIEnv* jenv, PyObject* pyObj, jstring* stringRef);
 
+#define JPy_JCHAR_BUFFER_INLINE_SIZE 128
+
+/**
+ * A scratch buffer for the UTF-16 characters of strings converted between Python and Java.
+ * Converting many strings with the same buffer allocates memory only for strings longer than any before.
+ */
+typedef struct JPy_JCharBuffer
+{
+    jchar* chars;
+    Py_ssize_t capacity;
+    jchar inlineChars[JPy_JCHAR_BUFFER_INLINE_SIZE];
+}
+JPy_JCharBuffer;
+
+void JPy_InitJCharBuffer(JPy_JCharBuffer* buffer);
+void JPy_FreeJCharBuffer(JPy_JCharBuffer* buffer);
+
+/**
+ * Convert Python unicode object to Java String using the given scratch buffer.
+ */
+int JPy_AsJStringBuffered(JNIEnv* jenv, PyObject* pyObj, JPy_JCharBuffer* buffer, jstring* stringRef);
+
+/**
+ * Convert Java string to Python string/unicode object using the given scratch buffer.
+ */
+PyObject* JPy_FromJStringBuffered(JNIEnv* jenv, jstring stringRef, JPy_JCharBuffer* buffer);
+
+/**
+ * Convert the items of a Python sequence (strings, None or Java objects) into a new Java String[] array.
+ */
+int JPy_AsJStringArray(JNIEnv* jenv, PyObject* pyArg, jobjectArray* arrayRef);
+
+/**
+ * Convert the items of a Java String[] array into a new Python list.
+ */
+PyObject* JPy_FromJStringArray(JNIEnv* jenv, jobjectArray arrayRef);
+
 /**
  * Convert any Python objects to Java object.
  */
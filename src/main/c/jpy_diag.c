@@ -17,6 +17,7 @@
 #include <Python.h>
 #include "structmember.h"
 #include "jpy_diag.h"
+#include "jpy_module.h"
 #include "jpy_compat.h"
 
 int JPy_DiagFlags = JPy_DIAG_F_OFF;
@@ -38,7 +39,7 @@ PyObject* Diag_New(void)
 {
     JPy_Diag* self;
 
-    self = (JPy_Diag*) PyObject_New(PyObject, &Diag_Type);
+    self = (JPy_Diag*) PyObject_New(PyObject, JPy_GetModuleState()->diagType);
 
     self->F_OFF   = JPy_DIAG_F_OFF;
     self->F_TYPE  = JPy_DIAG_F_TYPE;
@@ -52,6 +53,11 @@ PyObject* Diag_New(void)
     return (PyObject*) self;
 }
 
+void Diag_dealloc(JPy_Diag* self)
+{
+    JPy_FREE_INSTANCE(self)
+}
+
 
 PyObject* Diag_getattro(JPy_Diag* self, PyObject *attr_name)
 {
@@ -102,7 +108,7 @@ PyTypeObject Diag_Type =
     "jpy.Diag",                   /* tp_name */
     sizeof (JPy_Diag),            /* tp_basicsize */
     0,                            /* tp_itemsize */
-    NULL,                         /* tp_dealloc */
+    (destructor) Diag_dealloc,    /* tp_dealloc */
     NULL,                         /* tp_print */
     NULL,                         /* tp_getattr */
     NULL,                         /* tp_setattr */
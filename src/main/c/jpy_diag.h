@@ -48,6 +48,7 @@ JPy_Diag;
 #define JPy_DIAG_F_ERR    0x20
 #define JPy_DIAG_F_ALL    0xff
 
+// The template of the Python diag type. Use JPy_GetModuleState()->diagType, the copy of the current interpreter.
 extern PyTypeObject Diag_Type;
 extern int JPy_DiagFlags;
 
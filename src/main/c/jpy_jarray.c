@@ -17,6 +17,11 @@
 #include "jpy_module.h"
 #include "jpy_diag.h"
 #include "jpy_jarray.h"
+#include "jpy_jtype.h"
+#include "jpy_jobj.h"
+#include "jpy_conv.h"
+
+#include <string.h>
 
 
 #define PRINT_FLAG(F) printf("JArray_GetBufferProc: %s = %d\n", #F, (flags & F) != 0);
@@ -24,6 +29,11 @@
 
 //#define JPy_USE_GET_PRIMITIVE_ARRAY_CRITICAL 1
 
+/*
+ * The strides of exported one-dimensional buffers, indexed by item size.
+ */
+static Py_ssize_t JArray_BufferStrides[] = {0, 1, 2, 0, 4, 0, 0, 0, 8};
+
 
 /*
  * Implements the getbuffer() method of the buffer protocol for JPy_JArray objects.
@@ -103,12 +113,12 @@ int JArray_GetBufferProc(JPy_JArray* self, Py_buffer* view, int flags, char java
     view->buf = buf;
     view->len = itemCount * itemSize;
     view->itemsize = itemSize;
-    view->readonly = (flags & (PyBUF_WRITE | PyBUF_WRITEABLE)) == 0;
+    // Writability is tracked per export by view->readonly, see JArray_ReleaseBufferProc()
+    view->readonly = (flags & PyBUF_WRITABLE) == 0;
     view->ndim = 1;
-    view->shape = PyMem_New(Py_ssize_t, 1);
-    *view->shape = itemCount;
-    view->strides = PyMem_New(Py_ssize_t, 1);
-    *view->strides = itemSize;
+    self->bufferShape = itemCount;
+    view->shape = &self->bufferShape;
+    view->strides = &JArray_BufferStrides[itemSize];
     view->suboffsets = NULL;
     if ((flags & PyBUF_FORMAT) != 0) {
         view->format = (char*) format;
@@ -127,7 +137,7 @@ int JArray_GetBufferProc(JPy_JArray* self, Py_buffer* view, int flags, char java
     */
 
     // Step 3/5
-    self->bufferExportCount++;
+    JPy_ATOMIC_ADD(self->bufferExportCount, 1);
 
     // Step 4/5
     view->obj = (PyObject*) self;
@@ -179,46 +189,51 @@ int JArray_getbufferproc_double(JPy_JArray* self, Py_buffer* view, int flags)
 
 
 /*
- * Implements the releasebuffer() method the buffer protocol for JPy_JArray objects
+ * Implements the releasebuffer() method the buffer protocol for JPy_JArray objects.
+ * Each export has acquired its own array elements, so each one is released here. Read-only exports are
+ * released with JNI_ABORT, so that the JVM doesn't copy the (unchanged) items back into the Java array.
  */
 void JArray_ReleaseBufferProc(JPy_JArray* self, Py_buffer* view, char javaType)
 {
+    jint mode;
+
     // Step 1
-    self->bufferExportCount--;
+    JPy_ATOMIC_ADD(self->bufferExportCount, -1);
 
-    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JArray_ReleaseBufferProc: buf=%p, bufferExportCount=%d\n", view->buf, self->bufferExportCount);
+    mode = view->readonly ? JNI_ABORT : 0;
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JArray_ReleaseBufferProc: buf=%p, bufferExportCount=%d, readonly=%d\n", view->buf, self->bufferExportCount, view->readonly);
 
     // Step 2
-    if (self->bufferExportCount == 0 && view->buf != NULL) {
+    if (view->buf != NULL) {
         JNIEnv* jenv = JPy_GetJNIEnv();
         if (jenv != NULL) {
 #ifdef JPy_USE_GET_PRIMITIVE_ARRAY_CRITICAL
-           (*jenv)->ReleasePrimitiveArrayCritical(jenv, self->objectRef, view->buf, 0);
+           (*jenv)->ReleasePrimitiveArrayCritical(jenv, self->objectRef, view->buf, mode);
 #else
             if (javaType == 'Z') {
-                (*jenv)->ReleaseBooleanArrayElements(jenv, self->objectRef, (jboolean*) view->buf, 0);
+                (*jenv)->ReleaseBooleanArrayElements(jenv, self->objectRef, (jboolean*) view->buf, mode);
             } else if (javaType == 'C') {
-                (*jenv)->ReleaseCharArrayElements(jenv, self->objectRef, (jchar*) view->buf, 0);
+                (*jenv)->ReleaseCharArrayElements(jenv, self->objectRef, (jchar*) view->buf, mode);
             } else if (javaType == 'B') {
-                (*jenv)->ReleaseByteArrayElements(jenv, self->objectRef, (jbyte*) view->buf, 0);
+                (*jenv)->ReleaseByteArrayElements(jenv, self->objectRef, (jbyte*) view->buf, mode);
             } else if (javaType == 'S') {
-                (*jenv)->ReleaseShortArrayElements(jenv, self->objectRef, (jshort*) view->buf, 0);
+                (*jenv)->ReleaseShortArrayElements(jenv, self->objectRef, (jshort*) view->buf, mode);
             } else if (javaType == 'I') {
-                (*jenv)->ReleaseIntArrayElements(jenv, self->objectRef, (jint*) view->buf, 0);
+                (*jenv)->ReleaseIntArrayElements(jenv, self->objectRef, (jint*) view->buf, mode);
             } else if (javaType == 'J') {
-                (*jenv)->ReleaseLongArrayElements(jenv, self->objectRef, (jlong*) view->buf, 0);
+                (*jenv)->ReleaseLongArrayElements(jenv, self->objectRef, (jlong*) view->buf, mode);
             } else if (javaType == 'F') {
-                (*jenv)->ReleaseFloatArrayElements(jenv, self->objectRef, (jfloat*) view->buf, 0);
+                (*jenv)->ReleaseFloatArrayElements(jenv, self->objectRef, (jfloat*) view->buf, mode);
             } else if (javaType == 'D') {
-                (*jenv)->ReleaseDoubleArrayElements(jenv, self->objectRef, (jdouble*) view->buf, 0);
+                (*jenv)->ReleaseDoubleArrayElements(jenv, self->objectRef, (jdouble*) view->buf, mode);
             }
 #endif
         }
         view->buf = NULL;
     }
 
-    // todo - check if we must Py_DECREF here
-    //Py_DECREF(view->obj);
+    // Note: view->obj is released by PyBuffer_Release()
 }
 
 // todo: py27: fix all releasebufferproc() functions which have different parameter types in 2.7
@@ -309,6 +324,200 @@ void JArray_releasebufferproc_double(JPy_JArray* self, Py_buffer* view)
 #endif
 
 
+/*
+ * Header of the memory block allocated for each multi-dimensional buffer export.
+ * The shape and strides arrays (ndim items each) and the gathered items follow this header.
+ */
+typedef struct JArray_NDExport
+{
+    char javaType;
+    int ndim;
+}
+JArray_NDExport;
+
+/*
+ * Copies the items of a rectangular nested Java primitive array from (or, if write is true, into) the
+ * C-contiguous memory at buf. Dimension dim of the array is copied, shape and strides describe buf.
+ */
+int JArray_CopyNDRegion(JNIEnv* jenv, jobjectArray arrayRef, int dim, int ndim, const Py_ssize_t* shape, const Py_ssize_t* strides, char javaType, char* buf, jboolean write)
+{
+    jarray itemRef;
+    Py_ssize_t i;
+    int ret;
+
+    if (dim == ndim - 1) {
+        if (write) {
+            JArray_SetRegion(jenv, javaType, arrayRef, (jint) shape[dim], buf);
+        } else {
+            JArray_GetRegion(jenv, javaType, arrayRef, (jint) shape[dim], buf);
+        }
+        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+        return 0;
+    }
+
+    for (i = 0; i < shape[dim]; i++) {
+        itemRef = (*jenv)->GetObjectArrayElement(jenv, arrayRef, (jint) i);
+        JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+        if (itemRef == NULL || (*jenv)->GetArrayLength(jenv, itemRef) != shape[dim + 1]) {
+            if (itemRef != NULL) {
+                (*jenv)->DeleteLocalRef(jenv, itemRef);
+            }
+            PyErr_Format(PyExc_BufferError, "nested Java array must be rectangular, but an item at depth %d is null or has a length other than %d", dim + 1, (int) shape[dim + 1]);
+            return -1;
+        }
+        ret = JArray_CopyNDRegion(jenv, itemRef, dim + 1, ndim, shape, strides, javaType, buf + i * strides[dim], write);
+        (*jenv)->DeleteLocalRef(jenv, itemRef);
+        if (ret < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * Implements the getbuffer() method of the buffer protocol for nested Java primitive arrays, e.g. 'double[][]'.
+ * NumPy doesn't accept indirect buffers (suboffsets), so the items are gathered into a new C-contiguous
+ * memory block for each export. Writable exports are copied back into the Java arrays on release.
+ * The export must be enabled by jpy.set_nd_buffers(True).
+ */
+int JArray_GetNDBufferProc(JPy_JObj* self, Py_buffer* view, int flags)
+{
+    JNIEnv* jenv;
+    JPy_JType* itemType;
+    JArray_NDExport* export;
+    Py_ssize_t shape[PyBUF_MAX_NDIM];
+    Py_ssize_t* exportShape;
+    Py_ssize_t* exportStrides;
+    Py_ssize_t itemCount;
+    jarray itemRef;
+    char javaType;
+    jint itemSize;
+    const char* dtypeName;
+    const char* format;
+    int ndim;
+    int i;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+
+    if (!JPy_NDBufferExport) {
+        PyErr_SetString(PyExc_BufferError, "buffer export of nested Java arrays is disabled, see jpy.set_nd_buffers()");
+        return -1;
+    }
+
+    if ((flags & PyBUF_ND) != PyBUF_ND) {
+        PyErr_SetString(PyExc_BufferError, "nested Java arrays can only be exported as buffers with shape information");
+        return -1;
+    }
+
+    // Determine the number of dimensions and the primitive item type, e.g. 2 and 'double' for 'double[][]'
+    ndim = 0;
+    itemType = (JPy_JType*) Py_TYPE(self);
+    while (itemType->componentType != NULL && ndim < PyBUF_MAX_NDIM) {
+        itemType = itemType->componentType;
+        ndim++;
+    }
+    if (JArray_GetPrimitiveInfo(itemType, &javaType, &itemSize, &dtypeName) < 0) {
+        return -1;
+    }
+
+    // Determine the shape by following the first item of each dimension
+    itemCount = 1;
+    itemRef = (*jenv)->NewLocalRef(jenv, self->objectRef);
+    for (i = 0; i < ndim; i++) {
+        jarray nextRef;
+        shape[i] = itemRef != NULL ? (*jenv)->GetArrayLength(jenv, itemRef) : 0;
+        itemCount *= shape[i];
+        nextRef = itemRef != NULL && i < ndim - 1 && shape[i] > 0 ? (*jenv)->GetObjectArrayElement(jenv, itemRef, 0) : NULL;
+        if (itemRef != NULL) {
+            (*jenv)->DeleteLocalRef(jenv, itemRef);
+        }
+        itemRef = nextRef;
+    }
+
+    export = (JArray_NDExport*) PyMem_Malloc(sizeof (JArray_NDExport) + 2 * ndim * sizeof (Py_ssize_t) + itemCount * itemSize);
+    if (export == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    export->javaType = javaType;
+    export->ndim = ndim;
+    exportShape = (Py_ssize_t*) (export + 1);
+    exportStrides = exportShape + ndim;
+    for (i = ndim - 1; i >= 0; i--) {
+        exportShape[i] = shape[i];
+        exportStrides[i] = i == ndim - 1 ? itemSize : exportStrides[i + 1] * shape[i + 1];
+    }
+
+    view->buf = exportStrides + ndim;
+    if (itemCount > 0 && JArray_CopyNDRegion(jenv, self->objectRef, 0, ndim, exportShape, exportStrides, javaType, (char*) view->buf, JNI_FALSE) < 0) {
+        PyMem_Free(export);
+        return -1;
+    }
+
+    if (javaType == 'Z') {
+        format = "B";
+    } else if (javaType == 'C') {
+        format = "H";
+    } else if (javaType == 'B') {
+        format = "b";
+    } else if (javaType == 'S') {
+        format = "h";
+    } else if (javaType == 'I') {
+        format = "i";
+    } else if (javaType == 'J') {
+        format = "q";
+    } else if (javaType == 'F') {
+        format = "f";
+    } else {
+        format = "d";
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JArray_GetNDBufferProc: buf=%p, type='%s', format='%s', ndim=%d, itemCount=%d\n", view->buf, Py_TYPE(self)->tp_name, format, ndim, (int) itemCount);
+
+    view->len = itemCount * itemSize;
+    view->itemsize = itemSize;
+    view->readonly = (flags & PyBUF_WRITABLE) == 0;
+    view->ndim = ndim;
+    view->shape = exportShape;
+    view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? exportStrides : NULL;
+    view->suboffsets = NULL;
+    view->format = (flags & PyBUF_FORMAT) != 0 ? (char*) format : NULL;
+    view->internal = export;
+    view->obj = (PyObject*) self;
+    Py_INCREF(view->obj);
+    return 0;
+}
+
+/*
+ * Implements the releasebuffer() method of the buffer protocol for nested Java primitive arrays.
+ */
+void JArray_ReleaseNDBufferProc(JPy_JObj* self, Py_buffer* view)
+{
+    JArray_NDExport* export;
+    Py_ssize_t* exportShape;
+
+    export = (JArray_NDExport*) view->internal;
+    if (export == NULL) {
+        return;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JArray_ReleaseNDBufferProc: buf=%p, readonly=%d\n", view->buf, view->readonly);
+
+    exportShape = (Py_ssize_t*) (export + 1);
+    if (!view->readonly && view->len > 0) {
+        JNIEnv* jenv = JPy_GetJNIEnv();
+        if (jenv != NULL) {
+            // The Java arrays may have been modified meanwhile. If they are no longer rectangular, items are not copied back.
+            if (JArray_CopyNDRegion(jenv, self->objectRef, 0, export->ndim, exportShape, exportShape + export->ndim, export->javaType, (char*) view->buf, JNI_TRUE) < 0) {
+                PyErr_Clear();
+            }
+        }
+    }
+
+    PyMem_Free(export);
+    view->internal = NULL;
+}
+
 PyBufferProcs JArray_as_buffer_boolean = {
     JPY_PY27_OLD_BUFFER_PROCS
     (getbufferproc) JArray_getbufferproc_boolean,
@@ -356,3 +565,634 @@ PyBufferProcs JArray_as_buffer_double = {
     (getbufferproc) JArray_getbufferproc_double,
     (releasebufferproc) JArray_releasebufferproc_double
 };
+
+PyBufferProcs JArray_as_nd_buffer = {
+    JPY_PY27_OLD_BUFFER_PROCS
+    (getbufferproc) JArray_GetNDBufferProc,
+    (releasebufferproc) JArray_ReleaseNDBufferProc
+};
+
+
+/*
+ * Gets the JNI type character, the item size and the numpy dtype name of the given primitive Java type.
+ */
+int JArray_GetPrimitiveInfo(JPy_JType* type, char* javaType, jint* itemSize, const char** dtypeName)
+{
+    if (type == JPy_JBoolean) {
+        *javaType = 'Z';
+        *itemSize = sizeof(jboolean);
+        *dtypeName = "bool";
+    } else if (type == JPy_JChar) {
+        *javaType = 'C';
+        *itemSize = sizeof(jchar);
+        *dtypeName = "uint16";
+    } else if (type == JPy_JByte) {
+        *javaType = 'B';
+        *itemSize = sizeof(jbyte);
+        *dtypeName = "int8";
+    } else if (type == JPy_JShort) {
+        *javaType = 'S';
+        *itemSize = sizeof(jshort);
+        *dtypeName = "int16";
+    } else if (type == JPy_JInt) {
+        *javaType = 'I';
+        *itemSize = sizeof(jint);
+        *dtypeName = "int32";
+    } else if (type == JPy_JLong) {
+        *javaType = 'J';
+        *itemSize = sizeof(jlong);
+        *dtypeName = "int64";
+    } else if (type == JPy_JFloat) {
+        *javaType = 'F';
+        *itemSize = sizeof(jfloat);
+        *dtypeName = "float32";
+    } else if (type == JPy_JDouble) {
+        *javaType = 'D';
+        *itemSize = sizeof(jdouble);
+        *dtypeName = "float64";
+    } else {
+        PyErr_Format(PyExc_ValueError, "primitive Java type expected, got '%s'", type->javaName);
+        return -1;
+    }
+    return 0;
+}
+
+jarray JArray_NewPrimitiveArray(JNIEnv* jenv, char javaType, jint length)
+{
+    if (javaType == 'Z') {
+        return (*jenv)->NewBooleanArray(jenv, length);
+    } else if (javaType == 'C') {
+        return (*jenv)->NewCharArray(jenv, length);
+    } else if (javaType == 'B') {
+        return (*jenv)->NewByteArray(jenv, length);
+    } else if (javaType == 'S') {
+        return (*jenv)->NewShortArray(jenv, length);
+    } else if (javaType == 'I') {
+        return (*jenv)->NewIntArray(jenv, length);
+    } else if (javaType == 'J') {
+        return (*jenv)->NewLongArray(jenv, length);
+    } else if (javaType == 'F') {
+        return (*jenv)->NewFloatArray(jenv, length);
+    } else if (javaType == 'D') {
+        return (*jenv)->NewDoubleArray(jenv, length);
+    }
+    return NULL;
+}
+
+/*
+ * Copies length items from the start of the primitive Java array into buf using a single bulk region copy.
+ */
+void JArray_GetRegion(JNIEnv* jenv, char javaType, jarray arrayRef, jint length, void* buf)
+{
+    if (javaType == 'Z') {
+        (*jenv)->GetBooleanArrayRegion(jenv, arrayRef, 0, length, (jboolean*) buf);
+    } else if (javaType == 'C') {
+        (*jenv)->GetCharArrayRegion(jenv, arrayRef, 0, length, (jchar*) buf);
+    } else if (javaType == 'B') {
+        (*jenv)->GetByteArrayRegion(jenv, arrayRef, 0, length, (jbyte*) buf);
+    } else if (javaType == 'S') {
+        (*jenv)->GetShortArrayRegion(jenv, arrayRef, 0, length, (jshort*) buf);
+    } else if (javaType == 'I') {
+        (*jenv)->GetIntArrayRegion(jenv, arrayRef, 0, length, (jint*) buf);
+    } else if (javaType == 'J') {
+        (*jenv)->GetLongArrayRegion(jenv, arrayRef, 0, length, (jlong*) buf);
+    } else if (javaType == 'F') {
+        (*jenv)->GetFloatArrayRegion(jenv, arrayRef, 0, length, (jfloat*) buf);
+    } else if (javaType == 'D') {
+        (*jenv)->GetDoubleArrayRegion(jenv, arrayRef, 0, length, (jdouble*) buf);
+    }
+}
+
+/*
+ * Copies length items from buf to the start of the primitive Java array using a single bulk region copy.
+ */
+void JArray_SetRegion(JNIEnv* jenv, char javaType, jarray arrayRef, jint length, const void* buf)
+{
+    if (javaType == 'Z') {
+        (*jenv)->SetBooleanArrayRegion(jenv, arrayRef, 0, length, (const jboolean*) buf);
+    } else if (javaType == 'C') {
+        (*jenv)->SetCharArrayRegion(jenv, arrayRef, 0, length, (const jchar*) buf);
+    } else if (javaType == 'B') {
+        (*jenv)->SetByteArrayRegion(jenv, arrayRef, 0, length, (const jbyte*) buf);
+    } else if (javaType == 'S') {
+        (*jenv)->SetShortArrayRegion(jenv, arrayRef, 0, length, (const jshort*) buf);
+    } else if (javaType == 'I') {
+        (*jenv)->SetIntArrayRegion(jenv, arrayRef, 0, length, (const jint*) buf);
+    } else if (javaType == 'J') {
+        (*jenv)->SetLongArrayRegion(jenv, arrayRef, 0, length, (const jlong*) buf);
+    } else if (javaType == 'F') {
+        (*jenv)->SetFloatArrayRegion(jenv, arrayRef, 0, length, (const jfloat*) buf);
+    } else if (javaType == 'D') {
+        (*jenv)->SetDoubleArrayRegion(jenv, arrayRef, 0, length, (const jdouble*) buf);
+    }
+}
+
+/*
+ * Stores a primitive Java value as the index-th item of a buffer of the given primitive type.
+ */
+void JArray_StoreJValue(char javaType, void* buf, Py_ssize_t index, const jvalue* value)
+{
+    if (javaType == 'Z') {
+        ((jboolean*) buf)[index] = value->z;
+    } else if (javaType == 'C') {
+        ((jchar*) buf)[index] = value->c;
+    } else if (javaType == 'B') {
+        ((jbyte*) buf)[index] = value->b;
+    } else if (javaType == 'S') {
+        ((jshort*) buf)[index] = value->s;
+    } else if (javaType == 'I') {
+        ((jint*) buf)[index] = value->i;
+    } else if (javaType == 'J') {
+        ((jlong*) buf)[index] = value->j;
+    } else if (javaType == 'F') {
+        ((jfloat*) buf)[index] = value->f;
+    } else if (javaType == 'D') {
+        ((jdouble*) buf)[index] = value->d;
+    }
+}
+
+/*
+ * Gets the struct format character of the items of a 1-D or 0-D Python buffer of numbers in native byte order.
+ * Returns 0 if the items are not supported by JArray_LoadJValue().
+ */
+char JArray_GetBufferItemCode(Py_buffer* view)
+{
+    const char* format;
+    Py_ssize_t size;
+
+    format = view->format != NULL ? view->format : "B";
+    if (*format == '@') {
+        format++;
+    }
+    if (format[0] == 0 || format[1] != 0) {
+        return 0;
+    }
+    if (*format == '?' || *format == 'b' || *format == 'B') {
+        size = 1;
+    } else if (*format == 'h' || *format == 'H') {
+        size = sizeof (short);
+    } else if (*format == 'i' || *format == 'I') {
+        size = sizeof (int);
+    } else if (*format == 'l' || *format == 'L') {
+        size = sizeof (long);
+    } else if (*format == 'q' || *format == 'Q') {
+        size = sizeof (long long);
+    } else if (*format == 'f') {
+        size = sizeof (float);
+    } else if (*format == 'd') {
+        size = sizeof (double);
+    } else {
+        return 0;
+    }
+    return view->itemsize == size ? *format : 0;
+}
+
+#define JArray_JINT_MIN  ((jlong) -2147483647 - 1)
+#define JArray_JINT_MAX  ((jlong) 2147483647)
+#define JArray_JLONG_MIN ((jlong) -9223372036854775807LL - 1)
+#define JArray_JLONG_MAX ((jlong) 9223372036854775807LL)
+
+/*
+ * Converts a floating point value into an integral value like Java's d2i and d2l instructions: NaN becomes 0,
+ * values out of the range [min, max] saturate. A C cast of such values is undefined.
+ */
+static jlong JArray_DoubleToJLong(jdouble d, jlong min, jlong max)
+{
+    if (d != d) {
+        return 0;
+    } else if (d <= (jdouble) min) {
+        return min;
+    } else if (d >= (jdouble) max) {
+        return max;
+    }
+    return (jlong) d;
+}
+
+/*
+ * Loads the buffer item of the given struct format character (see JArray_GetBufferItemCode()) into the given
+ * value, converted to the given primitive Java type like a Java cast. Doesn't use the Python API.
+ */
+void JArray_LoadJValue(char itemCode, const void* item, char javaType, jvalue* value)
+{
+    jlong j;
+    jdouble d;
+    jboolean isFloat;
+
+    j = 0;
+    d = 0.0;
+    isFloat = JNI_FALSE;
+    if (itemCode == '?' || itemCode == 'B') {
+        j = *(const unsigned char*) item;
+    } else if (itemCode == 'b') {
+        j = *(const signed char*) item;
+    } else if (itemCode == 'h') {
+        j = *(const short*) item;
+    } else if (itemCode == 'H') {
+        j = *(const unsigned short*) item;
+    } else if (itemCode == 'i') {
+        j = *(const int*) item;
+    } else if (itemCode == 'I') {
+        j = *(const unsigned int*) item;
+    } else if (itemCode == 'l') {
+        j = *(const long*) item;
+    } else if (itemCode == 'L') {
+        j = (jlong) *(const unsigned long*) item;
+    } else if (itemCode == 'q') {
+        j = *(const long long*) item;
+    } else if (itemCode == 'Q') {
+        j = (jlong) *(const unsigned long long*) item;
+    } else if (itemCode == 'f') {
+        d = *(const float*) item;
+        isFloat = JNI_TRUE;
+    } else if (itemCode == 'd') {
+        d = *(const double*) item;
+        isFloat = JNI_TRUE;
+    }
+
+    if (javaType == 'F') {
+        value->f = isFloat ? (jfloat) d : (jfloat) j;
+    } else if (javaType == 'D') {
+        value->d = isFloat ? d : (jdouble) j;
+    } else {
+        if (isFloat) {
+            // Like Java, narrower types than long are converted via int, e.g. (byte) d is (byte) (int) d
+            j = javaType == 'J' ? JArray_DoubleToJLong(d, JArray_JLONG_MIN, JArray_JLONG_MAX)
+                                : JArray_DoubleToJLong(d, JArray_JINT_MIN, JArray_JINT_MAX);
+        }
+        if (javaType == 'Z') {
+            value->z = (jboolean) (j != 0);
+        } else if (javaType == 'C') {
+            value->c = (jchar) j;
+        } else if (javaType == 'B') {
+            value->b = (jbyte) j;
+        } else if (javaType == 'S') {
+            value->s = (jshort) j;
+        } else if (javaType == 'I') {
+            value->i = (jint) j;
+        } else if (javaType == 'J') {
+            value->j = j;
+        }
+    }
+}
+
+/*
+ * Checks whether the items of a Python buffer can be copied bitwise into a Java array of the given primitive type.
+ * Only native byte order is accepted.
+ */
+int JArray_IsCompatibleBuffer(Py_buffer* view, char javaType, jint itemSize)
+{
+    const char* format;
+
+    format = view->format != NULL ? view->format : "B";
+    if (*format == '@' || *format == '=') {
+        format++;
+    }
+    if (view->itemsize != itemSize || format[0] == 0 || format[1] != 0) {
+        return 0;
+    }
+    if (javaType == 'F' || javaType == 'D') {
+        return strchr("efd", *format) != NULL;
+    }
+    return strchr("?bBhHiIlLqQnN", *format) != NULL;
+}
+
+/*
+ * Creates a new numpy.ndarray from a Java primitive array or from a rectangular Java array of primitive arrays.
+ * The items are transferred with bulk region copies, rows of nested arrays are copied in a single pass
+ * over the outer array. If copy is false and obj is a one-dimensional primitive array, the returned ndarray
+ * uses a read-only buffer export of the array (see JArray_GetBufferProc()) instead.
+ */
+PyObject* JArray_ToNumPy(JNIEnv* jenv, PyObject* obj, jboolean copy)
+{
+    JPy_JType* type;
+    PyObject* numpy;
+    PyObject* ndarray;
+
+    type = (JPy_JType*) Py_TYPE(obj);
+    if (!copy && type->componentType != NULL && type->componentType->isPrimitive) {
+        numpy = PyImport_ImportModule("numpy");
+        if (numpy == NULL) {
+            return NULL;
+        }
+        ndarray = PyObject_CallMethod(numpy, "asarray", "O", obj);
+        Py_DECREF(numpy);
+        return ndarray;
+    }
+
+    return JArray_CopyToNumPy(jenv, type, ((JPy_JObj*) obj)->objectRef);
+}
+
+/*
+ * Creates a new numpy.ndarray holding a copy of the given Java primitive array or rectangular Java array of
+ * primitive arrays of the given array type. Unlike JArray_ToNumPy(), no Java object wrapper is needed.
+ */
+PyObject* JArray_CopyToNumPy(JNIEnv* jenv, JPy_JType* type, jarray arrayRef)
+{
+    JPy_JType* itemType;
+    jarray rowRef;
+    jboolean nested;
+    char javaType;
+    jint itemSize;
+    const char* dtypeName;
+    jint rowCount;
+    jint colCount;
+    jint i;
+    PyObject* numpy;
+    PyObject* ndarray;
+    Py_buffer view;
+
+    if (type->componentType != NULL && type->componentType->isPrimitive) {
+        itemType = type->componentType;
+        nested = JNI_FALSE;
+    } else if (type->componentType != NULL && type->componentType->componentType != NULL && type->componentType->componentType->isPrimitive) {
+        itemType = type->componentType->componentType;
+        nested = JNI_TRUE;
+    } else {
+        PyErr_Format(PyExc_ValueError, "Java primitive array or array of primitive arrays expected, got '%s'", type->javaName);
+        return NULL;
+    }
+
+    if (JArray_GetPrimitiveInfo(itemType, &javaType, &itemSize, &dtypeName) < 0) {
+        return NULL;
+    }
+
+    numpy = PyImport_ImportModule("numpy");
+    if (numpy == NULL) {
+        return NULL;
+    }
+
+    rowCount = (*jenv)->GetArrayLength(jenv, arrayRef);
+    if (nested) {
+        colCount = 0;
+        if (rowCount > 0) {
+            rowRef = (*jenv)->GetObjectArrayElement(jenv, arrayRef, 0);
+            if (rowRef != NULL) {
+                colCount = (*jenv)->GetArrayLength(jenv, rowRef);
+                (*jenv)->DeleteLocalRef(jenv, rowRef);
+            }
+        }
+        ndarray = PyObject_CallMethod(numpy, "empty", "(ii)s", rowCount, colCount, dtypeName);
+    } else {
+        colCount = rowCount;
+        ndarray = PyObject_CallMethod(numpy, "empty", "(i)s", rowCount, dtypeName);
+    }
+    Py_DECREF(numpy);
+    if (ndarray == NULL) {
+        return NULL;
+    }
+
+    if (PyObject_GetBuffer(ndarray, &view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0) {
+        Py_DECREF(ndarray);
+        return NULL;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JArray_CopyToNumPy: type='%s', rowCount=%d, colCount=%d, nested=%d\n", type->javaName, rowCount, colCount, nested);
+
+    if (nested) {
+        for (i = 0; i < rowCount; i++) {
+            rowRef = (*jenv)->GetObjectArrayElement(jenv, arrayRef, i);
+            if (rowRef == NULL || (*jenv)->GetArrayLength(jenv, rowRef) != colCount) {
+                if (rowRef != NULL) {
+                    (*jenv)->DeleteLocalRef(jenv, rowRef);
+                }
+                PyErr_Format(PyExc_ValueError, "Java array must be rectangular, but row %d is null or has a length other than %d", i, colCount);
+                goto error;
+            }
+            JArray_GetRegion(jenv, javaType, rowRef, colCount, (char*) view.buf + (Py_ssize_t) i * colCount * itemSize);
+            (*jenv)->DeleteLocalRef(jenv, rowRef);
+            JPy_ON_JAVA_EXCEPTION_GOTO(error);
+        }
+    } else {
+        JArray_GetRegion(jenv, javaType, arrayRef, rowCount, view.buf);
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+    }
+
+    PyBuffer_Release(&view);
+    return ndarray;
+
+error:
+    PyBuffer_Release(&view);
+    Py_DECREF(ndarray);
+    return NULL;
+}
+
+/*
+ * Creates a new Python bytes object from the given Java byte array using a single bulk region copy.
+ */
+PyObject* JArray_ToBytes(JNIEnv* jenv, jbyteArray arrayRef)
+{
+    jint length;
+    PyObject* pyBytes;
+
+    length = (*jenv)->GetArrayLength(jenv, arrayRef);
+    pyBytes = PyBytes_FromStringAndSize(NULL, length);
+    if (pyBytes == NULL) {
+        return NULL;
+    }
+    (*jenv)->GetByteArrayRegion(jenv, arrayRef, 0, length, (jbyte*) PyBytes_AS_STRING(pyBytes));
+    JPy_ON_JAVA_EXCEPTION_GOTO(error);
+    return pyBytes;
+
+error:
+    Py_DECREF(pyBytes);
+    return NULL;
+}
+
+/*
+ * Converts the index-th item of a buffer of the given primitive type into a Python object.
+ */
+static PyObject* JArray_ItemToPython(char javaType, const void* buf, jint index)
+{
+    if (javaType == 'Z') {
+        return JPy_FROM_JBOOLEAN(((const jboolean*) buf)[index]);
+    } else if (javaType == 'C') {
+        return JPy_FROM_JCHAR(((const jchar*) buf)[index]);
+    } else if (javaType == 'B') {
+        return JPy_FROM_JBYTE(((const jbyte*) buf)[index]);
+    } else if (javaType == 'S') {
+        return JPy_FROM_JSHORT(((const jshort*) buf)[index]);
+    } else if (javaType == 'I') {
+        return JPy_FROM_JINT(((const jint*) buf)[index]);
+    } else if (javaType == 'J') {
+        return JPy_FROM_JLONG(((const jlong*) buf)[index]);
+    } else if (javaType == 'F') {
+        return JPy_FROM_JFLOAT(((const jfloat*) buf)[index]);
+    } else {
+        return JPy_FROM_JDOUBLE(((const jdouble*) buf)[index]);
+    }
+}
+
+/*
+ * Creates a new Python list from the items of the given Java array of the given array type.
+ * Primitive items are fetched with a single bulk region copy, strings are decoded using a single scratch buffer
+ * and all other items are converted according to the array's component type.
+ */
+PyObject* JArray_ToList(JNIEnv* jenv, JPy_JType* type, jarray arrayRef)
+{
+    JPy_JType* componentType;
+    char javaType;
+    jint itemSize;
+    const char* dtypeName;
+    jint length;
+    jint i;
+    void* buf;
+    jobject itemRef;
+    PyObject* pyList;
+    PyObject* pyItem;
+
+    componentType = type->componentType;
+    if (componentType == JPy_JString) {
+        return JPy_FromJStringArray(jenv, arrayRef);
+    }
+
+    length = (*jenv)->GetArrayLength(jenv, arrayRef);
+    pyList = PyList_New(length);
+    if (pyList == NULL) {
+        return NULL;
+    }
+
+    if (componentType->isPrimitive) {
+        if (JArray_GetPrimitiveInfo(componentType, &javaType, &itemSize, &dtypeName) < 0) {
+            goto error;
+        }
+        buf = PyMem_Malloc(length > 0 ? (size_t) length * itemSize : 1);
+        if (buf == NULL) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        JArray_GetRegion(jenv, javaType, arrayRef, length, buf);
+        if ((*jenv)->ExceptionCheck(jenv)) {
+            PyMem_Free(buf);
+            JPy_HandleJavaException(jenv);
+            goto error;
+        }
+        for (i = 0; i < length; i++) {
+            pyItem = JArray_ItemToPython(javaType, buf, i);
+            if (pyItem == NULL) {
+                PyMem_Free(buf);
+                goto error;
+            }
+            PyList_SET_ITEM(pyList, i, pyItem);
+        }
+        PyMem_Free(buf);
+    } else {
+        for (i = 0; i < length; i++) {
+            itemRef = (*jenv)->GetObjectArrayElement(jenv, arrayRef, i);
+            JPy_ON_JAVA_EXCEPTION_GOTO(error);
+            pyItem = JPy_FromJObjectWithType(jenv, itemRef, componentType);
+            if (itemRef != NULL) {
+                (*jenv)->DeleteLocalRef(jenv, itemRef);
+            }
+            if (pyItem == NULL) {
+                goto error;
+            }
+            PyList_SET_ITEM(pyList, i, pyItem);
+        }
+    }
+    return pyList;
+
+error:
+    Py_DECREF(pyList);
+    return NULL;
+}
+
+/*
+ * Creates a new Java primitive array from a one-dimensional, or a Java array of primitive arrays
+ * from a two-dimensional, C-contiguous Python buffer such as a numpy.ndarray.
+ */
+PyObject* JArray_FromBuffer(JNIEnv* jenv, PyObject* pyObj, JPy_JType* componentType)
+{
+    char javaType;
+    jint itemSize;
+    const char* dtypeName;
+    Py_buffer view;
+    Py_ssize_t rowCount;
+    Py_ssize_t colCount;
+    Py_ssize_t i;
+    char rowClassName[3];
+    jclass rowClassRef;
+    jarray rowRef;
+    jarray arrayRef;
+    PyObject* result;
+
+    if (JArray_GetPrimitiveInfo(componentType, &javaType, &itemSize, &dtypeName) < 0) {
+        return NULL;
+    }
+
+    if (PyObject_GetBuffer(pyObj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) < 0) {
+        return NULL;
+    }
+
+    if (!JArray_IsCompatibleBuffer(&view, javaType, itemSize)) {
+        PyErr_Format(PyExc_ValueError, "buffer of format '%s' and item size %d is not compatible with Java type '%s'",
+                     view.format != NULL ? view.format : "B", (int) view.itemsize, componentType->javaName);
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    if (view.ndim != 1 && view.ndim != 2) {
+        PyErr_Format(PyExc_ValueError, "buffer must be 1- or 2-dimensional, but has %d dimension(s)", view.ndim);
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    rowCount = view.shape[0];
+    colCount = view.ndim == 2 ? view.shape[1] : 0;
+    if (rowCount > 0x7fffffff || colCount > 0x7fffffff) {
+        PyErr_SetString(PyExc_ValueError, "buffer is too large to be converted into a Java array");
+        PyBuffer_Release(&view);
+        return NULL;
+    }
+
+    arrayRef = NULL;
+    if (view.ndim == 1) {
+        arrayRef = JArray_NewPrimitiveArray(jenv, javaType, (jint) rowCount);
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+        if (arrayRef == NULL) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        JArray_SetRegion(jenv, javaType, arrayRef, (jint) rowCount, view.buf);
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+    } else {
+        rowClassName[0] = '[';
+        rowClassName[1] = javaType;
+        rowClassName[2] = 0;
+        rowClassRef = (*jenv)->FindClass(jenv, rowClassName);
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+        arrayRef = (*jenv)->NewObjectArray(jenv, (jint) rowCount, rowClassRef, NULL);
+        (*jenv)->DeleteLocalRef(jenv, rowClassRef);
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+        if (arrayRef == NULL) {
+            PyErr_NoMemory();
+            goto error;
+        }
+        for (i = 0; i < rowCount; i++) {
+            rowRef = JArray_NewPrimitiveArray(jenv, javaType, (jint) colCount);
+            JPy_ON_JAVA_EXCEPTION_GOTO(error);
+            if (rowRef == NULL) {
+                PyErr_NoMemory();
+                goto error;
+            }
+            JArray_SetRegion(jenv, javaType, rowRef, (jint) colCount, (const char*) view.buf + i * colCount * itemSize);
+            if (!(*jenv)->ExceptionCheck(jenv)) {
+                (*jenv)->SetObjectArrayElement(jenv, arrayRef, (jint) i, rowRef);
+            }
+            (*jenv)->DeleteLocalRef(jenv, rowRef);
+            JPy_ON_JAVA_EXCEPTION_GOTO(error);
+        }
+    }
+
+    PyBuffer_Release(&view);
+
+    result = (PyObject*) JObj_New(jenv, arrayRef);
+    (*jenv)->DeleteLocalRef(jenv, arrayRef);
+    return result;
+
+error:
+    if (arrayRef != NULL) {
+        (*jenv)->DeleteLocalRef(jenv, arrayRef);
+    }
+    PyBuffer_Release(&view);
+    return NULL;
+}
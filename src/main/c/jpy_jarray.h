@@ -26,15 +26,19 @@ extern "C" {
 /**
  * The Java primitive array representation in Python.
  *
- * IMPORTANT: JPy_JArray must only differ from the JPy_JObj structure by the 'bufferExportCount' member
- * since we use the same basic type, name JPy_JType for it. DON'T ever change member positions!
+ * IMPORTANT: JPy_JArray must only differ from the JPy_JObj structure by the 'bufferExportCount' and 'bufferShape'
+ * members since we use the same basic type, name JPy_JType for it. DON'T ever change member positions!
  * @see JPy_JObj
  */
 typedef struct JPy_JArray
 {
     PyObject_HEAD
     jobject objectRef;
+    PyObject* weakrefs;
+    // The number of buffers currently exported, changed with JPy_ATOMIC_ADD()
     jint bufferExportCount;
+    // The shape of all buffers exported by this array (Java array lengths never change)
+    Py_ssize_t bufferShape;
 }
 JPy_JArray;
 
@@ -46,6 +50,22 @@ extern PyBufferProcs JArray_as_buffer_int;
 extern PyBufferProcs JArray_as_buffer_long;
 extern PyBufferProcs JArray_as_buffer_float;
 extern PyBufferProcs JArray_as_buffer_double;
+extern PyBufferProcs JArray_as_nd_buffer;
+
+int JArray_GetPrimitiveInfo(struct JPy_JType* type, char* javaType, jint* itemSize, const char** dtypeName);
+jarray JArray_NewPrimitiveArray(JNIEnv* jenv, char javaType, jint length);
+void JArray_GetRegion(JNIEnv* jenv, char javaType, jarray arrayRef, jint length, void* buf);
+void JArray_SetRegion(JNIEnv* jenv, char javaType, jarray arrayRef, jint length, const void* buf);
+int JArray_IsCompatibleBuffer(Py_buffer* view, char javaType, jint itemSize);
+void JArray_StoreJValue(char javaType, void* buf, Py_ssize_t index, const jvalue* value);
+char JArray_GetBufferItemCode(Py_buffer* view);
+void JArray_LoadJValue(char itemCode, const void* item, char javaType, jvalue* value);
+
+PyObject* JArray_ToNumPy(JNIEnv* jenv, PyObject* obj, jboolean copy);
+PyObject* JArray_CopyToNumPy(JNIEnv* jenv, struct JPy_JType* type, jarray arrayRef);
+PyObject* JArray_ToBytes(JNIEnv* jenv, jbyteArray arrayRef);
+PyObject* JArray_ToList(JNIEnv* jenv, struct JPy_JType* type, jarray arrayRef);
+PyObject* JArray_FromBuffer(JNIEnv* jenv, PyObject* pyObj, struct JPy_JType* componentType);
 
 #ifdef __cplusplus
 }  /* extern "C" */
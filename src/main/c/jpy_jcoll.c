@@ -0,0 +1,863 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jpy_module.h"
+#include "jpy_diag.h"
+#include "jpy_jtype.h"
+#include "jpy_jobj.h"
+#include "jpy_conv.h"
+#include "jpy_jcoll.h"
+
+/*
+ * Java collections implement the Python protocols of their Python counterparts, so that they can be used without
+ * copying them: a java.util.List supports len(), indexing, item assignment and deletion, 'in' and iteration like
+ * a list, a java.util.Map supports len(), item access, assignment and deletion, 'in' and iteration over its keys
+ * like a dict, and any other java.util.Collection supports len(), 'in' and iteration.
+ *
+ * Iteration converts the items of a single toArray() call instead of calling Iterator.hasNext() and next()
+ * for every item. Items are converted as values of type java.lang.Object, i.e. boxed primitives and strings
+ * become Python numbers and strings.
+ */
+
+static jboolean JColl_IsInstance(JNIEnv* jenv, JPy_JType* type, jclass classRef)
+{
+    return classRef != NULL && (*jenv)->IsAssignableFrom(jenv, type->classRef, classRef);
+}
+
+/**
+ * Deletes the local reference created by JPy_AsJObject() for the given Python argument.
+ * Java object wrappers (JObj) hand out their global references, which must not be deleted.
+ */
+static void JColl_DeleteArgRef(JNIEnv* jenv, PyObject* pyArg, jobject objectRef)
+{
+    if (objectRef != NULL && !JObj_Check(pyArg)) {
+        (*jenv)->DeleteLocalRef(jenv, objectRef);
+    }
+}
+
+/**
+ * Converts the given item into a Python object and deletes the local reference of the item.
+ */
+static PyObject* JColl_FromJItem(JNIEnv* jenv, jobject itemRef)
+{
+    PyObject* pyItem;
+
+    pyItem = JPy_FromJObjectWithType(jenv, itemRef, JPy_JObject);
+    if (itemRef != NULL) {
+        (*jenv)->DeleteLocalRef(jenv, itemRef);
+    }
+    return pyItem;
+}
+
+/**
+ * Returns a new list of the converted items of the given Java object array and deletes the local reference
+ * of the array.
+ */
+static PyObject* JColl_ArrayToList(JNIEnv* jenv, jobjectArray arrayRef)
+{
+    JPy_JCharBuffer strings;
+    PyObject* pyList;
+    PyObject* pyItem;
+    jobject itemRef;
+    jsize length;
+    jsize index;
+
+    length = (*jenv)->GetArrayLength(jenv, arrayRef);
+    pyList = PyList_New(length);
+    if (pyList == NULL) {
+        (*jenv)->DeleteLocalRef(jenv, arrayRef);
+        return NULL;
+    }
+    JPy_InitJCharBuffer(&strings);
+    for (index = 0; index < length; index++) {
+        itemRef = (*jenv)->GetObjectArrayElement(jenv, arrayRef, index);
+        if (itemRef != NULL && (*jenv)->IsInstanceOf(jenv, itemRef, JPy_String_JClass)) {
+            // Strings are converted without looking up their type, using a single scratch buffer
+            pyItem = JPy_FromJStringBuffered(jenv, itemRef, &strings);
+            (*jenv)->DeleteLocalRef(jenv, itemRef);
+        } else {
+            pyItem = JColl_FromJItem(jenv, itemRef);
+        }
+        if (pyItem == NULL) {
+            JPy_FreeJCharBuffer(&strings);
+            (*jenv)->DeleteLocalRef(jenv, arrayRef);
+            Py_DECREF(pyList);
+            return NULL;
+        }
+        PyList_SET_ITEM(pyList, index, pyItem);
+    }
+    JPy_FreeJCharBuffer(&strings);
+    (*jenv)->DeleteLocalRef(jenv, arrayRef);
+    return pyList;
+}
+
+/**
+ * Returns an iterator over the converted items of the given Java object array and deletes the local reference
+ * of the array.
+ */
+static PyObject* JColl_IterArray(JNIEnv* jenv, jobjectArray arrayRef)
+{
+    PyObject* pyList;
+    PyObject* pyIter;
+
+    pyList = JColl_ArrayToList(jenv, arrayRef);
+    if (pyList == NULL) {
+        return NULL;
+    }
+    pyIter = PyObject_GetIter(pyList);
+    Py_DECREF(pyList);
+    return pyIter;
+}
+
+/**
+ * Checks the given index against the size of the given Java list. Returns -1 and raises an IndexError if it is
+ * out of range (sq_item is called with negative indexes already adjusted).
+ */
+static int JColl_CheckIndex(JNIEnv* jenv, JPy_JObj* self, Py_ssize_t index)
+{
+    jint size;
+
+    size = (*jenv)->CallIntMethod(jenv, self->objectRef, JPy_Collection_Size_MID);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    if (index < 0 || index >= size) {
+        PyErr_SetString(PyExc_IndexError, "Java list index out of range");
+        return -1;
+    }
+    return 0;
+}
+
+
+/*
+ * The sq_length slot of java.util.Collection types.
+ */
+static Py_ssize_t JColl_Collection_sq_length(JPy_JObj* self)
+{
+    JNIEnv* jenv;
+    jint size;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+
+    size = (*jenv)->CallIntMethod(jenv, self->objectRef, JPy_Collection_Size_MID);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return size;
+}
+
+/*
+ * The sq_contains slot of java.util.Collection types. Called if 'item in obj' is used.
+ */
+static int JColl_Collection_sq_contains(JPy_JObj* self, PyObject* pyItem)
+{
+    JNIEnv* jenv;
+    jobject itemRef;
+    jboolean found;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+
+    if (JPy_AsJObject(jenv, pyItem, &itemRef) < 0) {
+        // A Python object which has no Java equivalent can't be an item of a Java collection
+        PyErr_Clear();
+        return 0;
+    }
+    found = (*jenv)->CallBooleanMethod(jenv, self->objectRef, JPy_Collection_Contains_MID, itemRef);
+    JColl_DeleteArgRef(jenv, pyItem, itemRef);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return found ? 1 : 0;
+}
+
+/*
+ * The tp_iter slot of java.util.Collection types.
+ */
+static PyObject* JColl_Collection_iter(JPy_JObj* self)
+{
+    JNIEnv* jenv;
+    jobjectArray arrayRef;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    arrayRef = (*jenv)->CallObjectMethod(jenv, self->objectRef, JPy_Collection_ToArray_MID);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    return JColl_IterArray(jenv, arrayRef);
+}
+
+/*
+ * The sq_item slot of java.util.List types. Called if 'item = obj[index]' is used.
+ */
+static PyObject* JColl_List_sq_item(JPy_JObj* self, Py_ssize_t index)
+{
+    JNIEnv* jenv;
+    jobject itemRef;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    if (JColl_CheckIndex(jenv, self, index) < 0) {
+        return NULL;
+    }
+    itemRef = (*jenv)->CallObjectMethod(jenv, self->objectRef, JPy_List_Get_MID, (jint) index);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    return JColl_FromJItem(jenv, itemRef);
+}
+
+/*
+ * The sq_ass_item slot of java.util.List types. Called if 'obj[index] = item' or 'del obj[index]' is used.
+ */
+static int JColl_List_sq_ass_item(JPy_JObj* self, Py_ssize_t index, PyObject* pyItem)
+{
+    JNIEnv* jenv;
+    jobject itemRef;
+    jobject oldItemRef;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+
+    if (JColl_CheckIndex(jenv, self, index) < 0) {
+        return -1;
+    }
+    if (pyItem == NULL) {
+        oldItemRef = (*jenv)->CallObjectMethod(jenv, self->objectRef, JPy_List_Remove_MID, (jint) index);
+    } else {
+        if (JPy_AsJObject(jenv, pyItem, &itemRef) < 0) {
+            return -1;
+        }
+        oldItemRef = (*jenv)->CallObjectMethod(jenv, self->objectRef, JPy_List_Set_MID, (jint) index, itemRef);
+        JColl_DeleteArgRef(jenv, pyItem, itemRef);
+    }
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    if (oldItemRef != NULL) {
+        (*jenv)->DeleteLocalRef(jenv, oldItemRef);
+    }
+    return 0;
+}
+
+/*
+ * The mp_length slot of java.util.Map types.
+ */
+static Py_ssize_t JColl_Map_mp_length(JPy_JObj* self)
+{
+    JNIEnv* jenv;
+    jint size;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+
+    size = (*jenv)->CallIntMethod(jenv, self->objectRef, JPy_Map_Size_MID);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return size;
+}
+
+/*
+ * The mp_subscript slot of java.util.Map types. Called if 'value = obj[key]' is used.
+ */
+static PyObject* JColl_Map_mp_subscript(JPy_JObj* self, PyObject* pyKey)
+{
+    JNIEnv* jenv;
+    jobject keyRef;
+    jobject valueRef;
+    jboolean found;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    if (JPy_AsJObject(jenv, pyKey, &keyRef) < 0) {
+        return NULL;
+    }
+    valueRef = (*jenv)->CallObjectMethod(jenv, self->objectRef, JPy_Map_Get_MID, keyRef);
+    JPy_ON_JAVA_EXCEPTION_GOTO(error);
+    if (valueRef == NULL) {
+        // Map.get() also returns null for missing keys
+        found = (*jenv)->CallBooleanMethod(jenv, self->objectRef, JPy_Map_ContainsKey_MID, keyRef);
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+        if (!found) {
+            PyErr_SetObject(PyExc_KeyError, pyKey);
+            goto error;
+        }
+    }
+    JColl_DeleteArgRef(jenv, pyKey, keyRef);
+    return JColl_FromJItem(jenv, valueRef);
+
+error:
+    JColl_DeleteArgRef(jenv, pyKey, keyRef);
+    return NULL;
+}
+
+/*
+ * The mp_ass_subscript slot of java.util.Map types. Called if 'obj[key] = value' or 'del obj[key]' is used.
+ */
+static int JColl_Map_mp_ass_subscript(JPy_JObj* self, PyObject* pyKey, PyObject* pyValue)
+{
+    JNIEnv* jenv;
+    jobject keyRef;
+    jobject valueRef;
+    jobject oldValueRef;
+    jboolean found;
+    int result;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+
+    if (JPy_AsJObject(jenv, pyKey, &keyRef) < 0) {
+        return -1;
+    }
+    result = -1;
+    if (pyValue == NULL) {
+        found = (*jenv)->CallBooleanMethod(jenv, self->objectRef, JPy_Map_ContainsKey_MID, keyRef);
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+        if (!found) {
+            PyErr_SetObject(PyExc_KeyError, pyKey);
+            goto error;
+        }
+        oldValueRef = (*jenv)->CallObjectMethod(jenv, self->objectRef, JPy_Map_Remove_MID, keyRef);
+    } else {
+        if (JPy_AsJObject(jenv, pyValue, &valueRef) < 0) {
+            goto error;
+        }
+        oldValueRef = (*jenv)->CallObjectMethod(jenv, self->objectRef, JPy_Map_Put_MID, keyRef, valueRef);
+        JColl_DeleteArgRef(jenv, pyValue, valueRef);
+    }
+    JPy_ON_JAVA_EXCEPTION_GOTO(error);
+    if (oldValueRef != NULL) {
+        (*jenv)->DeleteLocalRef(jenv, oldValueRef);
+    }
+    result = 0;
+
+error:
+    JColl_DeleteArgRef(jenv, pyKey, keyRef);
+    return result;
+}
+
+/*
+ * The sq_contains slot of java.util.Map types. Called if 'key in obj' is used.
+ */
+static int JColl_Map_sq_contains(JPy_JObj* self, PyObject* pyKey)
+{
+    JNIEnv* jenv;
+    jobject keyRef;
+    jboolean found;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+
+    if (JPy_AsJObject(jenv, pyKey, &keyRef) < 0) {
+        // A Python object which has no Java equivalent can't be a key of a Java map
+        PyErr_Clear();
+        return 0;
+    }
+    found = (*jenv)->CallBooleanMethod(jenv, self->objectRef, JPy_Map_ContainsKey_MID, keyRef);
+    JColl_DeleteArgRef(jenv, pyKey, keyRef);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return found ? 1 : 0;
+}
+
+/*
+ * The tp_iter slot of java.util.Map types, iterates over the keys.
+ */
+static PyObject* JColl_Map_iter(JPy_JObj* self)
+{
+    JNIEnv* jenv;
+    jobject keySetRef;
+    jobjectArray arrayRef;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    keySetRef = (*jenv)->CallObjectMethod(jenv, self->objectRef, JPy_Map_KeySet_MID);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    arrayRef = (*jenv)->CallObjectMethod(jenv, keySetRef, JPy_Collection_ToArray_MID);
+    (*jenv)->DeleteLocalRef(jenv, keySetRef);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    return JColl_IterArray(jenv, arrayRef);
+}
+
+
+/*
+ * The tp_as_sequence slot of java.util.List types.
+ */
+static PySequenceMethods JColl_List_as_sequence = {
+    (lenfunc) JColl_Collection_sq_length,      /* sq_length */
+    NULL,   /* sq_concat */
+    NULL,   /* sq_repeat */
+    (ssizeargfunc) JColl_List_sq_item,         /* sq_item */
+    NULL,   /* was_sq_slice */
+    (ssizeobjargproc) JColl_List_sq_ass_item,  /* sq_ass_item */
+    NULL,   /* was_sq_ass_slice */
+    (objobjproc) JColl_Collection_sq_contains, /* sq_contains */
+    NULL,   /* sq_inplace_concat */
+    NULL,   /* sq_inplace_repeat */
+};
+
+/*
+ * The tp_as_sequence slot of all other java.util.Collection types.
+ */
+static PySequenceMethods JColl_Collection_as_sequence = {
+    (lenfunc) JColl_Collection_sq_length,      /* sq_length */
+    NULL,   /* sq_concat */
+    NULL,   /* sq_repeat */
+    NULL,   /* sq_item */
+    NULL,   /* was_sq_slice */
+    NULL,   /* sq_ass_item */
+    NULL,   /* was_sq_ass_slice */
+    (objobjproc) JColl_Collection_sq_contains, /* sq_contains */
+    NULL,   /* sq_inplace_concat */
+    NULL,   /* sq_inplace_repeat */
+};
+
+/*
+ * The tp_as_sequence slot of java.util.Map types, only used for 'key in obj'.
+ */
+static PySequenceMethods JColl_Map_as_sequence = {
+    NULL,   /* sq_length */
+    NULL,   /* sq_concat */
+    NULL,   /* sq_repeat */
+    NULL,   /* sq_item */
+    NULL,   /* was_sq_slice */
+    NULL,   /* sq_ass_item */
+    NULL,   /* was_sq_ass_slice */
+    (objobjproc) JColl_Map_sq_contains,        /* sq_contains */
+    NULL,   /* sq_inplace_concat */
+    NULL,   /* sq_inplace_repeat */
+};
+
+/*
+ * The tp_as_mapping slot of java.util.Map types.
+ */
+static PyMappingMethods JColl_Map_as_mapping = {
+    (lenfunc) JColl_Map_mp_length,                  /* mp_length */
+    (binaryfunc) JColl_Map_mp_subscript,            /* mp_subscript */
+    (objobjargproc) JColl_Map_mp_ass_subscript,     /* mp_ass_subscript */
+};
+
+
+void JColl_InitSlots(JNIEnv* jenv, JPy_JType* type)
+{
+    PyTypeObject* typeObj;
+
+    typeObj = (PyTypeObject*) type;
+    if (JColl_IsInstance(jenv, type, JPy_List_JClass)) {
+        typeObj->tp_as_sequence = &JColl_List_as_sequence;
+        typeObj->tp_iter = (getiterfunc) JColl_Collection_iter;
+    } else if (JColl_IsInstance(jenv, type, JPy_Collection_JClass)) {
+        typeObj->tp_as_sequence = &JColl_Collection_as_sequence;
+        typeObj->tp_iter = (getiterfunc) JColl_Collection_iter;
+    } else if (JColl_IsInstance(jenv, type, JPy_Map_JClass)) {
+        typeObj->tp_as_sequence = &JColl_Map_as_sequence;
+        typeObj->tp_as_mapping = &JColl_Map_as_mapping;
+        typeObj->tp_iter = (getiterfunc) JColl_Map_iter;
+    }
+}
+
+void JColl_RegisterAbc(JNIEnv* jenv, JPy_JType* type)
+{
+    const char* abcName;
+    PyObject* abcModule;
+    PyObject* abc;
+    PyObject* result;
+
+    if (JColl_IsInstance(jenv, type, JPy_List_JClass)) {
+        abcName = "Sequence";
+    } else if (JColl_IsInstance(jenv, type, JPy_Map_JClass)) {
+        abcName = "Mapping";
+    } else {
+        return;
+    }
+
+#if defined(JPY_COMPAT_27)
+    abcModule = PyImport_ImportModule("collections");
+#else
+    abcModule = PyImport_ImportModule("collections.abc");
+#endif
+    if (abcModule == NULL) {
+        PyErr_Clear();
+        return;
+    }
+    abc = PyObject_GetAttrString(abcModule, abcName);
+    Py_DECREF(abcModule);
+    if (abc == NULL) {
+        PyErr_Clear();
+        return;
+    }
+    result = PyObject_CallMethod(abc, "register", "O", (PyObject*) type);
+    Py_DECREF(abc);
+    if (result == NULL) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JColl_RegisterAbc: failed to register type '%s' as %s\n", type->javaName, abcName);
+        PyErr_Clear();
+        return;
+    }
+    Py_DECREF(result);
+}
+
+
+/*
+ * The bulk conversion of Python sequences and mappings into new java.util.ArrayList and java.util.HashMap objects.
+ * The converters of the item, key and value types are looked up once, not once per item.
+ */
+
+#define JColl_MAX_SIZE ((Py_ssize_t) 0x7FFFFFFF)
+
+typedef struct
+{
+    JPy_JType* type;
+    JType_PythonToJavaConverter convert;
+    // The class of which Java object items must be instances, the boxed class if type is a primitive type
+    jclass classRef;
+    // The scratch buffer used for all items, if type is java.lang.String
+    JPy_JCharBuffer strings;
+}
+JColl_Converter;
+
+static JPy_JType* JColl_GetBoxedType(JPy_JType* type)
+{
+    if (!type->isPrimitive) {
+        return type;
+    } else if (type == JPy_JBoolean) {
+        return JPy_JBooleanObj;
+    } else if (type == JPy_JChar) {
+        return JPy_JCharacterObj;
+    } else if (type == JPy_JByte) {
+        return JPy_JByteObj;
+    } else if (type == JPy_JShort) {
+        return JPy_JShortObj;
+    } else if (type == JPy_JInt) {
+        return JPy_JIntegerObj;
+    } else if (type == JPy_JLong) {
+        return JPy_JLongObj;
+    } else if (type == JPy_JFloat) {
+        return JPy_JFloatObj;
+    } else if (type == JPy_JDouble) {
+        return JPy_JDoubleObj;
+    }
+    return type;
+}
+
+static void JColl_InitConverter(JColl_Converter* converter, JPy_JType* type)
+{
+    converter->type = type;
+    converter->convert = JType_GetPythonToJavaConverter(type);
+    converter->classRef = JColl_GetBoxedType(type)->classRef;
+    JPy_InitJCharBuffer(&converter->strings);
+}
+
+static void JColl_FreeConverter(JColl_Converter* converter)
+{
+    JPy_FreeJCharBuffer(&converter->strings);
+}
+
+/**
+ * Converts the given item. The local reference must be released using JColl_DeleteArgRef().
+ */
+static int JColl_ConvertItem(JNIEnv* jenv, JColl_Converter* converter, PyObject* pyItem, jobject* objectRef)
+{
+    if (pyItem == Py_None) {
+        *objectRef = NULL;
+        return 0;
+    } else if (JObj_Check(pyItem)) {
+        *objectRef = ((JPy_JObj*) pyItem)->objectRef;
+        if (converter->type != JPy_JObject && !(*jenv)->IsInstanceOf(jenv, *objectRef, converter->classRef)) {
+            *objectRef = NULL;
+            return JType_PythonToJavaConversionError(converter->type, pyItem);
+        }
+        return 0;
+    } else if (converter->type == JPy_JString && JPy_IS_STR(pyItem)) {
+        return JPy_AsJStringBuffered(jenv, pyItem, &converter->strings, objectRef);
+    }
+    return converter->convert(jenv, converter->type, pyItem, objectRef);
+}
+
+/**
+ * Converts the items of the given list or tuple (see PySequence_Fast()) into a new java.lang.Object[] array.
+ */
+static int JColl_ConvertItems(JNIEnv* jenv, JColl_Converter* converter, PyObject* pySeq, jobjectArray* arrayRef)
+{
+    PyObject* pyItem;
+    jobject itemRef;
+    Py_ssize_t count;
+    Py_ssize_t index;
+    int result;
+
+    count = PySequence_Fast_GET_SIZE(pySeq);
+
+    if (count > JColl_MAX_SIZE) {
+        PyErr_SetString(PyExc_OverflowError, "jpy: sequence too long for a Java array");
+        return -1;
+    }
+
+    *arrayRef = (*jenv)->NewObjectArray(jenv, (jsize) count, JPy_Object_JClass, NULL);
+    if (*arrayRef == NULL || (*jenv)->ExceptionCheck(jenv)) {
+        JPy_HandleJavaException(jenv);
+        return -1;
+    }
+
+    result = 0;
+    for (index = 0; result == 0 && index < count; index++) {
+        // Converters may run Python code which modifies a list, so the size is checked and the item is held
+        // for every item, like JColl_PutDictEntries() does
+        if (PySequence_Fast_GET_SIZE(pySeq) != count) {
+            PyErr_SetString(PyExc_RuntimeError, "jpy: sequence changed size during conversion");
+            result = -1;
+            break;
+        }
+        pyItem = PySequence_Fast_GET_ITEM(pySeq, index);
+        Py_INCREF(pyItem);
+        result = JColl_ConvertItem(jenv, converter, pyItem, &itemRef);
+        if (result == 0) {
+            (*jenv)->SetObjectArrayElement(jenv, *arrayRef, (jsize) index, itemRef);
+            JColl_DeleteArgRef(jenv, pyItem, itemRef);
+            if ((*jenv)->ExceptionCheck(jenv)) {
+                JPy_HandleJavaException(jenv);
+                result = -1;
+            }
+        }
+        Py_DECREF(pyItem);
+    }
+    if (result < 0) {
+        (*jenv)->DeleteLocalRef(jenv, *arrayRef);
+    }
+    return result;
+}
+
+int JColl_ToJavaList(JNIEnv* jenv, PyObject* pyArg, JPy_JType* itemType, jobject* objectRef)
+{
+    JColl_Converter converter;
+    PyObject* pySeq;
+    jobjectArray arrayRef;
+    jobject listRef;
+    int result;
+
+    JColl_InitConverter(&converter, itemType);
+
+    // Note: lists and tuples are used as they are, other iterables are copied into a list
+    pySeq = PySequence_Fast(pyArg, "jpy: a sequence or iterable is required");
+    if (pySeq == NULL) {
+        return -1;
+    }
+    JPy_BEGIN_CRITICAL_SECTION(pySeq);
+    result = JColl_ConvertItems(jenv, &converter, pySeq, &arrayRef);
+    JPy_END_CRITICAL_SECTION();
+    Py_DECREF(pySeq);
+    JColl_FreeConverter(&converter);
+    if (result < 0) {
+        return -1;
+    }
+
+    // new ArrayList(Arrays.asList(array)) copies the array once, instead of calling add() for every item
+    *objectRef = NULL;
+    listRef = (*jenv)->CallStaticObjectMethod(jenv, JPy_Arrays_JClass, JPy_Arrays_AsList_MID, arrayRef);
+    if (listRef != NULL) {
+        *objectRef = (*jenv)->NewObject(jenv, JPy_ArrayList_JClass, JPy_ArrayList_Init_MID, listRef);
+        (*jenv)->DeleteLocalRef(jenv, listRef);
+    }
+    (*jenv)->DeleteLocalRef(jenv, arrayRef);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    if (*objectRef == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+static int JColl_PutEntry(JNIEnv* jenv, jobject mapRef,
+                          JColl_Converter* keyConverter, PyObject* pyKey,
+                          JColl_Converter* valueConverter, PyObject* pyValue)
+{
+    jobject keyRef;
+    jobject valueRef;
+    jobject oldValueRef;
+
+    if (JColl_ConvertItem(jenv, keyConverter, pyKey, &keyRef) < 0) {
+        return -1;
+    }
+    if (JColl_ConvertItem(jenv, valueConverter, pyValue, &valueRef) < 0) {
+        JColl_DeleteArgRef(jenv, pyKey, keyRef);
+        return -1;
+    }
+    oldValueRef = (*jenv)->CallObjectMethod(jenv, mapRef, JPy_Map_Put_MID, keyRef, valueRef);
+    JColl_DeleteArgRef(jenv, pyKey, keyRef);
+    JColl_DeleteArgRef(jenv, pyValue, valueRef);
+    if (oldValueRef != NULL) {
+        (*jenv)->DeleteLocalRef(jenv, oldValueRef);
+    }
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return 0;
+}
+
+static int JColl_PutDictEntries(JNIEnv* jenv, jobject mapRef, JColl_Converter* keyConverter, JColl_Converter* valueConverter, PyObject* pyDict)
+{
+    PyObject* pyKey;
+    PyObject* pyValue;
+    Py_ssize_t pos;
+    int result;
+
+    pos = 0;
+    result = 0;
+    while (result == 0 && PyDict_Next(pyDict, &pos, &pyKey, &pyValue)) {
+        // Creating Java objects may run Python code, e.g. finalizers, so hold on to the borrowed references
+        Py_INCREF(pyKey);
+        Py_INCREF(pyValue);
+        result = JColl_PutEntry(jenv, mapRef, keyConverter, pyKey, valueConverter, pyValue);
+        Py_DECREF(pyKey);
+        Py_DECREF(pyValue);
+    }
+    return result;
+}
+
+static int JColl_PutItemEntries(JNIEnv* jenv, jobject mapRef, JColl_Converter* keyConverter, JColl_Converter* valueConverter, PyObject* pyItems)
+{
+    PyObject* pyItem;
+    Py_ssize_t index;
+    int result;
+
+    result = 0;
+    for (index = 0; result == 0 && index < PySequence_Fast_GET_SIZE(pyItems); index++) {
+        pyItem = PySequence_Fast_GET_ITEM(pyItems, index);
+        if (!PyTuple_Check(pyItem) || PyTuple_GET_SIZE(pyItem) != 2) {
+            PyErr_SetString(PyExc_ValueError, "jpy: items() of a mapping must return (key, value) pairs");
+            return -1;
+        }
+        // The (key, value) pair keeps both alive, even if a converter modifies the list of items
+        Py_INCREF(pyItem);
+        result = JColl_PutEntry(jenv, mapRef, keyConverter, PyTuple_GET_ITEM(pyItem, 0), valueConverter, PyTuple_GET_ITEM(pyItem, 1));
+        Py_DECREF(pyItem);
+    }
+    return result;
+}
+
+int JColl_ToJavaMap(JNIEnv* jenv, PyObject* pyArg, JPy_JType* keyType, JPy_JType* valueType, jobject* objectRef)
+{
+    JColl_Converter keyConverter;
+    JColl_Converter valueConverter;
+    PyObject* pyItems;
+    PyObject* pyItemsSeq;
+    jobject mapRef;
+    Py_ssize_t size;
+    jint capacity;
+    int result;
+
+    pyItemsSeq = NULL;
+    if (PyDict_Check(pyArg)) {
+        size = PyDict_Size(pyArg);
+    } else {
+        pyItems = PyMapping_Items(pyArg);
+        if (pyItems == NULL) {
+            return -1;
+        }
+        pyItemsSeq = PySequence_Fast(pyItems, "jpy: items() of a mapping must return a sequence");
+        Py_DECREF(pyItems);
+        if (pyItemsSeq == NULL) {
+            return -1;
+        }
+        size = PySequence_Fast_GET_SIZE(pyItemsSeq);
+    }
+
+    // Pre-size the map for the default load factor 0.75, so that it is never rehashed
+    capacity = size < JColl_MAX_SIZE / 2 ? (jint) (size + size / 3 + 1) : (jint) JColl_MAX_SIZE;
+    mapRef = (*jenv)->NewObject(jenv, JPy_HashMap_JClass, JPy_HashMap_Init_MID, capacity);
+    if (mapRef == NULL || (*jenv)->ExceptionCheck(jenv)) {
+        JPy_HandleJavaException(jenv);
+        Py_XDECREF(pyItemsSeq);
+        return -1;
+    }
+
+    JColl_InitConverter(&keyConverter, keyType);
+    JColl_InitConverter(&valueConverter, valueType);
+    if (pyItemsSeq == NULL) {
+        JPy_BEGIN_CRITICAL_SECTION(pyArg);
+        result = JColl_PutDictEntries(jenv, mapRef, &keyConverter, &valueConverter, pyArg);
+        JPy_END_CRITICAL_SECTION();
+    } else {
+        result = JColl_PutItemEntries(jenv, mapRef, &keyConverter, &valueConverter, pyItemsSeq);
+        Py_DECREF(pyItemsSeq);
+    }
+    JColl_FreeConverter(&keyConverter);
+    JColl_FreeConverter(&valueConverter);
+    if (result < 0) {
+        (*jenv)->DeleteLocalRef(jenv, mapRef);
+        return -1;
+    }
+
+    *objectRef = mapRef;
+    return 0;
+}
+
+
+/*
+ * The bulk conversion of Java collections and maps into new Python lists and dicts, see JMethod.set_return_policy().
+ * Like iteration, both convert the items of a single toArray() snapshot.
+ */
+
+PyObject* JColl_ToPythonList(JNIEnv* jenv, jobject collectionRef)
+{
+    jobjectArray arrayRef;
+
+    arrayRef = (*jenv)->CallObjectMethod(jenv, collectionRef, JPy_Collection_ToArray_MID);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    return JColl_ArrayToList(jenv, arrayRef);
+}
+
+PyObject* JColl_ToPythonDict(JNIEnv* jenv, jobject mapRef)
+{
+    jobject entrySetRef;
+    jobjectArray arrayRef;
+    jobject entryRef;
+    jobject keyRef;
+    jobject valueRef;
+    jsize length;
+    jsize index;
+    PyObject* pyDict;
+    PyObject* pyKey;
+    PyObject* pyValue;
+    int status;
+
+    entrySetRef = (*jenv)->CallObjectMethod(jenv, mapRef, JPy_Map_EntrySet_MID);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    arrayRef = (*jenv)->CallObjectMethod(jenv, entrySetRef, JPy_Collection_ToArray_MID);
+    (*jenv)->DeleteLocalRef(jenv, entrySetRef);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+
+    pyDict = PyDict_New();
+    if (pyDict == NULL) {
+        (*jenv)->DeleteLocalRef(jenv, arrayRef);
+        return NULL;
+    }
+
+    length = (*jenv)->GetArrayLength(jenv, arrayRef);
+    for (index = 0; index < length; index++) {
+        entryRef = (*jenv)->GetObjectArrayElement(jenv, arrayRef, index);
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+        keyRef = (*jenv)->CallObjectMethod(jenv, entryRef, JPy_MapEntry_GetKey_MID);
+        valueRef = (*jenv)->ExceptionCheck(jenv) ? NULL : (*jenv)->CallObjectMethod(jenv, entryRef, JPy_MapEntry_GetValue_MID);
+        (*jenv)->DeleteLocalRef(jenv, entryRef);
+        if ((*jenv)->ExceptionCheck(jenv)) {
+            if (keyRef != NULL) {
+                (*jenv)->DeleteLocalRef(jenv, keyRef);
+            }
+            JPy_HandleJavaException(jenv);
+            goto error;
+        }
+        pyKey = JColl_FromJItem(jenv, keyRef);
+        if (pyKey == NULL) {
+            if (valueRef != NULL) {
+                (*jenv)->DeleteLocalRef(jenv, valueRef);
+            }
+            goto error;
+        }
+        pyValue = JColl_FromJItem(jenv, valueRef);
+        status = pyValue != NULL ? PyDict_SetItem(pyDict, pyKey, pyValue) : -1;
+        Py_DECREF(pyKey);
+        Py_XDECREF(pyValue);
+        if (status < 0) {
+            goto error;
+        }
+    }
+    (*jenv)->DeleteLocalRef(jenv, arrayRef);
+    return pyDict;
+
+error:
+    (*jenv)->DeleteLocalRef(jenv, arrayRef);
+    Py_DECREF(pyDict);
+    return NULL;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JPY_JCOLL_H
+#define JPY_JCOLL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jpy_compat.h"
+
+/**
+ * Assigns the <sequence>, <mapping> and iterator slots of types implementing java.util.Collection,
+ * java.util.List or java.util.Map. Called by JType_InitSlots() before PyType_Ready().
+ */
+void JColl_InitSlots(JNIEnv* jenv, JPy_JType* type);
+
+/**
+ * Registers types implementing java.util.List as collections.abc.Sequence and types implementing java.util.Map
+ * as collections.abc.Mapping. Called by JType_InitSlots() after PyType_Ready(). Errors are ignored.
+ */
+void JColl_RegisterAbc(JNIEnv* jenv, JPy_JType* type);
+
+/**
+ * Converts the items of the given Python sequence or iterable into the given type and stores them
+ * in a new java.util.ArrayList (a new local reference).
+ */
+int JColl_ToJavaList(JNIEnv* jenv, PyObject* pyArg, JPy_JType* itemType, jobject* objectRef);
+
+/**
+ * Converts the keys and values of the given Python mapping into the given types and stores them
+ * in a new java.util.HashMap (a new local reference).
+ */
+int JColl_ToJavaMap(JNIEnv* jenv, PyObject* pyArg, JPy_JType* keyType, JPy_JType* valueType, jobject* objectRef);
+
+/**
+ * Converts the items of the given java.util.Collection into Python objects and stores them in a new list.
+ */
+PyObject* JColl_ToPythonList(JNIEnv* jenv, jobject collectionRef);
+
+/**
+ * Converts the entries of the given java.util.Map into Python objects and stores them in a new dict.
+ */
+PyObject* JColl_ToPythonDict(JNIEnv* jenv, jobject mapRef);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+#endif /* !JPY_JCOLL_H */
@@ -18,14 +18,17 @@
 #include "jpy_diag.h"
 #include "jpy_jtype.h"
 #include "jpy_jobj.h"
+#include "jpy_jarray.h"
 #include "jpy_jfield.h"
 #include "jpy_conv.h"
 #include "jpy_compat.h"
 
 
+void JField_InitAccessors(JPy_JField* field);
+
 JPy_JField* JField_New(JPy_JType* declaringClass, PyObject* fieldName, JPy_JType* fieldType, jboolean isStatic, jboolean isFinal, jfieldID fid)
 {
-    PyTypeObject* type = &JField_Type;
+    PyTypeObject* type = JPy_GetModuleState()->jfieldType;
     JPy_JField* field;
 
     field = (JPy_JField*) type->tp_alloc(type, 0);
@@ -39,6 +42,8 @@ JPy_JField* JField_New(JPy_JType* declaringClass, PyObject* fieldName, JPy_JType
     Py_INCREF(field->name);
     Py_INCREF(field->type);
 
+    JField_InitAccessors(field);
+
     return field;
 }
 
@@ -49,7 +54,7 @@ void JField_dealloc(JPy_JField* self)
 {
     Py_DECREF(self->name);
     Py_DECREF(self->type);
-    Py_TYPE(self)->tp_free((PyObject*) self);
+    JPy_FREE_INSTANCE(self)
 }
 
 void JField_Del(JPy_JField* field)
@@ -82,6 +87,469 @@ PyObject* JField_str(JPy_JField* self)
 }
 
 
+/*
+ * Defines the getter and setter functions for instance and static fields of a primitive Java type.
+ */
+#define JPy_DEFINE_FIELD_ACCESSORS(JNI_NAME, JTYPE, FROM_JTYPE, AS_JTYPE) \
+PyObject* JField_Get##JNI_NAME##Field(JNIEnv* jenv, JPy_JField* field, jobject objectRef) \
+{ \
+    JTYPE item = (*jenv)->Get##JNI_NAME##Field(jenv, objectRef, field->fid); \
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL); \
+    return FROM_JTYPE(item); \
+} \
+PyObject* JField_GetStatic##JNI_NAME##Field(JNIEnv* jenv, JPy_JField* field, jobject objectRef) \
+{ \
+    JTYPE item = (*jenv)->GetStatic##JNI_NAME##Field(jenv, field->declaringClass->classRef, field->fid); \
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL); \
+    return FROM_JTYPE(item); \
+} \
+int JField_Set##JNI_NAME##Field(JNIEnv* jenv, JPy_JField* field, jobject objectRef, PyObject* value) \
+{ \
+    JTYPE item = AS_JTYPE(value); \
+    if (PyErr_Occurred()) { \
+        return -1; \
+    } \
+    (*jenv)->Set##JNI_NAME##Field(jenv, objectRef, field->fid, item); \
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1); \
+    return 0; \
+} \
+int JField_SetStatic##JNI_NAME##Field(JNIEnv* jenv, JPy_JField* field, jobject objectRef, PyObject* value) \
+{ \
+    JTYPE item = AS_JTYPE(value); \
+    if (PyErr_Occurred()) { \
+        return -1; \
+    } \
+    (*jenv)->SetStatic##JNI_NAME##Field(jenv, field->declaringClass->classRef, field->fid, item); \
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1); \
+    return 0; \
+}
+
+JPy_DEFINE_FIELD_ACCESSORS(Boolean, jboolean, JPy_FROM_JBOOLEAN, JPy_AS_JBOOLEAN)
+JPy_DEFINE_FIELD_ACCESSORS(Char, jchar, JPy_FROM_JCHAR, JPy_AS_JCHAR)
+JPy_DEFINE_FIELD_ACCESSORS(Byte, jbyte, JPy_FROM_JBYTE, JPy_AS_JBYTE)
+JPy_DEFINE_FIELD_ACCESSORS(Short, jshort, JPy_FROM_JSHORT, JPy_AS_JSHORT)
+JPy_DEFINE_FIELD_ACCESSORS(Int, jint, JPy_FROM_JINT, JPy_AS_JINT)
+JPy_DEFINE_FIELD_ACCESSORS(Long, jlong, JPy_FROM_JLONG, JPy_AS_JLONG)
+JPy_DEFINE_FIELD_ACCESSORS(Float, jfloat, JPy_FROM_JFLOAT, JPy_AS_JFLOAT)
+JPy_DEFINE_FIELD_ACCESSORS(Double, jdouble, JPy_FROM_JDOUBLE, JPy_AS_JDOUBLE)
+
+PyObject* JField_GetObjectField(JNIEnv* jenv, JPy_JField* field, jobject objectRef)
+{
+    PyObject* returnValue;
+    jobject item = (*jenv)->GetObjectField(jenv, objectRef, field->fid);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    returnValue = JPy_FromJObjectWithType(jenv, item, field->type);
+    (*jenv)->DeleteLocalRef(jenv, item);
+    return returnValue;
+}
+
+PyObject* JField_GetStaticObjectField(JNIEnv* jenv, JPy_JField* field, jobject objectRef)
+{
+    PyObject* returnValue;
+    jobject item = (*jenv)->GetStaticObjectField(jenv, field->declaringClass->classRef, field->fid);
+    JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    returnValue = JPy_FromJObjectWithType(jenv, item, field->type);
+    (*jenv)->DeleteLocalRef(jenv, item);
+    return returnValue;
+}
+
+int JField_SetObjectField(JNIEnv* jenv, JPy_JField* field, jobject objectRef, PyObject* value)
+{
+    jobject item;
+    if (JPy_AsJObjectWithType(jenv, value, &item, field->type) < 0) {
+        return -1;
+    }
+    (*jenv)->SetObjectField(jenv, objectRef, field->fid, item);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return 0;
+}
+
+int JField_SetStaticObjectField(JNIEnv* jenv, JPy_JField* field, jobject objectRef, PyObject* value)
+{
+    jobject item;
+    if (JPy_AsJObjectWithType(jenv, value, &item, field->type) < 0) {
+        return -1;
+    }
+    (*jenv)->SetStaticObjectField(jenv, field->declaringClass->classRef, field->fid, item);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return 0;
+}
+
+/**
+ * Chooses the field's getter and setter functions, so that no dispatch on the field type is required on access.
+ */
+void JField_InitAccessors(JPy_JField* field)
+{
+    JPy_JType* type = field->type;
+    jboolean isStatic = field->isStatic;
+
+    if (type == JPy_JBoolean) {
+        field->GetValue = isStatic ? JField_GetStaticBooleanField : JField_GetBooleanField;
+        field->SetValue = isStatic ? JField_SetStaticBooleanField : JField_SetBooleanField;
+    } else if (type == JPy_JChar) {
+        field->GetValue = isStatic ? JField_GetStaticCharField : JField_GetCharField;
+        field->SetValue = isStatic ? JField_SetStaticCharField : JField_SetCharField;
+    } else if (type == JPy_JByte) {
+        field->GetValue = isStatic ? JField_GetStaticByteField : JField_GetByteField;
+        field->SetValue = isStatic ? JField_SetStaticByteField : JField_SetByteField;
+    } else if (type == JPy_JShort) {
+        field->GetValue = isStatic ? JField_GetStaticShortField : JField_GetShortField;
+        field->SetValue = isStatic ? JField_SetStaticShortField : JField_SetShortField;
+    } else if (type == JPy_JInt) {
+        field->GetValue = isStatic ? JField_GetStaticIntField : JField_GetIntField;
+        field->SetValue = isStatic ? JField_SetStaticIntField : JField_SetIntField;
+    } else if (type == JPy_JLong) {
+        field->GetValue = isStatic ? JField_GetStaticLongField : JField_GetLongField;
+        field->SetValue = isStatic ? JField_SetStaticLongField : JField_SetLongField;
+    } else if (type == JPy_JFloat) {
+        field->GetValue = isStatic ? JField_GetStaticFloatField : JField_GetFloatField;
+        field->SetValue = isStatic ? JField_SetStaticFloatField : JField_SetFloatField;
+    } else if (type == JPy_JDouble) {
+        field->GetValue = isStatic ? JField_GetStaticDoubleField : JField_GetDoubleField;
+        field->SetValue = isStatic ? JField_SetStaticDoubleField : JField_SetDoubleField;
+    } else {
+        field->GetValue = isStatic ? JField_GetStaticObjectField : JField_GetObjectField;
+        field->SetValue = isStatic ? JField_SetStaticObjectField : JField_SetObjectField;
+    }
+}
+
+/**
+ * The JField type's tp_descr_get slot.
+ * Returns the value of a Java field. Static fields are always read from the Java class, so they are never stale.
+ * Accessing an instance field from its Java type returns the JField object itself.
+ */
+PyObject* JField_descr_get(JPy_JField* self, PyObject* obj, PyObject* type)
+{
+    JNIEnv* jenv;
+
+    if (self->isStatic) {
+        JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+        return self->GetValue(jenv, self, NULL);
+    }
+
+    if (obj == NULL || obj == Py_None) {
+        Py_INCREF(self);
+        return (PyObject*) self;
+    }
+
+    if (!JObj_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "Java field '%s' requires a Java object", JPy_AS_UTF8(self->name));
+        return NULL;
+    }
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+    return self->GetValue(jenv, self, ((JPy_JObj*) obj)->objectRef);
+}
+
+/**
+ * The JField type's tp_descr_set slot.
+ * Sets the value of a Java field. Static final fields and field deletion are not supported.
+ */
+int JField_descr_set(JPy_JField* self, PyObject* obj, PyObject* value)
+{
+    JNIEnv* jenv;
+
+    if (value == NULL) {
+        PyErr_Format(PyExc_AttributeError, "Java field '%s' cannot be deleted", JPy_AS_UTF8(self->name));
+        return -1;
+    }
+
+    if (self->isStatic && self->isFinal) {
+        PyErr_Format(PyExc_AttributeError, "Java field '%s' is static and final", JPy_AS_UTF8(self->name));
+        return -1;
+    }
+
+    if (!self->isStatic && !JObj_Check(obj)) {
+        PyErr_Format(PyExc_TypeError, "Java field '%s' requires a Java object", JPy_AS_UTF8(self->name));
+        return -1;
+    }
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
+    return self->SetValue(jenv, self, self->isStatic ? NULL : ((JPy_JObj*) obj)->objectRef, value);
+}
+
+
+/**
+ * Looks up the instance field of the given name in the given (resolved) type or its super types.
+ * Returns a borrowed reference.
+ */
+JPy_JField* JField_FindInstanceField(JPy_JType* type, PyObject* name)
+{
+    PyTypeObject* typeObj;
+    PyObject* value;
+
+    typeObj = (PyTypeObject*) type;
+    while (typeObj != NULL && JType_Check((PyObject*) typeObj)) {
+        value = PyDict_GetItem(typeObj->tp_dict, name);
+        if (value != NULL) {
+            if (PyObject_TypeCheck(value, JPy_GetModuleState()->jfieldType) && !((JPy_JField*) value)->isStatic) {
+                return (JPy_JField*) value;
+            }
+            break;
+        }
+        typeObj = typeObj->tp_base;
+    }
+
+    PyErr_Format(PyExc_ValueError, "'%s' is not an instance field of Java type '%s'", JPy_AS_UTF8(name), type->javaName);
+    return NULL;
+}
+
+/**
+ * Reads the value of a field of the given Java object into item index of a column,
+ * which is either a numpy.ndarray exported by buffer or a list.
+ */
+int JField_GetColumnItem(JNIEnv* jenv, JPy_JField* field, char javaType, jobject objectRef, PyObject* column, Py_buffer* buffer, Py_ssize_t index)
+{
+    PyObject* item;
+
+    if (buffer->obj != NULL) {
+        if (javaType == 'Z') {
+            ((jboolean*) buffer->buf)[index] = (*jenv)->GetBooleanField(jenv, objectRef, field->fid);
+        } else if (javaType == 'C') {
+            ((jchar*) buffer->buf)[index] = (*jenv)->GetCharField(jenv, objectRef, field->fid);
+        } else if (javaType == 'B') {
+            ((jbyte*) buffer->buf)[index] = (*jenv)->GetByteField(jenv, objectRef, field->fid);
+        } else if (javaType == 'S') {
+            ((jshort*) buffer->buf)[index] = (*jenv)->GetShortField(jenv, objectRef, field->fid);
+        } else if (javaType == 'I') {
+            ((jint*) buffer->buf)[index] = (*jenv)->GetIntField(jenv, objectRef, field->fid);
+        } else if (javaType == 'J') {
+            ((jlong*) buffer->buf)[index] = (*jenv)->GetLongField(jenv, objectRef, field->fid);
+        } else if (javaType == 'F') {
+            ((jfloat*) buffer->buf)[index] = (*jenv)->GetFloatField(jenv, objectRef, field->fid);
+        } else if (javaType == 'D') {
+            ((jdouble*) buffer->buf)[index] = (*jenv)->GetDoubleField(jenv, objectRef, field->fid);
+        }
+        return 0;
+    }
+
+    if (objectRef == NULL) {
+        item = Py_BuildValue("");
+    } else if (javaType == 'Z') {
+        item = JPy_FROM_JBOOLEAN((*jenv)->GetBooleanField(jenv, objectRef, field->fid));
+    } else if (javaType == 'C') {
+        item = JPy_FROM_JCHAR((*jenv)->GetCharField(jenv, objectRef, field->fid));
+    } else if (javaType == 'B') {
+        item = JPy_FROM_JBYTE((*jenv)->GetByteField(jenv, objectRef, field->fid));
+    } else if (javaType == 'S') {
+        item = JPy_FROM_JSHORT((*jenv)->GetShortField(jenv, objectRef, field->fid));
+    } else if (javaType == 'I') {
+        item = JPy_FROM_JINT((*jenv)->GetIntField(jenv, objectRef, field->fid));
+    } else if (javaType == 'J') {
+        item = JPy_FROM_JLONG((*jenv)->GetLongField(jenv, objectRef, field->fid));
+    } else if (javaType == 'F') {
+        item = JPy_FROM_JFLOAT((*jenv)->GetFloatField(jenv, objectRef, field->fid));
+    } else if (javaType == 'D') {
+        item = JPy_FROM_JDOUBLE((*jenv)->GetDoubleField(jenv, objectRef, field->fid));
+    } else {
+        jobject itemRef = (*jenv)->GetObjectField(jenv, objectRef, field->fid);
+        item = JPy_FromJObjectWithType(jenv, itemRef, field->type);
+        (*jenv)->DeleteLocalRef(jenv, itemRef);
+    }
+    if (item == NULL) {
+        return -1;
+    }
+    PyList_SET_ITEM(column, index, item);
+    return 0;
+}
+
+/**
+ * Reads the instance fields given by names from all objects in objs, which is either a Java object array or
+ * a Python sequence of Java objects. The fields are looked up only once. Returns a new list holding one column
+ * per field name. A column is a list, or a numpy.ndarray for primitive fields if asNumPy is true.
+ */
+PyObject* JField_GetColumns(JNIEnv* jenv, PyObject* objs, PyObject* names, jboolean asNumPy)
+{
+    JPy_JType* objType;
+    jobjectArray arrayRef;
+    PyObject* objSeq;
+    PyObject* nameSeq;
+    PyObject* numpy;
+    PyObject* columns;
+    PyObject* column;
+    JPy_JField** fields;
+    char* javaTypes;
+    Py_buffer* buffers;
+    Py_ssize_t objCount;
+    Py_ssize_t fieldCount;
+    Py_ssize_t i;
+    Py_ssize_t k;
+    jobject objectRef;
+    jint itemSize;
+    const char* dtypeName;
+    int ret;
+
+    objType = NULL;
+    arrayRef = NULL;
+    objSeq = NULL;
+    nameSeq = NULL;
+    numpy = NULL;
+    columns = NULL;
+    fields = NULL;
+    javaTypes = NULL;
+    buffers = NULL;
+    fieldCount = 0;
+
+    // Determine the objects and their common type
+    if (JObj_Check(objs) && ((JPy_JType*) Py_TYPE(objs))->componentType != NULL) {
+        objType = ((JPy_JType*) Py_TYPE(objs))->componentType;
+        if (objType->isPrimitive) {
+            PyErr_SetString(PyExc_ValueError, "get_fields: argument 1 (objs) must not be a Java primitive array");
+            return NULL;
+        }
+        arrayRef = ((JPy_JObj*) objs)->objectRef;
+        objCount = (*jenv)->GetArrayLength(jenv, arrayRef);
+    } else {
+        objSeq = PySequence_Fast(objs, "get_fields: argument 1 (objs) must be a Java object array or a sequence of Java objects");
+        if (objSeq == NULL) {
+            return NULL;
+        }
+        objCount = PySequence_Fast_GET_SIZE(objSeq);
+        for (i = 0; i < objCount; i++) {
+            PyObject* obj = PySequence_Fast_GET_ITEM(objSeq, i);
+            if (obj == Py_None) {
+                continue;
+            }
+            if (!JObj_Check(obj) || (objType != NULL && !PyObject_TypeCheck(obj, (PyTypeObject*) objType))) {
+                PyErr_Format(PyExc_ValueError, "get_fields: item %d of argument 1 (objs) must be a Java object of type '%s'",
+                             (int) i, objType != NULL ? objType->javaName : "<any>");
+                goto error;
+            }
+            if (objType == NULL) {
+                objType = (JPy_JType*) Py_TYPE(obj);
+            }
+        }
+        if (objType == NULL) {
+            objType = JPy_JObject;
+        }
+    }
+
+    if (!JPy_LOAD_FLAG(objType->isResolved) && JType_ResolveType(jenv, objType) < 0) {
+        goto error;
+    }
+
+    // Look up the fields only once
+    nameSeq = PySequence_Fast(names, "get_fields: argument 2 (names) must be a sequence of field names");
+    if (nameSeq == NULL) {
+        goto error;
+    }
+    fieldCount = PySequence_Fast_GET_SIZE(nameSeq);
+    fields = PyMem_New(JPy_JField*, fieldCount);
+    javaTypes = PyMem_New(char, fieldCount);
+    buffers = PyMem_New(Py_buffer, fieldCount);
+    columns = PyList_New(fieldCount);
+    if (fields == NULL || javaTypes == NULL || buffers == NULL || columns == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+    for (k = 0; k < fieldCount; k++) {
+        buffers[k].obj = NULL;
+    }
+
+    for (k = 0; k < fieldCount; k++) {
+        PyObject* name = PySequence_Fast_GET_ITEM(nameSeq, k);
+        if (!JPy_IS_STR(name)) {
+            PyErr_SetString(PyExc_ValueError, "get_fields: argument 2 (names) must be a sequence of field names");
+            goto error;
+        }
+        fields[k] = JField_FindInstanceField(objType, name);
+        if (fields[k] == NULL) {
+            goto error;
+        }
+        if (fields[k]->type->isPrimitive) {
+            if (JArray_GetPrimitiveInfo(fields[k]->type, &javaTypes[k], &itemSize, &dtypeName) < 0) {
+                goto error;
+            }
+        } else {
+            javaTypes[k] = 'L';
+        }
+
+        if (asNumPy && fields[k]->type->isPrimitive) {
+            if (numpy == NULL) {
+                numpy = PyImport_ImportModule("numpy");
+                if (numpy == NULL) {
+                    goto error;
+                }
+            }
+            column = PyObject_CallMethod(numpy, "empty", "(n)s", objCount, dtypeName);
+            if (column == NULL) {
+                goto error;
+            }
+            PyList_SET_ITEM(columns, k, column);
+            if (PyObject_GetBuffer(column, &buffers[k], PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0) {
+                buffers[k].obj = NULL;
+                goto error;
+            }
+        } else {
+            column = PyList_New(objCount);
+            if (column == NULL) {
+                goto error;
+            }
+            PyList_SET_ITEM(columns, k, column);
+        }
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JField_GetColumns: type='%s', objCount=%d, fieldCount=%d\n", objType->javaName, (int) objCount, (int) fieldCount);
+
+    // Read all fields of one object after the other
+    for (i = 0; i < objCount; i++) {
+        if (arrayRef != NULL) {
+            objectRef = (*jenv)->GetObjectArrayElement(jenv, arrayRef, (jint) i);
+        } else {
+            PyObject* obj = PySequence_Fast_GET_ITEM(objSeq, i);
+            objectRef = obj != Py_None ? ((JPy_JObj*) obj)->objectRef : NULL;
+        }
+        ret = 0;
+        for (k = 0; k < fieldCount && ret == 0; k++) {
+            if (objectRef == NULL && buffers[k].obj != NULL) {
+                PyErr_Format(PyExc_ValueError, "get_fields: item %d of argument 1 (objs) is null, but field '%s' is read into a numpy array",
+                             (int) i, JPy_AS_UTF8(fields[k]->name));
+                ret = -1;
+            } else {
+                ret = JField_GetColumnItem(jenv, fields[k], javaTypes[k], objectRef, PyList_GET_ITEM(columns, k), &buffers[k], i);
+            }
+        }
+        if (arrayRef != NULL && objectRef != NULL) {
+            (*jenv)->DeleteLocalRef(jenv, objectRef);
+        }
+        if (ret < 0) {
+            goto error;
+        }
+        JPy_ON_JAVA_EXCEPTION_GOTO(error);
+    }
+
+    for (k = 0; k < fieldCount; k++) {
+        if (buffers[k].obj != NULL) {
+            PyBuffer_Release(&buffers[k]);
+        }
+    }
+    PyMem_Del(fields);
+    PyMem_Del(javaTypes);
+    PyMem_Del(buffers);
+    Py_XDECREF(numpy);
+    Py_DECREF(nameSeq);
+    Py_XDECREF(objSeq);
+    return columns;
+
+error:
+    if (buffers != NULL) {
+        for (k = 0; k < fieldCount; k++) {
+            if (buffers[k].obj != NULL) {
+                PyBuffer_Release(&buffers[k]);
+            }
+        }
+    }
+    PyMem_Del(fields);
+    PyMem_Del(javaTypes);
+    PyMem_Del(buffers);
+    Py_XDECREF(columns);
+    Py_XDECREF(numpy);
+    Py_XDECREF(nameSeq);
+    Py_XDECREF(objSeq);
+    return NULL;
+}
+
+
 static PyMemberDef JField_members[] =
 {
     {"name",        T_OBJECT_EX, offsetof(JPy_JField, name),       READONLY, "Field name"},
@@ -127,8 +595,8 @@ PyTypeObject JField_Type = {
     NULL,                         /* tp_getset */
     NULL,                         /* tp_base */
     NULL,                         /* tp_dict */
-    NULL,                         /* tp_descr_get */
-    NULL,                         /* tp_descr_set */
+    (descrgetfunc)JField_descr_get, /* tp_descr_get */
+    (descrsetfunc)JField_descr_set, /* tp_descr_set */
     0,                            /* tp_dictoffset */
     NULL,                         /* tp_init */
     NULL,                         /* tp_alloc */
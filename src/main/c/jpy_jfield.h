@@ -24,9 +24,10 @@ extern "C" {
 #include "jpy_compat.h"
 
 /**
- * Python object representing a Java method. It's type is 'JMethod'.
+ * Python object representing a Java field. It's type is 'JField'.
+ * JField objects are data descriptors stored in the tp_dict of the declaring JType.
  */
-typedef struct
+typedef struct JPy_JField
 {
     PyObject_HEAD
 
@@ -42,17 +43,23 @@ typedef struct
     char isFinal;
     // Field ID retrieved from JNI.
     jfieldID fid;
+    // Type-specific accessors, chosen once by JField_New(). objectRef is ignored for static fields.
+    PyObject* (*GetValue)(JNIEnv* jenv, struct JPy_JField* field, jobject objectRef);
+    int (*SetValue)(JNIEnv* jenv, struct JPy_JField* field, jobject objectRef, PyObject* value);
 }
 JPy_JField;
 
 /**
- * The Python 'JMethod' type singleton.
+ * The template of the Python 'JField' type. Use JPy_GetModuleState()->jfieldType, the copy of the current interpreter.
  */
 extern PyTypeObject JField_Type;
 
 JPy_JField* JField_New(JPy_JType* declaringType, PyObject* fieldKey, JPy_JType* fieldType, jboolean isStatic, jboolean isFinal, jfieldID fid);
 void JField_Del(JPy_JField* field);
 
+JPy_JField* JField_FindInstanceField(JPy_JType* type, PyObject* name);
+PyObject* JField_GetColumns(JNIEnv* jenv, PyObject* objs, PyObject* names, jboolean asNumPy);
+
 #ifdef __cplusplus
 }  /* extern "C" */
 #endif
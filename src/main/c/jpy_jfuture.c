@@ -0,0 +1,445 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jpy_module.h"
+#include "jpy_diag.h"
+#include "jpy_jtype.h"
+#include "jpy_jobj.h"
+#include "jpy_jfuture.h"
+
+/*
+ * Java futures and Python futures are connected through the static methods of the Java class org.jpy.PyFutures,
+ * which register Python callables as completion callbacks of Java futures. Python futures get C callbacks
+ * (PyCFunctions whose self is the other side's future) as done-callbacks.
+ */
+
+PyObject* JFuture_GetPyFuturesType(JNIEnv* jenv)
+{
+    JPy_JType* type;
+
+    type = JType_GetTypeForName(jenv, "org.jpy.PyFutures", JNI_TRUE);
+    if (type == NULL) {
+        PyErr_Clear();
+        PyErr_SetString(PyExc_RuntimeError, "jpy: Java class 'org.jpy.PyFutures' not found, the jpy JAR must be on the Java classpath");
+        return NULL;
+    }
+    return (PyObject*) type;
+}
+
+/**
+ * Creates a callable which calls loop.call_soon_threadsafe(callable, *args), so that it can be called
+ * from any thread.
+ */
+PyObject* JFuture_NewThreadSafeCallback(PyObject* loop, PyObject* callable)
+{
+    PyObject* functools;
+    PyObject* callSoon;
+    PyObject* callback;
+
+    functools = PyImport_ImportModule("functools");
+    if (functools == NULL) {
+        return NULL;
+    }
+    callSoon = PyObject_GetAttrString(loop, "call_soon_threadsafe");
+    if (callSoon == NULL) {
+        Py_DECREF(functools);
+        return NULL;
+    }
+    callback = PyObject_CallMethod(functools, "partial", "OO", callSoon, callable);
+    Py_DECREF(callSoon);
+    Py_DECREF(functools);
+    return callback;
+}
+
+/**
+ * Creates a Python RuntimeError from the given error object. Used for Java Throwables.
+ */
+PyObject* JFuture_NewRuntimeError(PyObject* error)
+{
+    PyObject* message;
+    PyObject* exception;
+
+    message = PyObject_Str(error);
+    if (message == NULL) {
+        return NULL;
+    }
+    exception = PyObject_CallFunctionObjArgs(PyExc_RuntimeError, message, NULL);
+    Py_DECREF(message);
+    return exception;
+}
+
+/**
+ * Called in the event loop's thread after a Java CompletionStage has been completed.
+ * self is the asyncio future, args are the stage's value and error (or None).
+ */
+PyObject* JFuture_SetAsyncResult(PyObject* future, PyObject* args)
+{
+    PyObject* value;
+    PyObject* error;
+    PyObject* done;
+    PyObject* exception;
+    PyObject* result;
+    int isDone;
+
+    if (!PyArg_ParseTuple(args, "OO:set_result", &value, &error)) {
+        return NULL;
+    }
+
+    // The future may have been cancelled meanwhile
+    done = PyObject_CallMethod(future, "done", NULL);
+    if (done == NULL) {
+        return NULL;
+    }
+    isDone = PyObject_IsTrue(done);
+    Py_DECREF(done);
+    if (isDone) {
+        Py_RETURN_NONE;
+    }
+
+    if (error != Py_None) {
+        exception = JFuture_NewRuntimeError(error);
+        if (exception == NULL) {
+            return NULL;
+        }
+        result = PyObject_CallMethod(future, "set_exception", "(O)", exception);
+        Py_DECREF(exception);
+    } else {
+        result = PyObject_CallMethod(future, "set_result", "(O)", value);
+    }
+    return result;
+}
+
+/**
+ * Done-callback of the asyncio future awaiting a Java CompletionStage: cancels the stage if the future
+ * has been cancelled. self is the stage.
+ */
+PyObject* JFuture_CancelStage(PyObject* stage, PyObject* future)
+{
+    JNIEnv* jenv;
+    PyObject* pyFuturesType;
+    PyObject* cancelled;
+    PyObject* result;
+    int isCancelled;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    cancelled = PyObject_CallMethod(future, "cancelled", NULL);
+    if (cancelled == NULL) {
+        return NULL;
+    }
+    isCancelled = PyObject_IsTrue(cancelled);
+    Py_DECREF(cancelled);
+    if (!isCancelled) {
+        Py_RETURN_NONE;
+    }
+
+    pyFuturesType = JFuture_GetPyFuturesType(jenv);
+    if (pyFuturesType == NULL) {
+        return NULL;
+    }
+    result = PyObject_CallMethod(pyFuturesType, "cancel", "(O)", stage);
+    Py_XDECREF(result);
+    if (result == NULL) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/**
+ * Completes the Java CompletableFuture jFuture with the result or exception of the done Python future.
+ */
+PyObject* JFuture_CompleteJavaFutureWithOutcome(JNIEnv* jenv, PyObject* jFuture, PyObject* future)
+{
+    PyObject* pyFuturesType;
+    PyObject* exception;
+    PyObject* text;
+    const char* textChars;
+    PyObject* message;
+    PyObject* value;
+    PyObject* result;
+
+    exception = PyObject_CallMethod(future, "exception", NULL);
+    if (exception == NULL) {
+        return NULL;
+    }
+    if (exception != Py_None) {
+        pyFuturesType = JFuture_GetPyFuturesType(jenv);
+        // Note: no '%S' here, Python 2's PyString_FromFormat() doesn't support it
+        message = NULL;
+        text = PyObject_Str(exception);
+        if (text != NULL) {
+            textChars = JPy_AS_UTF8(text);
+            if (textChars != NULL) {
+                message = JPy_FROM_FORMAT("%s: %s", Py_TYPE(exception)->tp_name, textChars);
+            }
+            Py_DECREF(text);
+        }
+        Py_DECREF(exception);
+        if (pyFuturesType == NULL || message == NULL) {
+            Py_XDECREF(message);
+            return NULL;
+        }
+        result = PyObject_CallMethod(pyFuturesType, "fail", "OO", jFuture, message);
+        Py_DECREF(message);
+    } else {
+        Py_DECREF(exception);
+        value = PyObject_CallMethod(future, "result", NULL);
+        if (value == NULL) {
+            return NULL;
+        }
+        result = PyObject_CallMethod(jFuture, "complete", "(O)", value);
+        Py_DECREF(value);
+    }
+    return result;
+}
+
+/**
+ * Done-callback of a Python future converted by JFuture_ToJava(): completes the Java CompletableFuture self.
+ */
+PyObject* JFuture_CompleteJavaFuture(PyObject* jFuture, PyObject* future)
+{
+    JNIEnv* jenv;
+    PyObject* cancelled;
+    PyObject* result;
+    int isCancelled;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    cancelled = PyObject_CallMethod(future, "cancelled", NULL);
+    if (cancelled == NULL) {
+        return NULL;
+    }
+    isCancelled = PyObject_IsTrue(cancelled);
+    Py_DECREF(cancelled);
+    if (isCancelled) {
+        result = PyObject_CallMethod(jFuture, "cancel", "(O)", Py_False);
+    } else {
+        result = JFuture_CompleteJavaFutureWithOutcome(jenv, jFuture, future);
+    }
+    Py_XDECREF(result);
+    if (result == NULL) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyMethodDef JFuture_SetAsyncResult_Def =
+    {"set_async_result", (PyCFunction) JFuture_SetAsyncResult, METH_VARARGS, "Sets the result of an asyncio future awaiting a Java future."};
+
+static PyMethodDef JFuture_CancelStage_Def =
+    {"cancel_stage", (PyCFunction) JFuture_CancelStage, METH_O, "Cancels a Java future if the asyncio future awaiting it has been cancelled."};
+
+static PyMethodDef JFuture_CompleteJavaFuture_Def =
+    {"complete_java_future", (PyCFunction) JFuture_CompleteJavaFuture, METH_O, "Completes a Java future with the outcome of a Python future."};
+
+/**
+ * Implements the am_await slot of Java types implementing java.util.concurrent.CompletionStage.
+ * Returns the iterator of a new asyncio future (of the running event loop) which is completed once the
+ * Java stage is completed. The Java completion callback posts the outcome to the event loop using
+ * call_soon_threadsafe(), so no thread waits for the stage and the GIL is not held while waiting.
+ */
+PyObject* JFuture_Await(JPy_JObj* self)
+{
+    JNIEnv* jenv;
+    PyObject* pyFuturesType;
+    PyObject* asyncio;
+    PyObject* loop;
+    PyObject* future;
+    PyObject* setResult;
+    PyObject* callback;
+    PyObject* cancelStage;
+    PyObject* status;
+    PyObject* iterator;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    pyFuturesType = JFuture_GetPyFuturesType(jenv);
+    if (pyFuturesType == NULL) {
+        return NULL;
+    }
+
+    asyncio = PyImport_ImportModule("asyncio");
+    if (asyncio == NULL) {
+        return NULL;
+    }
+    // Called by 'await' in a coroutine, so there is a running loop. Before Python 3.7, get_event_loop() returns it.
+#if PY_VERSION_HEX >= 0x03070000
+    loop = PyObject_CallMethod(asyncio, "get_running_loop", NULL);
+#else
+    loop = PyObject_CallMethod(asyncio, "get_event_loop", NULL);
+#endif
+    Py_DECREF(asyncio);
+    if (loop == NULL) {
+        return NULL;
+    }
+    future = PyObject_CallMethod(loop, "create_future", NULL);
+    if (future == NULL) {
+        Py_DECREF(loop);
+        return NULL;
+    }
+
+    iterator = NULL;
+    callback = NULL;
+    cancelStage = NULL;
+    setResult = PyCFunction_New(&JFuture_SetAsyncResult_Def, future);
+    if (setResult == NULL) {
+        goto error;
+    }
+    callback = JFuture_NewThreadSafeCallback(loop, setResult);
+    if (callback == NULL) {
+        goto error;
+    }
+    cancelStage = PyCFunction_New(&JFuture_CancelStage_Def, (PyObject*) self);
+    if (cancelStage == NULL) {
+        goto error;
+    }
+    status = PyObject_CallMethod(future, "add_done_callback", "(O)", cancelStage);
+    if (status == NULL) {
+        goto error;
+    }
+    Py_DECREF(status);
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JFuture_Await: registering completion callback on Java object %p\n", self->objectRef);
+
+    status = PyObject_CallMethod(pyFuturesType, "whenComplete", "OO", self, callback);
+    if (status == NULL) {
+        goto error;
+    }
+    Py_DECREF(status);
+
+    iterator = PyObject_CallMethod(future, "__await__", NULL);
+
+error:
+    Py_XDECREF(setResult);
+    Py_XDECREF(callback);
+    Py_XDECREF(cancelStage);
+    Py_DECREF(future);
+    Py_DECREF(loop);
+    return iterator;
+}
+
+/**
+ * Converts the given Python coroutine, asyncio future or concurrent.futures.Future into a new Java
+ * CompletableFuture. Coroutines are scheduled on the current event loop or, if loop is given, submitted to
+ * the given loop from another thread. Cancelling the Java future cancels the Python future.
+ */
+PyObject* JFuture_ToJava(JNIEnv* jenv, PyObject* obj, PyObject* loop)
+{
+    PyObject* pyFuturesType;
+    PyObject* asyncio;
+    PyObject* asyncioFuture;
+    PyObject* isCoroutine;
+    PyObject* future;
+    PyObject* cancel;
+    PyObject* cancelCallback;
+    PyObject* futureLoop;
+    PyObject* jFuture;
+    PyObject* completeJavaFuture;
+    PyObject* status;
+    int isAsyncioFuture;
+
+    pyFuturesType = JFuture_GetPyFuturesType(jenv);
+    if (pyFuturesType == NULL) {
+        return NULL;
+    }
+
+    asyncio = PyImport_ImportModule("asyncio");
+    if (asyncio == NULL) {
+        return NULL;
+    }
+
+    isCoroutine = PyObject_CallMethod(asyncio, "iscoroutine", "(O)", obj);
+    if (isCoroutine == NULL) {
+        Py_DECREF(asyncio);
+        return NULL;
+    }
+    if (PyObject_IsTrue(isCoroutine)) {
+        if (loop != NULL && loop != Py_None) {
+            future = PyObject_CallMethod(asyncio, "run_coroutine_threadsafe", "OO", obj, loop);
+        } else {
+            future = PyObject_CallMethod(asyncio, "ensure_future", "(O)", obj);
+        }
+    } else if (PyObject_HasAttrString(obj, "add_done_callback")) {
+        future = obj;
+        Py_INCREF(future);
+    } else {
+        PyErr_SetString(PyExc_ValueError, "to_java_future: argument 1 must be a coroutine or a future");
+        future = NULL;
+    }
+    Py_DECREF(isCoroutine);
+    if (future == NULL) {
+        Py_DECREF(asyncio);
+        return NULL;
+    }
+
+    jFuture = NULL;
+    cancelCallback = NULL;
+    completeJavaFuture = NULL;
+
+    // asyncio futures must be cancelled in their event loop's thread
+    cancel = PyObject_GetAttrString(future, "cancel");
+    asyncioFuture = PyObject_GetAttrString(asyncio, "Future");
+    if (cancel == NULL || asyncioFuture == NULL) {
+        goto error;
+    }
+    isAsyncioFuture = PyObject_IsInstance(future, asyncioFuture);
+    if (isAsyncioFuture < 0) {
+        goto error;
+    } else if (isAsyncioFuture) {
+        futureLoop = PyObject_HasAttrString(future, "get_loop")
+                     ? PyObject_CallMethod(future, "get_loop", NULL)
+                     : PyObject_GetAttrString(future, "_loop");
+        if (futureLoop == NULL) {
+            goto error;
+        }
+        cancelCallback = JFuture_NewThreadSafeCallback(futureLoop, cancel);
+        Py_DECREF(futureLoop);
+    } else {
+        cancelCallback = cancel;
+        Py_INCREF(cancelCallback);
+    }
+    if (cancelCallback == NULL) {
+        goto error;
+    }
+
+    jFuture = PyObject_CallMethod(pyFuturesType, "newFuture", "(O)", cancelCallback);
+    if (jFuture == NULL) {
+        goto error;
+    }
+    completeJavaFuture = PyCFunction_New(&JFuture_CompleteJavaFuture_Def, jFuture);
+    if (completeJavaFuture == NULL) {
+        goto error;
+    }
+    status = PyObject_CallMethod(future, "add_done_callback", "(O)", completeJavaFuture);
+    if (status == NULL) {
+        goto error;
+    }
+    Py_DECREF(status);
+    goto done;
+
+error:
+    Py_XDECREF(jFuture);
+    jFuture = NULL;
+
+done:
+    Py_XDECREF(completeJavaFuture);
+    Py_XDECREF(cancelCallback);
+    Py_XDECREF(asyncioFuture);
+    Py_XDECREF(cancel);
+    Py_DECREF(future);
+    Py_DECREF(asyncio);
+    return jFuture;
+}
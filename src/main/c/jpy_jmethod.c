@@ -19,9 +19,15 @@
 #include "jpy_jtype.h"
 #include "jpy_jobj.h"
 #include "jpy_jmethod.h"
+#include "jpy_jarray.h"
 #include "jpy_conv.h"
+#include "jpy_jcoll.h"
 #include "jpy_compat.h"
 
+#if defined(JPY_COMPAT_VECTORCALL)
+PyObject* JMethod_vectorcall(JPy_JMethod* self, PyObject* const* args, size_t nargsf, PyObject* kwnames);
+PyObject* JOverloadedMethod_vectorcall(JPy_JOverloadedMethod* self, PyObject* const* args, size_t nargsf, PyObject* kwnames);
+#endif
 
 JPy_JMethod* JMethod_New(JPy_JType* declaringClass,
                          PyObject* name,
@@ -31,7 +37,7 @@ JPy_JMethod* JMethod_New(JPy_JType* declaringClass,
                          jboolean isStatic,
                          jmethodID mid)
 {
-    PyTypeObject* type = &JMethod_Type;
+    PyTypeObject* type = JPy_GetModuleState()->jmethodType;
     JPy_JMethod* method;
 
     method = (JPy_JMethod*) type->tp_alloc(type, 0);
@@ -42,6 +48,9 @@ JPy_JMethod* JMethod_New(JPy_JType* declaringClass,
     method->returnDescriptor = returnDescriptor;
     method->isStatic = isStatic;
     method->mid = mid;
+#if defined(JPY_COMPAT_VECTORCALL)
+    method->vectorcall = (vectorcallfunc) JMethod_vectorcall;
+#endif
 
     Py_INCREF(declaringClass);
     Py_INCREF(method->name);
@@ -72,7 +81,7 @@ void JMethod_dealloc(JPy_JMethod* self)
     PyMem_Del(self->paramDescriptors);
     PyMem_Del(self->returnDescriptor);
     
-    Py_TYPE(self)->tp_free((PyObject*) self);
+    JPy_FREE_INSTANCE(self)
 }
 
 void JMethod_Del(JPy_JMethod* method)
@@ -81,11 +90,11 @@ void JMethod_Del(JPy_JMethod* method)
 }
 
 /**
- * Matches the give Python argument tuple against the Java method's formal parameters.
+ * Matches the given Python argument vector against the Java method's formal parameters.
  * Returns the sum of the i-th argument against the i-th Java parameter.
  * The maximum match value returned is 100 * method->paramCount.
  */
-int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* method, int argCount, PyObject* pyArgs)
+int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* method, int argCount, PyObject* const* pyArgs)
 {
     JPy_ParamDescriptor* paramDescriptor;
     PyObject* pyArg;
@@ -117,7 +126,7 @@ int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* me
             // argument count mismatch
             return 0;
         }
-        self = PyTuple_GetItem(pyArgs, 0);
+        self = pyArgs[0];
         if (self == Py_None) {
             JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JMethod_MatchPyArgs: self argument is None (matchValue=0)\n");
             return 0;
@@ -143,7 +152,7 @@ int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* me
     paramDescriptor = method->paramDescriptors;
     for (i = i0; i < argCount; i++) {
 
-        pyArg = PyTuple_GetItem(pyArgs, i);
+        pyArg = pyArgs[i];
         matchValue = paramDescriptor->MatchPyArg(jenv, paramDescriptor, pyArg);
 
         JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JMethod_MatchPyArgs: pyArgs[%d]: paramDescriptor->type->javaName='%s', matchValue=%d\n", i, paramDescriptor->type->javaName, matchValue);
@@ -164,12 +173,12 @@ int JMethod_MatchPyArgs(JNIEnv* jenv, JPy_JType* declaringClass, JPy_JMethod* me
 
 #define JPy_SUPPORT_RETURN_PARAMETER 1
 
-PyObject* JMethod_FromJObject(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs, jvalue* jArgs, int argOffset, JPy_JType* returnType, jobject jReturnValue)
+PyObject* JMethod_FromJObject(JNIEnv* jenv, JPy_JMethod* method, PyObject* const* pyArgs, jvalue* jArgs, int argOffset, JPy_JType* returnType, jobject jReturnValue)
 {
     #ifdef JPy_SUPPORT_RETURN_PARAMETER
     if (method->returnDescriptor->paramIndex >= 0) {
         jint paramIndex = method->returnDescriptor->paramIndex;
-        PyObject* pyReturnArg = PyTuple_GetItem(pyArgs, paramIndex + argOffset);
+        PyObject* pyReturnArg = pyArgs[paramIndex + argOffset];
         jobject jArg = jArgs[paramIndex].l;
         //printf("JMethod_FromJObject: paramIndex=%d, jArg=%p, isNone=%d\n", paramIndex, jArg, pyReturnArg == Py_None);
         if ((JObj_Check(pyReturnArg) || PyObject_CheckBuffer(pyReturnArg))
@@ -183,141 +192,173 @@ PyObject* JMethod_FromJObject(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArg
 }
 
 /**
- * Invoke a method. We have already ensured that the Python arguments and expected Java parameters match.
+ * Calls the Java method with the given, already converted Java arguments and stores the Java return value in result.
+ * objectRef is the Java object the method is called on, it is ignored for static methods.
+ * Returns -1 if a Java exception occurred, which must then be handled by the caller.
+ * Doesn't use the Python API, so it may be called without holding the GIL.
  */
-PyObject* JMethod_InvokeMethod(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs)
+int JMethod_CallJavaMethod(JNIEnv* jenv, JPy_JMethod* method, jobject objectRef, jvalue* jArgs, jvalue* result)
 {
-    jvalue* jArgs;
-    JPy_ArgDisposer* argDisposers;
-    PyObject* returnValue;
-    JPy_JType* declaringClass;
     JPy_JType* returnType;
     jclass classRef;
 
-    //printf("JMethod_InvokeMethod 1: typeCode=%c\n", typeCode);
-    if (JMethod_CreateJArgs(jenv, method, pyArgs, &jArgs, &argDisposers) < 0) {
-        return NULL;
-    }
-
-    //printf("JMethod_InvokeMethod 2: typeCode=%c\n", typeCode);
-
     returnType = method->returnDescriptor->type;
-    returnValue = NULL;
-    declaringClass = method->declaringClass;
-    classRef = declaringClass->classRef;
+    classRef = method->declaringClass->classRef;
 
     if (method->isStatic) {
-
-        JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_InvokeMethod: calling static Java method %s#%s\n", declaringClass->javaName, JPy_AS_UTF8(method->name));
-
         if (returnType == JPy_JVoid) {
             (*jenv)->CallStaticVoidMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JVOID();
         } else if (returnType == JPy_JBoolean) {
-            jboolean v = (*jenv)->CallStaticBooleanMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JBOOLEAN(v);
+            result->z = (*jenv)->CallStaticBooleanMethodA(jenv, classRef, method->mid, jArgs);
         } else if (returnType == JPy_JChar) {
-            jchar v = (*jenv)->CallStaticCharMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JCHAR(v);
+            result->c = (*jenv)->CallStaticCharMethodA(jenv, classRef, method->mid, jArgs);
         } else if (returnType == JPy_JByte) {
-            jbyte v = (*jenv)->CallStaticByteMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JBYTE(v);
+            result->b = (*jenv)->CallStaticByteMethodA(jenv, classRef, method->mid, jArgs);
         } else if (returnType == JPy_JShort) {
-            jshort v = (*jenv)->CallStaticShortMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JSHORT(v);
+            result->s = (*jenv)->CallStaticShortMethodA(jenv, classRef, method->mid, jArgs);
         } else if (returnType == JPy_JInt) {
-            jint v = (*jenv)->CallStaticIntMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JINT(v);
+            result->i = (*jenv)->CallStaticIntMethodA(jenv, classRef, method->mid, jArgs);
         } else if (returnType == JPy_JLong) {
-            jlong v = (*jenv)->CallStaticIntMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JLONG(v);
+            result->j = (*jenv)->CallStaticLongMethodA(jenv, classRef, method->mid, jArgs);
         } else if (returnType == JPy_JFloat) {
-            jfloat v = (*jenv)->CallStaticFloatMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JFLOAT(v);
+            result->f = (*jenv)->CallStaticFloatMethodA(jenv, classRef, method->mid, jArgs);
         } else if (returnType == JPy_JDouble) {
-            jdouble v = (*jenv)->CallStaticDoubleMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JDOUBLE(v);
-        } else if (returnType == JPy_JString) {
-            jstring v = (*jenv)->CallStaticObjectMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FromJString(jenv, v);
-            (*jenv)->DeleteLocalRef(jenv, v);
+            result->d = (*jenv)->CallStaticDoubleMethodA(jenv, classRef, method->mid, jArgs);
         } else {
-            jobject v = (*jenv)->CallStaticObjectMethodA(jenv, classRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JMethod_FromJObject(jenv, method, pyArgs, jArgs, 0, returnType, v);
-            (*jenv)->DeleteLocalRef(jenv, v);
+            result->l = (*jenv)->CallStaticObjectMethodA(jenv, classRef, method->mid, jArgs);
         }
-
     } else {
-        jobject objectRef;
-        PyObject* self;
-
-        JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_InvokeMethod: calling Java method %s#%s\n", declaringClass->javaName, JPy_AS_UTF8(method->name));
-
-        self = PyTuple_GetItem(pyArgs, 0);
-        // Note it is already ensured that self is a JPy_JObj*
-        objectRef = ((JPy_JObj*) self)->objectRef;
-
         if (returnType == JPy_JVoid) {
             (*jenv)->CallVoidMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JVOID();
         } else if (returnType == JPy_JBoolean) {
-            jboolean v = (*jenv)->CallBooleanMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JBOOLEAN(v);
+            result->z = (*jenv)->CallBooleanMethodA(jenv, objectRef, method->mid, jArgs);
         } else if (returnType == JPy_JChar) {
-            jchar v = (*jenv)->CallCharMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JCHAR(v);
+            result->c = (*jenv)->CallCharMethodA(jenv, objectRef, method->mid, jArgs);
         } else if (returnType == JPy_JByte) {
-            jbyte v = (*jenv)->CallByteMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JBYTE(v);
+            result->b = (*jenv)->CallByteMethodA(jenv, objectRef, method->mid, jArgs);
         } else if (returnType == JPy_JShort) {
-            jshort v = (*jenv)->CallShortMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JSHORT(v);
+            result->s = (*jenv)->CallShortMethodA(jenv, objectRef, method->mid, jArgs);
         } else if (returnType == JPy_JInt) {
-            jint v = (*jenv)->CallIntMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JINT(v);
+            result->i = (*jenv)->CallIntMethodA(jenv, objectRef, method->mid, jArgs);
         } else if (returnType == JPy_JLong) {
-            jlong v = (*jenv)->CallIntMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JLONG(v);
+            result->j = (*jenv)->CallLongMethodA(jenv, objectRef, method->mid, jArgs);
         } else if (returnType == JPy_JFloat) {
-            jfloat v = (*jenv)->CallFloatMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JFLOAT(v);
+            result->f = (*jenv)->CallFloatMethodA(jenv, objectRef, method->mid, jArgs);
         } else if (returnType == JPy_JDouble) {
-            jdouble v = (*jenv)->CallDoubleMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FROM_JDOUBLE(v);
-        } else if (returnType == JPy_JString) {
-            jstring v = (*jenv)->CallObjectMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JPy_FromJString(jenv, v);
-            (*jenv)->DeleteLocalRef(jenv, v);
+            result->d = (*jenv)->CallDoubleMethodA(jenv, objectRef, method->mid, jArgs);
         } else {
-            jobject v = (*jenv)->CallObjectMethodA(jenv, objectRef, method->mid, jArgs);
-            JPy_ON_JAVA_EXCEPTION_GOTO(error);
-            returnValue = JMethod_FromJObject(jenv, method, pyArgs, jArgs, 1, returnType, v);
-            (*jenv)->DeleteLocalRef(jenv, v);
+            result->l = (*jenv)->CallObjectMethodA(jenv, objectRef, method->mid, jArgs);
         }
     }
 
-error:
+    return (*jenv)->ExceptionCheck(jenv) ? -1 : 0;
+}
+
+/**
+ * Converts the object returned by a method call according to the method's return policy, which is not
+ * JPy_RETURN_POLICY_WRAPPER. The returned object is unpacked right away, so no Java object wrapper and
+ * no global reference are created for it. JMethod_set_return_policy() has ensured that the policy fits
+ * the return type.
+ */
+static PyObject* JMethod_FromJObjectWithPolicy(JNIEnv* jenv, JPy_ReturnDescriptor* returnDescriptor, jobject objectRef)
+{
+    JPy_JType* returnType;
+
+    if (objectRef == NULL) {
+        return JPy_FROM_JNULL();
+    }
+
+    returnType = returnDescriptor->type;
+    if (returnDescriptor->policy == JPy_RETURN_POLICY_BYTES) {
+        return JArray_ToBytes(jenv, objectRef);
+    } else if (returnDescriptor->policy == JPy_RETURN_POLICY_NUMPY) {
+        return JArray_CopyToNumPy(jenv, returnType, objectRef);
+    } else if (returnDescriptor->policy == JPy_RETURN_POLICY_LIST) {
+        if (returnType->componentType != NULL) {
+            return JArray_ToList(jenv, returnType, objectRef);
+        }
+        return JColl_ToPythonList(jenv, objectRef);
+    } else {
+        return JColl_ToPythonDict(jenv, objectRef);
+    }
+}
+
+/**
+ * Converts the Java return value of a method call obtained from JMethod_CallJavaMethod() into a Python object.
+ * The local reference of an object return value is deleted.
+ * pyArgs and jArgs are the arguments of the call, they are only used for object return values.
+ */
+PyObject* JMethod_FromJValue(JNIEnv* jenv, JPy_JMethod* method, PyObject* const* pyArgs, jvalue* jArgs, jvalue* result)
+{
+    JPy_JType* returnType;
+    PyObject* returnValue;
+
+    returnType = method->returnDescriptor->type;
+
+    if (returnType == JPy_JVoid) {
+        return JPy_FROM_JVOID();
+    } else if (returnType == JPy_JBoolean) {
+        return JPy_FROM_JBOOLEAN(result->z);
+    } else if (returnType == JPy_JChar) {
+        return JPy_FROM_JCHAR(result->c);
+    } else if (returnType == JPy_JByte) {
+        return JPy_FROM_JBYTE(result->b);
+    } else if (returnType == JPy_JShort) {
+        return JPy_FROM_JSHORT(result->s);
+    } else if (returnType == JPy_JInt) {
+        return JPy_FROM_JINT(result->i);
+    } else if (returnType == JPy_JLong) {
+        return JPy_FROM_JLONG(result->j);
+    } else if (returnType == JPy_JFloat) {
+        return JPy_FROM_JFLOAT(result->f);
+    } else if (returnType == JPy_JDouble) {
+        return JPy_FROM_JDOUBLE(result->d);
+    } else if (returnType == JPy_JString) {
+        returnValue = JPy_FromJString(jenv, result->l);
+        (*jenv)->DeleteLocalRef(jenv, result->l);
+        return returnValue;
+    } else if (method->returnDescriptor->policy != JPy_RETURN_POLICY_WRAPPER) {
+        returnValue = JMethod_FromJObjectWithPolicy(jenv, method->returnDescriptor, result->l);
+        (*jenv)->DeleteLocalRef(jenv, result->l);
+        return returnValue;
+    } else {
+        returnValue = JMethod_FromJObject(jenv, method, pyArgs, jArgs, method->isStatic ? 0 : 1, returnType, result->l);
+        (*jenv)->DeleteLocalRef(jenv, result->l);
+        return returnValue;
+    }
+}
+
+/**
+ * Invoke a method. We have already ensured that the Python arguments and expected Java parameters match.
+ */
+PyObject* JMethod_InvokeMethod(JNIEnv* jenv, JPy_JMethod* method, int argCount, PyObject* const* pyArgs)
+{
+    jvalue* jArgs;
+    JPy_ArgDisposer* argDisposers;
+    PyObject* returnValue;
+    jobject objectRef;
+    jvalue result;
+
+    if (JMethod_CreateJArgs(jenv, method, argCount, pyArgs, &jArgs, &argDisposers) < 0) {
+        return NULL;
+    }
+
+    if (method->isStatic) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_InvokeMethod: calling static Java method %s#%s\n", method->declaringClass->javaName, JPy_AS_UTF8(method->name));
+        objectRef = NULL;
+    } else {
+        JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_InvokeMethod: calling Java method %s#%s\n", method->declaringClass->javaName, JPy_AS_UTF8(method->name));
+        // Note it is already ensured that self is a JPy_JObj*
+        objectRef = ((JPy_JObj*) pyArgs[0])->objectRef;
+    }
+
+    if (JMethod_CallJavaMethod(jenv, method, objectRef, jArgs, &result) < 0) {
+        JPy_HandleJavaException(jenv);
+        returnValue = NULL;
+    } else {
+        returnValue = JMethod_FromJValue(jenv, method, pyArgs, jArgs, &result);
+    }
+
     if (jArgs != NULL) {
         JMethod_DisposeJArgs(jenv, method->paramCount, jArgs, argDisposers);
     }
@@ -325,14 +366,52 @@ error:
     return returnValue;
 }
 
-int JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs, jvalue** argValuesRet, JPy_ArgDisposer** argDisposersRet)
+/**
+ * Converts the Python arguments into the given arrays of Java arguments and argument disposers, which both have
+ * method->paramCount elements. If the conversion fails, the arguments converted so far are disposed.
+ */
+int JMethod_ConvertPyArgs(JNIEnv* jenv, JPy_JMethod* method, int argCount, PyObject* const* pyArgs, jvalue* jValues, JPy_ArgDisposer* argDisposers)
 {
     JPy_ParamDescriptor* paramDescriptor;
-    int i, i0, argCount;
+    int i, i0;
     PyObject* pyArg;
     jvalue* jValue;
-    jvalue* jValues;
     JPy_ArgDisposer* argDisposer;
+
+    i0 = argCount - method->paramCount;
+    if (!(i0 == 0 || i0 == 1)) {
+        PyErr_SetString(PyExc_RuntimeError, "internal error");
+        return -1;
+    }
+
+    paramDescriptor = method->paramDescriptors;
+    jValue = jValues;
+    argDisposer = argDisposers;
+    for (i = i0; i < argCount; i++) {
+        pyArg = pyArgs[i];
+        jValue->l = 0;
+        argDisposer->data = NULL;
+        argDisposer->DisposeArg = NULL;
+        if (paramDescriptor->ConvertPyArg(jenv, paramDescriptor, pyArg, jValue, argDisposer) < 0) {
+            JMethod_DisposeJArgValues(jenv, i - i0, jValues, argDisposers);
+            return -1;
+        }
+        if (PyErr_Occurred()) {
+            // Converters of primitive types only signal invalid arguments through the Python error indicator
+            JMethod_DisposeJArgValues(jenv, i - i0 + 1, jValues, argDisposers);
+            return -1;
+        }
+        paramDescriptor++;
+        jValue++;
+        argDisposer++;
+    }
+
+    return 0;
+}
+
+int JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* method, int argCount, PyObject* const* pyArgs, jvalue** argValuesRet, JPy_ArgDisposer** argDisposersRet)
+{
+    jvalue* jValues;
     JPy_ArgDisposer* argDisposers;
 
     if (method->paramCount == 0) {
@@ -341,14 +420,6 @@ int JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs, jva
         return 0;
     }
 
-    argCount = PyTuple_Size(pyArgs);
-
-    i0 = argCount - method->paramCount;
-    if (!(i0 == 0 || i0 == 1)) {
-        PyErr_SetString(PyExc_RuntimeError, "internal error");
-        return -1;
-    }
-
     jValues = PyMem_New(jvalue, method->paramCount);
     if (jValues == NULL) {
         PyErr_NoMemory();
@@ -362,22 +433,10 @@ int JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs, jva
         return -1;
     }
 
-    paramDescriptor = method->paramDescriptors;
-    jValue = jValues;
-    argDisposer = argDisposers;
-    for (i = i0; i < argCount; i++) {
-        pyArg = PyTuple_GetItem(pyArgs, i);
-        jValue->l = 0;
-        argDisposer->data = NULL;
-        argDisposer->DisposeArg = NULL;
-        if (paramDescriptor->ConvertPyArg(jenv, paramDescriptor, pyArg, jValue, argDisposer) < 0) {
-            PyMem_Del(jValues);
-            PyMem_Del(argDisposers);
-            return -1;
-        }
-        paramDescriptor++;
-        jValue++;
-        argDisposer++;
+    if (JMethod_ConvertPyArgs(jenv, method, argCount, pyArgs, jValues, argDisposers) < 0) {
+        PyMem_Del(jValues);
+        PyMem_Del(argDisposers);
+        return -1;
     }
 
     *argValuesRet = jValues;
@@ -385,7 +444,10 @@ int JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* method, PyObject* pyArgs, jva
     return 0;
 }
 
-void JMethod_DisposeJArgs(JNIEnv* jenv, int paramCount, jvalue* jArgs, JPy_ArgDisposer* argDisposers)
+/**
+ * Disposes the first argCount Java arguments, but not the arrays holding them.
+ */
+void JMethod_DisposeJArgValues(JNIEnv* jenv, int argCount, jvalue* jArgs, JPy_ArgDisposer* argDisposers)
 {
     jvalue* jArg;
     JPy_ArgDisposer* argDisposer;
@@ -394,14 +456,18 @@ void JMethod_DisposeJArgs(JNIEnv* jenv, int paramCount, jvalue* jArgs, JPy_ArgDi
     jArg = jArgs;
     argDisposer = argDisposers;
 
-    for (index = 0; index < paramCount; index++) {
+    for (index = 0; index < argCount; index++) {
         if (argDisposer->DisposeArg != NULL) {
             argDisposer->DisposeArg(jenv, jArg, argDisposer->data);
         }
         jArg++;
         argDisposer++;
     }
+}
 
+void JMethod_DisposeJArgs(JNIEnv* jenv, int paramCount, jvalue* jArgs, JPy_ArgDisposer* argDisposers)
+{
+    JMethod_DisposeJArgValues(jenv, paramCount, jArgs, argDisposers);
     PyMem_Del(jArgs);
     PyMem_Del(argDisposers);
 }
@@ -546,222 +612,1127 @@ PyObject* JMethod_set_param_return(JPy_JMethod* self, PyObject* args)
     return Py_BuildValue("");
 }
 
+/**
+ * The names of the return policies, indexed by the JPy_RETURN_POLICY_* values.
+ */
+static const char* JMethod_ReturnPolicyNames[] = {"wrapper", "bytes", "numpy", "list", "dict"};
 
-static PyMethodDef JMethod_methods[] =
-{
-    {"get_param_type",    (PyCFunction) JMethod_get_param_type,    METH_VARARGS, "Gets the type of the parameter given by index"},
-    {"is_param_mutable",  (PyCFunction) JMethod_is_param_mutable,  METH_VARARGS, "Tests if the method parameter given by index is mutable"},
-    {"is_param_output",   (PyCFunction) JMethod_is_param_output,   METH_VARARGS, "Tests if the method parameter given by index is a mere output value (and not read from)"},
-    {"is_param_return",   (PyCFunction) JMethod_is_param_return,   METH_VARARGS, "Tests if the method parameter given by index is the return value"},
-    {"set_param_mutable", (PyCFunction) JMethod_set_param_mutable, METH_VARARGS, "Sets whether the method parameter given by index is mutable"},
-    {"set_param_output",  (PyCFunction) JMethod_set_param_output,  METH_VARARGS, "Sets whether the method parameter given by index is a mere output value (and not read from)"},
-    {"set_param_return",  (PyCFunction) JMethod_set_param_return,  METH_VARARGS, "Sets whether the method parameter given by index is the return value"},
-    {NULL}  /* Sentinel */
-};
+#define JMethod_RETURN_POLICY_COUNT ((int) (sizeof(JMethod_ReturnPolicyNames) / sizeof(JMethod_ReturnPolicyNames[0])))
 
 /**
- * Implements the BeamPy_JObjectType class singleton.
+ * Tests if the given return policy can be applied to objects of the given return type.
  */
-PyTypeObject JMethod_Type = {
-    PyVarObject_HEAD_INIT(NULL, 0)
-    "jpy.JMethod",                /* tp_name */
-    sizeof (JPy_JMethod),         /* tp_basicsize */
-    0,                            /* tp_itemsize */
-    (destructor)JMethod_dealloc,  /* tp_dealloc */
-    NULL,                         /* tp_print */
-    NULL,                         /* tp_getattr */
-    NULL,                         /* tp_setattr */
-    NULL,                         /* tp_reserved */
-    (reprfunc)JMethod_repr,       /* tp_repr */
-    NULL,                         /* tp_as_number */
-    NULL,                         /* tp_as_sequence */
-    NULL,                         /* tp_as_mapping */
-    NULL,                         /* tp_hash  */
-    NULL,                         /* tp_call */
-    (reprfunc)JMethod_str,        /* tp_str */
-    NULL,                         /* tp_getattro */
-    NULL,                         /* tp_setattro */
-    NULL,                         /* tp_as_buffer */
-    Py_TPFLAGS_DEFAULT,           /* tp_flags */
-    "Java Method Wrapper",        /* tp_doc */
-    NULL,                         /* tp_traverse */
-    NULL,                         /* tp_clear */
-    NULL,                         /* tp_richcompare */
-    0,                            /* tp_weaklistoffset */
-    NULL,                         /* tp_iter */
-    NULL,                         /* tp_iternext */
-    JMethod_methods,              /* tp_methods */
-    JMethod_members,              /* tp_members */
-    NULL,                         /* tp_getset */
-    NULL,                         /* tp_base */
-    NULL,                         /* tp_dict */
-    NULL,                         /* tp_descr_get */
-    NULL,                         /* tp_descr_set */
-    0,                            /* tp_dictoffset */
-    NULL,                         /* tp_init */
-    NULL,                         /* tp_alloc */
-    NULL,                         /* tp_new */
-};
-
-//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-//  JOverloadedMethod
+static jboolean JMethod_IsReturnPolicyApplicable(JNIEnv* jenv, JPy_JType* returnType, int policy)
+{
+    JPy_JType* componentType;
+
+    componentType = returnType->componentType;
+    if (policy == JPy_RETURN_POLICY_WRAPPER) {
+        return JNI_TRUE;
+    } else if (policy == JPy_RETURN_POLICY_BYTES) {
+        return componentType == JPy_JByte;
+    } else if (policy == JPy_RETURN_POLICY_NUMPY) {
+        return componentType != NULL && (componentType->isPrimitive
+                                         || (componentType->componentType != NULL && componentType->componentType->isPrimitive));
+    } else if (policy == JPy_RETURN_POLICY_LIST) {
+        return componentType != NULL || (*jenv)->IsAssignableFrom(jenv, returnType->classRef, JPy_Collection_JClass);
+    } else {
+        return (*jenv)->IsAssignableFrom(jenv, returnType->classRef, JPy_Map_JClass);
+    }
+}
 
-typedef struct JPy_MethodFindResult
+PyObject* JMethod_get_return_policy(JPy_JMethod* self)
 {
-    JPy_JMethod* method;
-    int matchValue;
-    int matchCount;
+    if (self->returnDescriptor == NULL) {
+        return JPy_FROM_JNULL();
+    }
+    return JPy_FROM_CSTR(JMethod_ReturnPolicyNames[self->returnDescriptor->policy]);
 }
-JPy_MethodFindResult;
 
-JPy_JMethod* JOverloadedMethod_FindMethod0(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, PyObject* pyArgs, JPy_MethodFindResult* result)
+PyObject* JMethod_set_return_policy(JPy_JMethod* self, PyObject* args)
 {
-    int overloadCount;
-    int argCount;
-    int matchCount;
-    int matchValue;
-    int matchValueMax;
-    JPy_JMethod* currMethod;
-    JPy_JMethod* bestMethod;
-    int i;
+    JNIEnv* jenv;
+    const char* name = NULL;
+    int policy;
 
-    result->method = NULL;
-    result->matchValue = 0;
-    result->matchCount = 0;
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
 
-    overloadCount = PyList_Size(overloadedMethod->methodList);
-    if (overloadCount <= 0) {
-        PyErr_SetString(PyExc_RuntimeError, "internal error: invalid overloadedMethod->methodList");
+    if (!PyArg_ParseTuple(args, "s:set_return_policy", &name)) {
         return NULL;
     }
+    for (policy = 0; policy < JMethod_RETURN_POLICY_COUNT; policy++) {
+        if (strcmp(name, JMethod_ReturnPolicyNames[policy]) == 0) {
+            break;
+        }
+    }
+    if (policy == JMethod_RETURN_POLICY_COUNT) {
+        PyErr_Format(PyExc_ValueError, "unknown return policy '%s', expected 'wrapper', 'bytes', 'numpy', 'list' or 'dict'", name);
+        return NULL;
+    }
+    if (self->returnDescriptor == NULL) {
+        PyErr_Format(PyExc_ValueError, "Java constructor of '%s' has no return policy", self->declaringClass->javaName);
+        return NULL;
+    }
+    if (!JMethod_IsReturnPolicyApplicable(jenv, self->returnDescriptor->type, policy)) {
+        PyErr_Format(PyExc_ValueError, "return policy '%s' is not applicable to return type '%s' of Java method '%s'",
+                     name, self->returnDescriptor->type->javaName, JPy_AS_UTF8(self->name));
+        return NULL;
+    }
+    self->returnDescriptor->policy = policy;
+    return Py_BuildValue("");
+}
 
-    argCount = PyTuple_Size(pyArgs);
-    matchCount = 0;
-    matchValueMax = -1;
-    bestMethod = NULL;
-
-    JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_FindMethod0: method '%s#%s': overloadCount=%d\n",
-                              overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name), overloadCount);
-
-    for (i = 0; i < overloadCount; i++) {
-        currMethod = (JPy_JMethod*) PyList_GetItem(overloadedMethod->methodList, i);
-        matchValue = JMethod_MatchPyArgs(jenv, overloadedMethod->declaringClass, currMethod, argCount, pyArgs);
+/**
+ * Checks the given argument vector before the method is called without overload resolution.
+ * Only the argument count and the types of Java object arguments are checked here, because JNI does not check
+ * them at all. All other arguments are checked by the parameter's argument converter.
+ */
+int JMethod_CheckPyArgs(JNIEnv* jenv, JPy_JMethod* method, int argCount, PyObject* const* pyArgs)
+{
+    JPy_JType* paramType;
+    PyObject* pyArg;
+    int i0;
+    int i;
 
-        JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_FindMethod0: methodList[%d]: paramCount=%d, matchValue=%d\n", i,
-                                  currMethod->paramCount, matchValue);
+    i0 = method->isStatic ? 0 : 1;
+    if (argCount != method->paramCount + i0) {
+        PyErr_Format(PyExc_TypeError, "Java method '%s' takes %d argument(s) (%d given)",
+                     JPy_AS_UTF8(method->name), method->paramCount + i0, argCount);
+        return -1;
+    }
 
-        if (matchValue > 0) {
-            if (matchValue > matchValueMax) {
-                matchValueMax = matchValue;
-                bestMethod = currMethod;
-                matchCount = 1;
-            } else if (matchValue == matchValueMax) {
-                matchCount++;
-            }
-            if (matchValue >= 100 * argCount) {
-                // we can't get any better (if so, we have an internal problem)
-                break;
-            }
+    if (!method->isStatic) {
+        pyArg = pyArgs[0];
+        if (!JObj_Check(pyArg)
+            || (Py_TYPE(pyArg) != (PyTypeObject*) method->declaringClass
+                && !(*jenv)->IsInstanceOf(jenv, ((JPy_JObj*) pyArg)->objectRef, method->declaringClass->classRef))) {
+            PyErr_Format(PyExc_TypeError, "Java method '%s' must be called on an instance of '%s', got '%s'",
+                         JPy_AS_UTF8(method->name), method->declaringClass->javaName, Py_TYPE(pyArg)->tp_name);
+            return -1;
         }
     }
 
-    if (bestMethod == NULL) {
-        matchValueMax = 0;
-        matchCount = 0;
+    for (i = 0; i < method->paramCount; i++) {
+        paramType = method->paramDescriptors[i].type;
+        pyArg = pyArgs[i + i0];
+        if (!paramType->isPrimitive && JObj_Check(pyArg)
+            && Py_TYPE(pyArg) != (PyTypeObject*) paramType
+            && !(*jenv)->IsInstanceOf(jenv, ((JPy_JObj*) pyArg)->objectRef, paramType->classRef)) {
+            PyErr_Format(PyExc_TypeError, "Java method '%s': argument %d must be of type '%s', got '%s'",
+                         JPy_AS_UTF8(method->name), i + 1, paramType->javaName, Py_TYPE(pyArg)->tp_name);
+            return -1;
+        }
     }
 
-    result->method = bestMethod;
-    result->matchValue = matchValueMax;
-    result->matchCount = matchCount;
-
-    return bestMethod;
+    return 0;
 }
 
-JPy_JMethod* JOverloadedMethod_FindMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, PyObject* pyArgs, jboolean visitSuperClass)
+/**
+ * Invokes the method for the given argument vector without overload resolution.
+ * For instance methods, args[0] is the Java object the method is called on.
+ */
+PyObject* JMethod_Invoke(JPy_JMethod* self, int argCount, PyObject* const* args)
 {
-    JPy_JOverloadedMethod* currentOM;
-    JPy_MethodFindResult result;
-    JPy_MethodFindResult bestResult;
-    JPy_JType* superClass;
-    PyObject* superOM;
+    JNIEnv* jenv;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    if (JMethod_CheckPyArgs(jenv, self, argCount, args) < 0) {
+        return NULL;
+    }
+
+    return JMethod_InvokeMethod(jenv, self, argCount, args);
+}
+
+/**
+ * The 'JMethod' type's tp_call slot. Calls the Java method directly, see JOverloadedMethod.select() and jpy.get_method().
+ */
+PyObject* JMethod_call(JPy_JMethod* self, PyObject *args, PyObject *kw)
+{
+    return JMethod_Invoke(self, (int) PyTuple_GET_SIZE(args), JPy_TUPLE_ITEMS(args));
+}
+
+#if defined(JPY_COMPAT_VECTORCALL)
+/**
+ * The 'JMethod' type's vectorcall function (PEP 590), see JOverloadedMethod_vectorcall().
+ */
+PyObject* JMethod_vectorcall(JPy_JMethod* self, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+{
+    return JMethod_Invoke(self, (int) PyVectorcall_NARGS(nargsf), args);
+}
+#endif
+
+/**
+ * The 'JMethod' type's tp_descr_get slot, see JOverloadedMethod_descr_get().
+ */
+PyObject* JMethod_descr_get(PyObject* self, PyObject* obj, PyObject* type)
+{
+    if (obj == NULL || obj == Py_None) {
+        Py_INCREF(self);
+        return self;
+    }
+    return JPy_METHOD_NEW(self, obj, type);
+}
+
+/**
+ * Matches the given JNI type descriptor, e.g. "I" or "Ljava/lang/String;", against the given type.
+ * Returns a pointer to the character following the descriptor or NULL, if it doesn't match.
+ */
+const char* JMethod_MatchTypeDescriptor(const char* descriptor, JPy_JType* type)
+{
+    const char* name;
+    char c;
+
+    if (type->isPrimitive) {
+        if (type == JPy_JBoolean) c = 'Z';
+        else if (type == JPy_JChar) c = 'C';
+        else if (type == JPy_JByte) c = 'B';
+        else if (type == JPy_JShort) c = 'S';
+        else if (type == JPy_JInt) c = 'I';
+        else if (type == JPy_JLong) c = 'J';
+        else if (type == JPy_JFloat) c = 'F';
+        else if (type == JPy_JDouble) c = 'D';
+        else c = 'V';
+        return *descriptor == c ? descriptor + 1 : NULL;
+    }
+
+    // Array type names are already given as descriptors, e.g. "[I" or "[Ljava.lang.String;"
+    name = type->javaName;
+    if (name[0] != '[') {
+        if (*descriptor++ != 'L') {
+            return NULL;
+        }
+    }
+    for (; *name != 0; name++, descriptor++) {
+        if (*descriptor != (*name == '.' ? '/' : *name)) {
+            return NULL;
+        }
+    }
+    if (type->javaName[0] != '[') {
+        if (*descriptor++ != ';') {
+            return NULL;
+        }
+    }
+    return descriptor;
+}
+
+/**
+ * Tests if the given JNI method signature, e.g. "(ILjava/lang/String;)V", matches the method's parameter types.
+ * The return type may be omitted from the signature, e.g. "(ILjava/lang/String;)".
+ */
+jboolean JMethod_MatchesSignature(JPy_JMethod* method, const char* signature)
+{
+    const char* s;
+    int i;
+
+    s = signature;
+    if (*s++ != '(') {
+        return JNI_FALSE;
+    }
+    for (i = 0; i < method->paramCount; i++) {
+        s = JMethod_MatchTypeDescriptor(s, method->paramDescriptors[i].type);
+        if (s == NULL) {
+            return JNI_FALSE;
+        }
+    }
+    if (*s++ != ')') {
+        return JNI_FALSE;
+    }
+    if (*s == 0) {
+        return JNI_TRUE;
+    }
+    if (method->returnDescriptor == NULL) {
+        return JNI_FALSE;
+    }
+    s = JMethod_MatchTypeDescriptor(s, method->returnDescriptor->type);
+    return s != NULL && *s == 0;
+}
+
+/**
+ * Gets the argument vector of a call made by JMethod_Map(): the object self (if not NULL) followed by the items of
+ * the argument tuple item or by item itself, if it is not a tuple. The argument vector grows as needed.
+ * Returns the argument count or -1 on error.
+ */
+int JMethod_GetMapArgs(PyObject* self, PyObject* item, PyObject*** argVector, int* argCapacity)
+{
+    PyObject** newVector;
     int argCount;
+    int i0;
+    int i;
+
+    i0 = self != NULL ? 1 : 0;
+    argCount = i0 + (PyTuple_Check(item) ? (int) PyTuple_GET_SIZE(item) : 1);
+    if (argCount > *argCapacity) {
+        newVector = (PyObject**) PyMem_Realloc(*argVector, argCount * sizeof (PyObject*));
+        if (newVector == NULL) {
+            PyErr_NoMemory();
+            return -1;
+        }
+        *argVector = newVector;
+        *argCapacity = argCount;
+    }
+
+    if (self != NULL) {
+        (*argVector)[0] = self;
+    }
+    if (PyTuple_Check(item)) {
+        for (i = i0; i < argCount; i++) {
+            (*argVector)[i] = PyTuple_GET_ITEM(item, i - i0);
+        }
+    } else {
+        (*argVector)[i0] = item;
+    }
+    return argCount;
+}
+
+/**
+ * Tests if all parameters and the return value of the given method are of primitive types (or void).
+ */
+jboolean JMethod_IsPrimitiveOnly(JPy_JMethod* method)
+{
+    int i;
+
+    if (!method->returnDescriptor->type->isPrimitive) {
+        return JNI_FALSE;
+    }
+    for (i = 0; i < method->paramCount; i++) {
+        if (!method->paramDescriptors[i].type->isPrimitive) {
+            return JNI_FALSE;
+        }
+    }
+    return JNI_TRUE;
+}
+
+/**
+ * Implements JMethod_Map() for a method which only has primitive parameters and return type:
+ * all arguments are converted first, then the Java method is called for all of them without holding the GIL.
+ * The results are stored in buf if javaType is given, otherwise in resultList.
+ */
+int JMethod_MapWithoutGIL(JNIEnv* jenv, JPy_JMethod* method, PyObject* self, PyObject* items, char javaType, void* buf, PyObject* resultList)
+{
+    Py_ssize_t itemCount;
+    Py_ssize_t i;
+    int paramCount;
+    int argCount;
+    int argCapacity;
+    PyObject** argVector;
+    jvalue* allArgs;
+    jobject* objectRefs;
+    jvalue* results;
+    JPy_ArgDisposer* argDisposers;
+    PyObject* pyResult;
+    int status;
+
+    itemCount = PyTuple_GET_SIZE(items);
+    paramCount = method->paramCount;
+    argVector = NULL;
+    argCapacity = 0;
+    status = -1;
+
+    allArgs = PyMem_New(jvalue, itemCount * paramCount + 1);
+    objectRefs = PyMem_New(jobject, itemCount + 1);
+    results = PyMem_New(jvalue, itemCount + 1);
+    argDisposers = PyMem_New(JPy_ArgDisposer, paramCount + 1);
+    if (allArgs == NULL || objectRefs == NULL || results == NULL || argDisposers == NULL) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    // Arguments of primitive types have no disposers, so argDisposers can be reused
+    for (i = 0; i < itemCount; i++) {
+        argCount = JMethod_GetMapArgs(self, PyTuple_GET_ITEM(items, i), &argVector, &argCapacity);
+        if (argCount < 0
+            || JMethod_CheckPyArgs(jenv, method, argCount, argVector) < 0
+            || JMethod_ConvertPyArgs(jenv, method, argCount, argVector, allArgs + i * paramCount, argDisposers) < 0) {
+            goto done;
+        }
+        // The object is referenced by items, so its global reference stays valid
+        objectRefs[i] = method->isStatic ? NULL : ((JPy_JObj*) argVector[0])->objectRef;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_MapWithoutGIL: calling Java method %s#%s %d times\n", method->declaringClass->javaName, JPy_AS_UTF8(method->name), (int) itemCount);
+
+    Py_BEGIN_ALLOW_THREADS
+    for (i = 0; i < itemCount; i++) {
+        if (JMethod_CallJavaMethod(jenv, method, objectRefs[i], allArgs + i * paramCount, results + i) < 0) {
+            break;
+        }
+    }
+    Py_END_ALLOW_THREADS
+
+    if (i < itemCount) {
+        JPy_HandleJavaException(jenv);
+        goto done;
+    }
+
+    for (i = 0; i < itemCount; i++) {
+        if (javaType != 0) {
+            JArray_StoreJValue(javaType, buf, i, results + i);
+        } else {
+            pyResult = JMethod_FromJValue(jenv, method, NULL, NULL, results + i);
+            if (pyResult == NULL) {
+                goto done;
+            }
+            PyList_SET_ITEM(resultList, i, pyResult);
+        }
+    }
+    status = 0;
+
+done:
+    PyMem_Del(argVector);
+    PyMem_Del(allArgs);
+    PyMem_Del(objectRefs);
+    PyMem_Del(results);
+    PyMem_Del(argDisposers);
+    return status;
+}
+
+/**
+ * Calls the given method for every item of the sequence argsSeq, which are argument tuples or single arguments.
+ * The method is either a JMethod, a JOverloadedMethod, or one of both bound to a Java object. The overload of a
+ * JOverloadedMethod is resolved only once, for the first item. The Java argument buffers are reused for all calls.
+ * Returns a list of results or, if asNumPy is set, a numpy.ndarray for methods returning a primitive type.
+ * If releaseGIL is set and the method has only primitive parameters and return type, the GIL is released while
+ * the Java method is called for all items.
+ */
+PyObject* JMethod_Map(JNIEnv* jenv, PyObject* callable, PyObject* argsSeq, jboolean asNumPy, jboolean releaseGIL)
+{
+    PyObject* self;
+    PyObject* items;
+    Py_ssize_t itemCount;
+    Py_ssize_t i;
+    JPy_JMethod* method;
+    PyObject** argVector;
+    int argCapacity;
+    int argCount;
+    PyObject* result;
+    PyObject* pyResult;
+    Py_buffer view;
+    char javaType;
+    jvalue* jArgs;
+    JPy_ArgDisposer* argDisposers;
+    jvalue jResult;
+
+    self = NULL;
+    if (PyMethod_Check(callable)) {
+        self = PyMethod_GET_SELF(callable);
+        callable = PyMethod_GET_FUNCTION(callable);
+    }
+    if (!PyObject_TypeCheck(callable, JPy_GetModuleState()->jmethodType) && !PyObject_TypeCheck(callable, JPy_GetModuleState()->joverloadedMethodType)) {
+        PyErr_SetString(PyExc_ValueError, "map: argument 1 (method) must be a Java method");
+        return NULL;
+    }
+
+    // A tuple is immutable, so its items stay alive while the GIL is released
+    items = PySequence_Tuple(argsSeq);
+    if (items == NULL) {
+        return NULL;
+    }
+    itemCount = PyTuple_GET_SIZE(items);
+
+    argVector = NULL;
+    argCapacity = 0;
+    result = NULL;
+    view.obj = NULL;
+    javaType = 0;
+    jArgs = NULL;
+    argDisposers = NULL;
+
+    if (PyObject_TypeCheck(callable, JPy_GetModuleState()->jmethodType)) {
+        method = (JPy_JMethod*) callable;
+    } else if (itemCount > 0) {
+        argCount = JMethod_GetMapArgs(self, PyTuple_GET_ITEM(items, 0), &argVector, &argCapacity);
+        if (argCount < 0) {
+            goto error;
+        }
+        method = JOverloadedMethod_FindMethod(jenv, (JPy_JOverloadedMethod*) callable, argCount, argVector, JNI_TRUE);
+        if (method == NULL) {
+            goto error;
+        }
+    } else {
+        Py_DECREF(items);
+        return PyList_New(0);
+    }
+
+    if (asNumPy) {
+        PyObject* numpy;
+        const char* dtypeName;
+        jint itemSize;
+
+        if (JArray_GetPrimitiveInfo(method->returnDescriptor->type, &javaType, &itemSize, &dtypeName) < 0) {
+            goto error;
+        }
+        numpy = PyImport_ImportModule("numpy");
+        if (numpy == NULL) {
+            goto error;
+        }
+        result = PyObject_CallMethod(numpy, "empty", "(n)s", itemCount, dtypeName);
+        Py_DECREF(numpy);
+        if (result == NULL || PyObject_GetBuffer(result, &view, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0) {
+            goto error;
+        }
+    } else {
+        result = PyList_New(itemCount);
+        if (result == NULL) {
+            goto error;
+        }
+    }
+
+    if (releaseGIL && JMethod_IsPrimitiveOnly(method)) {
+        if (JMethod_MapWithoutGIL(jenv, method, self, items, javaType, view.buf, result) < 0) {
+            goto error;
+        }
+        goto done;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_Map: calling Java method %s#%s %d times\n", method->declaringClass->javaName, JPy_AS_UTF8(method->name), (int) itemCount);
+
+    jArgs = PyMem_New(jvalue, method->paramCount + 1);
+    argDisposers = PyMem_New(JPy_ArgDisposer, method->paramCount + 1);
+    if (jArgs == NULL || argDisposers == NULL) {
+        PyErr_NoMemory();
+        goto error;
+    }
+
+    for (i = 0; i < itemCount; i++) {
+        argCount = JMethod_GetMapArgs(self, PyTuple_GET_ITEM(items, i), &argVector, &argCapacity);
+        if (argCount < 0
+            || JMethod_CheckPyArgs(jenv, method, argCount, argVector) < 0
+            || JMethod_ConvertPyArgs(jenv, method, argCount, argVector, jArgs, argDisposers) < 0) {
+            goto error;
+        }
+        if (JMethod_CallJavaMethod(jenv, method, method->isStatic ? NULL : ((JPy_JObj*) argVector[0])->objectRef, jArgs, &jResult) < 0) {
+            JPy_HandleJavaException(jenv);
+            JMethod_DisposeJArgValues(jenv, method->paramCount, jArgs, argDisposers);
+            goto error;
+        }
+        if (javaType != 0) {
+            JArray_StoreJValue(javaType, view.buf, i, &jResult);
+            pyResult = NULL;
+        } else {
+            pyResult = JMethod_FromJValue(jenv, method, argVector, jArgs, &jResult);
+        }
+        JMethod_DisposeJArgValues(jenv, method->paramCount, jArgs, argDisposers);
+        if (javaType == 0) {
+            if (pyResult == NULL) {
+                goto error;
+            }
+            PyList_SET_ITEM(result, i, pyResult);
+        }
+    }
+
+    goto done;
+
+error:
+    Py_XDECREF(result);
+    result = NULL;
+
+done:
+    if (view.obj != NULL) {
+        PyBuffer_Release(&view);
+    }
+    PyMem_Del(argVector);
+    PyMem_Del(jArgs);
+    PyMem_Del(argDisposers);
+    Py_DECREF(items);
+    return result;
+}
+
+/**
+ * An operand of a vectorized method call: either a 1-D (or 0-D) buffer or a scalar already converted to a Java value.
+ */
+typedef struct
+{
+    // The buffer view, view.obj is NULL for scalar operands
+    Py_buffer view;
+    // The struct format character of the buffer items, 0 for scalar operands
+    char itemCode;
+    // The primitive Java type of the parameter ('Z', 'C', 'B', 'S', 'I', 'J', 'F', 'D')
+    char javaType;
+    // The byte distance between the items used for consecutive calls, 0 for broadcast operands
+    Py_ssize_t stride;
+}
+JMethod_VectorOperand;
+
+/**
+ * Calls the given static method elementwise over the given arguments, which are 1-D buffers (e.g. numpy arrays)
+ * or scalars. Buffers of length 1 and scalars are broadcast against the other arguments. The results are written
+ * into the given 1-D buffer out or, if out is NULL or None, into a new numpy.ndarray. The Java method is called
+ * without holding the GIL.
+ */
+PyObject* JMethod_CallVectorized(JNIEnv* jenv, JPy_JMethod* method, PyObject* args, PyObject* out)
+{
+    JMethod_VectorOperand* operands;
+    jvalue* jArgs;
+    jvalue jResult;
+    JPy_ArgDisposer argDisposer;
+    PyObject* arg;
+    PyObject* result;
+    Py_buffer outView;
+    Py_ssize_t outStride;
+    Py_ssize_t itemCount;
+    Py_ssize_t length;
+    Py_ssize_t i;
+    char returnJavaType;
+    const char* dtypeName;
+    jint itemSize;
+    const char* paramDtypeName;
+    jint paramItemSize;
+    jboolean hasBuffers;
+    int paramCount;
+    int k;
+
+    paramCount = method->paramCount;
+    if (PyTuple_GET_SIZE(args) != paramCount) {
+        PyErr_Format(PyExc_TypeError, "vectorized Java method '%s' takes %d argument(s), %d given",
+                     JPy_AS_UTF8(method->name), paramCount, (int) PyTuple_GET_SIZE(args));
+        return NULL;
+    }
+    if (JArray_GetPrimitiveInfo(method->returnDescriptor->type, &returnJavaType, &itemSize, &dtypeName) < 0) {
+        return NULL;
+    }
+
+    operands = PyMem_New(JMethod_VectorOperand, paramCount + 1);
+    jArgs = PyMem_New(jvalue, paramCount + 1);
+    if (operands == NULL || jArgs == NULL) {
+        PyMem_Del(operands);
+        PyMem_Del(jArgs);
+        return PyErr_NoMemory();
+    }
+    for (k = 0; k < paramCount; k++) {
+        operands[k].view.obj = NULL;
+    }
+    result = NULL;
+    outView.obj = NULL;
+
+    itemCount = -1;
+    hasBuffers = JNI_FALSE;
+    for (k = 0; k < paramCount; k++) {
+        JMethod_VectorOperand* operand = operands + k;
+        JPy_ParamDescriptor* paramDescriptor = method->paramDescriptors + k;
+
+        arg = PyTuple_GET_ITEM(args, k);
+        if (JArray_GetPrimitiveInfo(paramDescriptor->type, &operand->javaType, &paramItemSize, &paramDtypeName) < 0) {
+            goto error;
+        }
+        if (PyObject_CheckBuffer(arg)) {
+            if (PyObject_GetBuffer(arg, &operand->view, PyBUF_STRIDES | PyBUF_FORMAT) < 0) {
+                operand->view.obj = NULL;
+                goto error;
+            }
+            if (operand->view.ndim > 1) {
+                PyErr_Format(PyExc_ValueError, "vectorized Java method '%s': argument %d must be a 1-D buffer", JPy_AS_UTF8(method->name), k + 1);
+                goto error;
+            }
+            operand->itemCode = JArray_GetBufferItemCode(&operand->view);
+            if (operand->itemCode == 0) {
+                PyErr_Format(PyExc_ValueError, "vectorized Java method '%s': argument %d has an unsupported buffer format '%s'",
+                             JPy_AS_UTF8(method->name), k + 1, operand->view.format != NULL ? operand->view.format : "B");
+                goto error;
+            }
+            length = operand->view.ndim == 0 ? 1 : operand->view.shape[0];
+            operand->stride = operand->view.ndim == 0 || length == 1 ? 0 : operand->view.strides[0];
+            if (length != 1) {
+                if (itemCount >= 0 && itemCount != length) {
+                    PyErr_Format(PyExc_ValueError, "vectorized Java method '%s': arguments could not be broadcast together with lengths %d and %d",
+                                 JPy_AS_UTF8(method->name), (int) itemCount, (int) length);
+                    goto error;
+                }
+                itemCount = length;
+            }
+            hasBuffers = JNI_TRUE;
+        } else {
+            operand->itemCode = 0;
+            operand->stride = 0;
+            if (paramDescriptor->ConvertPyArg(jenv, paramDescriptor, arg, jArgs + k, &argDisposer) < 0 || PyErr_Occurred()) {
+                goto error;
+            }
+        }
+    }
+
+    if (!hasBuffers) {
+        // Only scalars given, so this is just a plain call
+        if (JMethod_CallJavaMethod(jenv, method, NULL, jArgs, &jResult) < 0) {
+            JPy_HandleJavaException(jenv);
+            goto error;
+        }
+        result = JMethod_FromJValue(jenv, method, NULL, jArgs, &jResult);
+        goto done;
+    }
+    if (itemCount < 0) {
+        itemCount = 1;
+    }
+
+    if (out != NULL && out != Py_None) {
+        if (PyObject_GetBuffer(out, &outView, PyBUF_WRITABLE | PyBUF_STRIDES | PyBUF_FORMAT) < 0) {
+            outView.obj = NULL;
+            goto error;
+        }
+        if (outView.ndim != 1 || outView.shape[0] != itemCount || !JArray_IsCompatibleBuffer(&outView, returnJavaType, itemSize)) {
+            PyErr_Format(PyExc_ValueError, "vectorized Java method '%s': out must be a 1-D buffer of length %d and type '%s'",
+                         JPy_AS_UTF8(method->name), (int) itemCount, method->returnDescriptor->type->javaName);
+            goto error;
+        }
+        outStride = outView.strides[0];
+        result = out;
+        Py_INCREF(result);
+    } else {
+        PyObject* numpy;
+
+        numpy = PyImport_ImportModule("numpy");
+        if (numpy == NULL) {
+            goto error;
+        }
+        result = PyObject_CallMethod(numpy, "empty", "(n)s", itemCount, dtypeName);
+        Py_DECREF(numpy);
+        if (result == NULL || PyObject_GetBuffer(result, &outView, PyBUF_WRITABLE | PyBUF_C_CONTIGUOUS) < 0) {
+            outView.obj = NULL;
+            goto error;
+        }
+        outStride = itemSize;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_EXEC, "JMethod_CallVectorized: calling Java method %s#%s %d times\n", method->declaringClass->javaName, JPy_AS_UTF8(method->name), (int) itemCount);
+
+    Py_BEGIN_ALLOW_THREADS
+    for (i = 0; i < itemCount; i++) {
+        for (k = 0; k < paramCount; k++) {
+            if (operands[k].itemCode != 0) {
+                JArray_LoadJValue(operands[k].itemCode, (char*) operands[k].view.buf + i * operands[k].stride, operands[k].javaType, jArgs + k);
+            }
+        }
+        if (JMethod_CallJavaMethod(jenv, method, NULL, jArgs, &jResult) < 0) {
+            break;
+        }
+        JArray_StoreJValue(returnJavaType, (char*) outView.buf + i * outStride, 0, &jResult);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (i < itemCount) {
+        JPy_HandleJavaException(jenv);
+        goto error;
+    }
+    goto done;
+
+error:
+    Py_XDECREF(result);
+    result = NULL;
+
+done:
+    for (k = 0; k < paramCount; k++) {
+        if (operands[k].view.obj != NULL) {
+            PyBuffer_Release(&operands[k].view);
+        }
+    }
+    if (outView.obj != NULL) {
+        PyBuffer_Release(&outView);
+    }
+    PyMem_Del(operands);
+    PyMem_Del(jArgs);
+    return result;
+}
+
+PyObject* JMethod_vectorized_call(JPy_JMethod* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    PyObject* out;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    out = NULL;
+    if (kwds != NULL && PyDict_Size(kwds) > 0) {
+        out = PyDict_GetItemString(kwds, "out");
+        if (out == NULL || PyDict_Size(kwds) > 1) {
+            PyErr_SetString(PyExc_TypeError, "vectorized Java method: 'out' is the only keyword argument supported");
+            return NULL;
+        }
+    }
+    return JMethod_CallVectorized(jenv, self, args, out);
+}
+
+static PyMethodDef JMethod_vectorized_def =
+    {"vectorized", (PyCFunction) JMethod_vectorized_call, METH_VARARGS|METH_KEYWORDS,
+     "vectorized(*args, out=None) - Call the Java method elementwise over the given 1-D arrays and scalars."};
+
+/**
+ * Returns a callable which calls the given static Java method elementwise over 1-D buffers, see JMethod_CallVectorized().
+ * callable is a JMethod or a JOverloadedMethod with a single overload. All parameters and the return value
+ * of the method must be of primitive types.
+ */
+PyObject* JMethod_Vectorize(PyObject* callable)
+{
+    JPy_JMethod* method;
+    int i;
+
+    if (PyObject_TypeCheck(callable, JPy_GetModuleState()->joverloadedMethodType)) {
+        JPy_JOverloadedMethod* overloadedMethod = (JPy_JOverloadedMethod*) callable;
+        if (PyList_Size(overloadedMethod->methodList) != 1) {
+            PyErr_Format(PyExc_ValueError, "vectorize: Java method '%s' is overloaded, use select() to choose an overload",
+                         JPy_AS_UTF8(overloadedMethod->name));
+            return NULL;
+        }
+        method = (JPy_JMethod*) PyList_GetItem(overloadedMethod->methodList, 0);
+    } else if (PyObject_TypeCheck(callable, JPy_GetModuleState()->jmethodType)) {
+        method = (JPy_JMethod*) callable;
+    } else {
+        PyErr_SetString(PyExc_ValueError, "vectorize: argument 1 (method) must be a static Java method");
+        return NULL;
+    }
+
+    if (!method->isStatic) {
+        PyErr_Format(PyExc_ValueError, "vectorize: Java method '%s' is not static", JPy_AS_UTF8(method->name));
+        return NULL;
+    }
+    if (!method->returnDescriptor->type->isPrimitive || method->returnDescriptor->type == JPy_JVoid) {
+        PyErr_Format(PyExc_ValueError, "vectorize: Java method '%s' must return a primitive type", JPy_AS_UTF8(method->name));
+        return NULL;
+    }
+    for (i = 0; i < method->paramCount; i++) {
+        if (!method->paramDescriptors[i].type->isPrimitive) {
+            PyErr_Format(PyExc_ValueError, "vectorize: parameter %d of Java method '%s' must be of a primitive type", i + 1, JPy_AS_UTF8(method->name));
+            return NULL;
+        }
+    }
+
+    return PyCFunction_NewEx(&JMethod_vectorized_def, (PyObject*) method, NULL);
+}
+
+static PyMethodDef JMethod_methods[] =
+{
+    {"get_param_type",    (PyCFunction) JMethod_get_param_type,    METH_VARARGS, "Gets the type of the parameter given by index"},
+    {"is_param_mutable",  (PyCFunction) JMethod_is_param_mutable,  METH_VARARGS, "Tests if the method parameter given by index is mutable"},
+    {"is_param_output",   (PyCFunction) JMethod_is_param_output,   METH_VARARGS, "Tests if the method parameter given by index is a mere output value (and not read from)"},
+    {"is_param_return",   (PyCFunction) JMethod_is_param_return,   METH_VARARGS, "Tests if the method parameter given by index is the return value"},
+    {"set_param_mutable", (PyCFunction) JMethod_set_param_mutable, METH_VARARGS, "Sets whether the method parameter given by index is mutable"},
+    {"set_param_output",  (PyCFunction) JMethod_set_param_output,  METH_VARARGS, "Sets whether the method parameter given by index is a mere output value (and not read from)"},
+    {"set_param_return",  (PyCFunction) JMethod_set_param_return,  METH_VARARGS, "Sets whether the method parameter given by index is the return value"},
+    {"get_return_policy", (PyCFunction) JMethod_get_return_policy, METH_NOARGS,  "Gets the name of the policy used to convert the returned object"},
+    {"set_return_policy", (PyCFunction) JMethod_set_return_policy, METH_VARARGS, "Sets the policy used to convert the returned object, one of 'wrapper', 'bytes', 'numpy', 'list' or 'dict'"},
+    {NULL}  /* Sentinel */
+};
+
+/**
+ * Implements the BeamPy_JObjectType class singleton.
+ */
+PyTypeObject JMethod_Type = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "jpy.JMethod",                /* tp_name */
+    sizeof (JPy_JMethod),         /* tp_basicsize */
+    0,                            /* tp_itemsize */
+    (destructor)JMethod_dealloc,  /* tp_dealloc */
+#if defined(JPY_COMPAT_VECTORCALL)
+    offsetof(JPy_JMethod, vectorcall), /* tp_vectorcall_offset */
+#else
+    NULL,                         /* tp_print */
+#endif
+    NULL,                         /* tp_getattr */
+    NULL,                         /* tp_setattr */
+    NULL,                         /* tp_reserved */
+    (reprfunc)JMethod_repr,       /* tp_repr */
+    NULL,                         /* tp_as_number */
+    NULL,                         /* tp_as_sequence */
+    NULL,                         /* tp_as_mapping */
+    NULL,                         /* tp_hash  */
+    (ternaryfunc)JMethod_call,    /* tp_call */
+    (reprfunc)JMethod_str,        /* tp_str */
+    NULL,                         /* tp_getattro */
+    NULL,                         /* tp_setattro */
+    NULL,                         /* tp_as_buffer */
+#if defined(JPY_COMPAT_VECTORCALL)
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_VECTORCALL | Py_TPFLAGS_METHOD_DESCRIPTOR, /* tp_flags */
+#else
+    Py_TPFLAGS_DEFAULT,           /* tp_flags */
+#endif
+    "Java Method Wrapper",        /* tp_doc */
+    NULL,                         /* tp_traverse */
+    NULL,                         /* tp_clear */
+    NULL,                         /* tp_richcompare */
+    0,                            /* tp_weaklistoffset */
+    NULL,                         /* tp_iter */
+    NULL,                         /* tp_iternext */
+    JMethod_methods,              /* tp_methods */
+    JMethod_members,              /* tp_members */
+    NULL,                         /* tp_getset */
+    NULL,                         /* tp_base */
+    NULL,                         /* tp_dict */
+    (descrgetfunc)JMethod_descr_get, /* tp_descr_get */
+    NULL,                         /* tp_descr_set */
+    0,                            /* tp_dictoffset */
+    NULL,                         /* tp_init */
+    NULL,                         /* tp_alloc */
+    NULL,                         /* tp_new */
+};
 
-    argCount = PyTuple_Size(pyArgs);
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  JOverloadedMethod
+
+typedef struct JPy_MethodFindResult
+{
+    JPy_JMethod* method;
+    int matchValue;
+    int matchCount;
+}
+JPy_MethodFindResult;
+
+/**
+ * Finds the best matching method in the given list of method overloads, which is either the overloaded method's own
+ * method list or a bucket of its dispatch table.
+ */
+JPy_JMethod* JOverloadedMethod_FindMethod0(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, PyObject* methodList, int argCount, PyObject* const* pyArgs, JPy_MethodFindResult* result)
+{
+    int overloadCount;
+    int matchCount;
+    int matchValue;
+    int matchValueMax;
+    JPy_JMethod* currMethod;
+    JPy_JMethod* bestMethod;
+    int i;
+
+    result->method = NULL;
+    result->matchValue = 0;
+    result->matchCount = 0;
+
+    overloadCount = PyList_Size(methodList);
+    matchCount = 0;
+    matchValueMax = -1;
+    bestMethod = NULL;
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_FindMethod0: method '%s#%s': overloadCount=%d\n",
+                              overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name), overloadCount);
+
+    for (i = 0; i < overloadCount; i++) {
+        currMethod = (JPy_JMethod*) PyList_GetItem(methodList, i);
+        matchValue = JMethod_MatchPyArgs(jenv, currMethod->declaringClass, currMethod, argCount, pyArgs);
+
+        JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_FindMethod0: methodList[%d]: paramCount=%d, matchValue=%d\n", i,
+                                  currMethod->paramCount, matchValue);
+
+        if (matchValue > 0) {
+            if (matchValue > matchValueMax) {
+                matchValueMax = matchValue;
+                bestMethod = currMethod;
+                matchCount = 1;
+            } else if (matchValue == matchValueMax && currMethod->declaringClass == bestMethod->declaringClass) {
+                // Overloads are sorted from sub- to super-class, equal matches in super-classes are not ambiguous
+                matchCount++;
+            }
+            if (matchValue >= 100 * argCount) {
+                // we can't get any better (if so, we have an internal problem)
+                break;
+            }
+        }
+    }
+
+    if (bestMethod == NULL) {
+        matchValueMax = 0;
+        matchCount = 0;
+    }
+
+    result->method = bestMethod;
+    result->matchValue = matchValueMax;
+    result->matchCount = matchCount;
+
+    return bestMethod;
+}
+
+JPy_JMethod* JOverloadedMethod_FindMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, int argCount, PyObject* const* pyArgs, jboolean visitSuperClass)
+{
+    JPy_MethodFindResult result;
+    PyObject* methodList;
 
     if ((JPy_DiagFlags & JPy_DIAG_F_METH) != 0) {
         int i;
         printf("JOverloadedMethod_FindMethod: argCount=%d, visitSuperClass=%d\n", argCount, visitSuperClass);
         for (i = 0; i < argCount; i++) {
-            PyObject* pyArg = PyTuple_GetItem(pyArgs, i);
+            PyObject* pyArg = pyArgs[i];
             printf("\tPy_TYPE(pyArgs[%d])->tp_name = %s\n", i, Py_TYPE(pyArg)->tp_name);
         }
     }
 
-    bestResult.method = NULL;
-    bestResult.matchValue = 0;
-    bestResult.matchCount = 0;
+    if (visitSuperClass) {
+        // Only look at overloads (including inherited ones) which accept argCount arguments
+        if (overloadedMethod->dispatchTable == NULL) {
+            if (JOverloadedMethod_InitDispatchTable(jenv, overloadedMethod) < 0) {
+                return NULL;
+            }
+        }
+        if (argCount < PyList_GET_SIZE(overloadedMethod->dispatchTable)) {
+            methodList = PyList_GET_ITEM(overloadedMethod->dispatchTable, argCount);
+        } else {
+            methodList = NULL;
+        }
+    } else {
+        methodList = overloadedMethod->methodList;
+    }
 
-    currentOM = overloadedMethod;
-    while (1) {
-        if (JOverloadedMethod_FindMethod0(jenv, currentOM, pyArgs, &result) < 0) {
-            // oops, error
-            return NULL;
+    result.method = NULL;
+    result.matchValue = 0;
+    result.matchCount = 0;
+    if (methodList != NULL) {
+        JOverloadedMethod_FindMethod0(jenv, overloadedMethod, methodList, argCount, pyArgs, &result);
+    }
+
+    if (result.method == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "no matching Java method overloads found");
+        return NULL;
+    } else if (result.matchCount > 1) {
+        PyErr_SetString(PyExc_RuntimeError, "ambiguous Java method call, too many matching method overloads found");
+        return NULL;
+    }
+    return result.method;
+}
+
+/**
+ * Tests if the given method is overridden by a method of a sub-class already contained in the given dispatch table bucket.
+ */
+jboolean JOverloadedMethod_IsOverridden(PyObject* methodList, JPy_JMethod* method)
+{
+    JPy_JMethod* otherMethod;
+    Py_ssize_t i;
+    int j;
+
+    for (i = 0; i < PyList_GET_SIZE(methodList); i++) {
+        otherMethod = (JPy_JMethod*) PyList_GET_ITEM(methodList, i);
+        if (otherMethod->declaringClass == method->declaringClass
+            || otherMethod->isStatic != method->isStatic
+            || otherMethod->paramCount != method->paramCount) {
+            continue;
+        }
+        for (j = 0; j < method->paramCount; j++) {
+            if (otherMethod->paramDescriptors[j].type != method->paramDescriptors[j].type) {
+                break;
+            }
         }
-        if (result.method != NULL) {
-            if (result.matchValue >= 100 * argCount) {
-                // We can't get any better.
-                return result.method;
-            } else if (result.matchValue > 0 && result.matchValue > bestResult.matchValue) {
-                // We may have better matching methods overloads in the super class (if any)
-                bestResult = result;
+        if (j == method->paramCount) {
+            return JNI_TRUE;
+        }
+    }
+    return JNI_FALSE;
+}
+
+/**
+ * Builds the overloaded method's dispatch table. It comprises the method's own overloads followed by the ones
+ * inherited from the declaring class' super-classes, with overridden methods omitted. Overloads are bucketed
+ * by the number of Python arguments they accept, which for instance methods includes 'self'.
+ */
+int JOverloadedMethod_InitDispatchTable(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod)
+{
+    PyObject* dispatchTable;
+    PyObject* bucket;
+    JPy_JOverloadedMethod* currentOM;
+    JPy_JType* superClass;
+    JPy_JMethod* method;
+    PyObject* superOM;
+    Py_ssize_t argCount;
+    Py_ssize_t i;
+
+    dispatchTable = PyList_New(0);
+    if (dispatchTable == NULL) {
+        return -1;
+    }
+
+    currentOM = overloadedMethod;
+    while (currentOM != NULL) {
+        for (i = 0; i < PyList_GET_SIZE(currentOM->methodList); i++) {
+            method = (JPy_JMethod*) PyList_GET_ITEM(currentOM->methodList, i);
+            argCount = method->isStatic ? method->paramCount : method->paramCount + 1;
+            while (PyList_GET_SIZE(dispatchTable) <= argCount) {
+                bucket = PyList_New(0);
+                if (bucket == NULL || PyList_Append(dispatchTable, bucket) < 0) {
+                    Py_XDECREF(bucket);
+                    Py_DECREF(dispatchTable);
+                    return -1;
+                }
+                Py_DECREF(bucket);
+            }
+            bucket = PyList_GET_ITEM(dispatchTable, argCount);
+            if (!JOverloadedMethod_IsOverridden(bucket, method)) {
+                if (PyList_Append(bucket, (PyObject*) method) < 0) {
+                    Py_DECREF(dispatchTable);
+                    return -1;
+                }
             }
         }
 
-        if (visitSuperClass) {
-            superClass = currentOM->declaringClass->superType;
-            if (superClass != NULL) {
-                superOM = JType_GetOverloadedMethod(jenv, superClass, currentOM->name, JNI_TRUE);
-            } else {
-                superOM = Py_None;
+        superClass = currentOM->declaringClass->superType;
+        if (superClass != NULL) {
+            superOM = JType_GetOverloadedMethod(jenv, superClass, overloadedMethod->name, JNI_TRUE);
+            if (superOM == NULL) {
+                Py_DECREF(dispatchTable);
+                return -1;
             }
         } else {
             superOM = Py_None;
         }
+        currentOM = superOM != Py_None ? (JPy_JOverloadedMethod*) superOM : NULL;
+    }
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_METH, "JOverloadedMethod_InitDispatchTable: method '%s#%s': bucketCount=%d\n",
+                   overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name), (int) PyList_GET_SIZE(dispatchTable));
+
+    Py_XDECREF(overloadedMethod->dispatchTable);
+    overloadedMethod->dispatchTable = dispatchTable;
+    return 0;
+}
 
-        if (superOM == NULL) {
-            // oops, error
+/**
+ * Finds the method overload (including inherited ones) which exactly matches the given JNI method signature or,
+ * if signature is NULL, the given parameter types. Returns a borrowed reference or NULL with a ValueError set.
+ */
+JPy_JMethod* JOverloadedMethod_FindExactMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, const char* signature, int paramCount, JPy_JType** paramTypes)
+{
+    PyObject* methodList;
+    JPy_JMethod* method;
+    Py_ssize_t i, j;
+    int k;
+
+    if (overloadedMethod->dispatchTable == NULL) {
+        if (JOverloadedMethod_InitDispatchTable(jenv, overloadedMethod) < 0) {
             return NULL;
-        } else if (superOM == Py_None) {
-            // no overloaded methods found in super class, so return best result found so far
-            if (bestResult.method == NULL) {
-                PyErr_SetString(PyExc_RuntimeError, "no matching Java method overloads found");
-                return NULL;
-            } else if (bestResult.matchCount > 1) {
-                PyErr_SetString(PyExc_RuntimeError, "ambiguous Java method call, too many matching method overloads found");
-                return NULL;
-            } else {
-                return bestResult.method;
+        }
+    }
+
+    for (i = 0; i < PyList_GET_SIZE(overloadedMethod->dispatchTable); i++) {
+        methodList = PyList_GET_ITEM(overloadedMethod->dispatchTable, i);
+        for (j = 0; j < PyList_GET_SIZE(methodList); j++) {
+            method = (JPy_JMethod*) PyList_GET_ITEM(methodList, j);
+            if (signature != NULL) {
+                if (JMethod_MatchesSignature(method, signature)) {
+                    return method;
+                }
+            } else if (method->paramCount == paramCount) {
+                for (k = 0; k < paramCount && method->paramDescriptors[k].type == paramTypes[k]; k++) {
+                }
+                if (k == paramCount) {
+                    return method;
+                }
             }
-        } else {
-            // Continue trying with overloads from super type
-            currentOM = (JPy_JOverloadedMethod*) superOM;
         }
     }
 
-    // Should never come here
-    PyErr_SetString(PyExc_RuntimeError, "internal error");
+    if (signature != NULL) {
+        PyErr_Format(PyExc_ValueError, "Java method '%s#%s' has no overload with signature '%s'",
+                     overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name), signature);
+    } else {
+        PyErr_Format(PyExc_ValueError, "Java method '%s#%s' has no overload with the given parameter types",
+                     overloadedMethod->declaringClass->javaName, JPy_AS_UTF8(overloadedMethod->name));
+    }
     return NULL;
 }
 
 JPy_JOverloadedMethod* JOverloadedMethod_New(JPy_JType* declaringClass, PyObject* name, JPy_JMethod* method)
 {
-    PyTypeObject* methodType = &JOverloadedMethod_Type;
+    PyTypeObject* methodType = JPy_GetModuleState()->joverloadedMethodType;
     JPy_JOverloadedMethod* overloadedMethod;
 
     overloadedMethod = (JPy_JOverloadedMethod*) methodType->tp_alloc(methodType, 0);
     overloadedMethod->declaringClass = declaringClass;
     overloadedMethod->name = name;
     overloadedMethod->methodList = PyList_New(0);
+    overloadedMethod->dispatchTable = NULL;
+#if defined(JPY_COMPAT_VECTORCALL)
+    overloadedMethod->vectorcall = (vectorcallfunc) JOverloadedMethod_vectorcall;
+#endif
 
     Py_INCREF((PyObject*) overloadedMethod->declaringClass);
     Py_INCREF((PyObject*) overloadedMethod->name);
@@ -774,6 +1745,8 @@ JPy_JOverloadedMethod* JOverloadedMethod_New(JPy_JType* declaringClass, PyObject
 
 int JOverloadedMethod_AddMethod(JPy_JOverloadedMethod* overloadedMethod, JPy_JMethod* method)
 {
+    // The dispatch table must be rebuilt
+    Py_CLEAR(overloadedMethod->dispatchTable);
     return PyList_Append(overloadedMethod->methodList, (PyObject*) method);
 }
 
@@ -785,25 +1758,61 @@ void JOverloadedMethod_dealloc(JPy_JOverloadedMethod* self)
     Py_DECREF((PyObject*) self->declaringClass);
     Py_DECREF((PyObject*) self->name);
     Py_DECREF((PyObject*) self->methodList);
-    Py_TYPE(self)->tp_free((PyObject*) self);
+    Py_XDECREF(self->dispatchTable);
+    JPy_FREE_INSTANCE(self)
 }
 
 /**
- * The 'JOverloadedMethod' type's tp_call slot. Makes instances of the 'JOverloadedMethod' type callable.
+ * Invokes the best matching method overload for the given argument vector.
+ * For instance methods, args[0] is the Java object the method is called on.
  */
-PyObject* JOverloadedMethod_call(JPy_JOverloadedMethod* self, PyObject *args, PyObject *kw)
+PyObject* JOverloadedMethod_Invoke(JPy_JOverloadedMethod* self, int argCount, PyObject* const* args)
 {
     JNIEnv* jenv;
     JPy_JMethod* method;
 
     JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
 
-    method = JOverloadedMethod_FindMethod(jenv, self, args, JNI_TRUE);
+    method = JOverloadedMethod_FindMethod(jenv, self, argCount, args, JNI_TRUE);
     if (method == NULL) {
         return NULL;
     }
 
-    return JMethod_InvokeMethod(jenv, method, args);
+    return JMethod_InvokeMethod(jenv, method, argCount, args);
+}
+
+/**
+ * The 'JOverloadedMethod' type's tp_call slot. Makes instances of the 'JOverloadedMethod' type callable.
+ */
+PyObject* JOverloadedMethod_call(JPy_JOverloadedMethod* self, PyObject *args, PyObject *kw)
+{
+    return JOverloadedMethod_Invoke(self, (int) PyTuple_GET_SIZE(args), JPy_TUPLE_ITEMS(args));
+}
+
+#if defined(JPY_COMPAT_VECTORCALL)
+/**
+ * The 'JOverloadedMethod' type's vectorcall function (PEP 590). As the type is a method descriptor,
+ * the interpreter calls 'obj.method(a, b)' as method(obj, a, b) through this function without creating
+ * a bound method or an argument tuple. Keyword arguments are ignored, as they are by tp_call.
+ */
+PyObject* JOverloadedMethod_vectorcall(JPy_JOverloadedMethod* self, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+{
+    return JOverloadedMethod_Invoke(self, (int) PyVectorcall_NARGS(nargsf), args);
+}
+#endif
+
+/**
+ * The 'JOverloadedMethod' type's tp_descr_get slot. Called if a Java method is looked up through a Java object
+ * (obj != NULL), in which case a bound method is returned. Looked up through its type, the method itself
+ * is returned.
+ */
+PyObject* JOverloadedMethod_descr_get(PyObject* self, PyObject* obj, PyObject* type)
+{
+    if (obj == NULL || obj == Py_None) {
+        Py_INCREF(self);
+        return self;
+    }
+    return JPy_METHOD_NEW(self, obj, type);
 }
 
 /**
@@ -821,6 +1830,87 @@ PyObject* JOverloadedMethod_repr(JPy_JOverloadedMethod* self)
                            methodCount);
 }
 
+/**
+ * Implements the JOverloadedMethod.select(*param_types) method.
+ */
+PyObject* JOverloadedMethod_select(JPy_JOverloadedMethod* self, PyObject* args)
+{
+    JNIEnv* jenv;
+    JPy_JType** paramTypes;
+    JPy_JMethod* method;
+    PyObject* arg;
+    int paramCount;
+    int i;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    paramCount = (int) PyTuple_GET_SIZE(args);
+    paramTypes = PyMem_New(JPy_JType*, paramCount + 1);
+    if (paramTypes == NULL) {
+        return PyErr_NoMemory();
+    }
+
+    for (i = 0; i < paramCount; i++) {
+        arg = PyTuple_GET_ITEM(args, i);
+        if (JPy_IS_STR(arg)) {
+            paramTypes[i] = JType_GetTypeForName(jenv, JPy_AS_UTF8(arg), JNI_FALSE);
+            if (paramTypes[i] == NULL) {
+                PyMem_Del(paramTypes);
+                return NULL;
+            }
+        } else if (JType_Check(arg)) {
+            paramTypes[i] = (JPy_JType*) arg;
+        } else {
+            PyMem_Del(paramTypes);
+            PyErr_SetString(PyExc_ValueError, "select: parameter types must be given as type names or type objects");
+            return NULL;
+        }
+    }
+
+    method = JOverloadedMethod_FindExactMethod(jenv, self, NULL, paramCount, paramTypes);
+    PyMem_Del(paramTypes);
+    if (method == NULL) {
+        return NULL;
+    }
+
+    Py_INCREF(method);
+    return (PyObject*) method;
+}
+
+/**
+ * Implements the JOverloadedMethod.map(args, as_numpy=False, release_gil=False) method.
+ */
+PyObject* JOverloadedMethod_map(JPy_JOverloadedMethod* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    static char* keywords[] = {"args", "as_numpy", "release_gil", NULL};
+    PyObject* argsSeq;
+    int asNumPy;
+    int releaseGIL;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    asNumPy = 0; // False
+    releaseGIL = 0; // False
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|ii:map", keywords, &argsSeq, &asNumPy, &releaseGIL)) {
+        return NULL;
+    }
+
+    return JMethod_Map(jenv, (PyObject*) self, argsSeq,
+                       (jboolean) (asNumPy != 0 ? JNI_TRUE : JNI_FALSE),
+                       (jboolean) (releaseGIL != 0 ? JNI_TRUE : JNI_FALSE));
+}
+
+static PyMethodDef JOverloadedMethod_methods[] =
+{
+    {"select", (PyCFunction) JOverloadedMethod_select, METH_VARARGS,
+               "Returns the method overload with the given parameter types (type names or type objects). "
+               "Calling the returned JMethod bypasses overload resolution."},
+    {"map",    (PyCFunction) JOverloadedMethod_map, METH_VARARGS|METH_KEYWORDS,
+               "Calls the method for every argument tuple in args, see jpy.map()."},
+    {NULL}  /* Sentinel */
+};
+
 static PyMemberDef JOverloadedMethod_members[] =
 {
     {"decl_class",   T_OBJECT_EX, offsetof(JPy_JOverloadedMethod, declaringClass), READONLY, "Declaring Java class"},
@@ -844,7 +1934,11 @@ PyTypeObject JOverloadedMethod_Type = {
     sizeof (JPy_JOverloadedMethod),         /* tp_basicsize */
     0,                            /* tp_itemsize */
     (destructor)JOverloadedMethod_dealloc,  /* tp_dealloc */
+#if defined(JPY_COMPAT_VECTORCALL)
+    offsetof(JPy_JOverloadedMethod, vectorcall), /* tp_vectorcall_offset */
+#else
     NULL,                         /* tp_print */
+#endif
     NULL,                         /* tp_getattr */
     NULL,                         /* tp_setattr */
     NULL,                         /* tp_reserved */
@@ -858,7 +1952,11 @@ PyTypeObject JOverloadedMethod_Type = {
     NULL,                         /* tp_getattro */
     NULL,                         /* tp_setattro */
     NULL,                         /* tp_as_buffer */
+#if defined(JPY_COMPAT_VECTORCALL)
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_VECTORCALL | Py_TPFLAGS_METHOD_DESCRIPTOR, /* tp_flags */
+#else
     Py_TPFLAGS_DEFAULT,           /* tp_flags */
+#endif
     "Java Overloaded Method",     /* tp_doc */
     NULL,                         /* tp_traverse */
     NULL,                         /* tp_clear */
@@ -866,12 +1964,12 @@ PyTypeObject JOverloadedMethod_Type = {
     0,                            /* tp_weaklistoffset */
     NULL,                         /* tp_iter */
     NULL,                         /* tp_iternext */
-    NULL,                         /* tp_methods */
+    JOverloadedMethod_methods,    /* tp_methods */
     JOverloadedMethod_members,    /* tp_members */
     NULL,                         /* tp_getset */
     NULL,                         /* tp_base */
     NULL,                         /* tp_dict */
-    NULL,                         /* tp_descr_get */
+    (descrgetfunc)JOverloadedMethod_descr_get, /* tp_descr_get */
     NULL,                         /* tp_descr_set */
     0,                            /* tp_dictoffset */
     NULL,                         /* tp_init */
@@ -44,11 +44,15 @@ typedef struct
     JPy_ReturnDescriptor* returnDescriptor;
     // The JNI method ID obtained from the declaring class.
     jmethodID mid;
+#if defined(JPY_COMPAT_VECTORCALL)
+    // PEP 590 entry point, always JMethod_vectorcall().
+    vectorcallfunc vectorcall;
+#endif
 }
 JPy_JMethod;
 
 /**
- * The Python 'JMethod' type singleton.
+ * The template of the Python 'JMethod' type. Use JPy_GetModuleState()->jmethodType, the copy of the current interpreter.
  */
 extern PyTypeObject JMethod_Type;
 
@@ -65,18 +69,33 @@ typedef struct
     PyObject* name;
     // List of method overloads (a PyList with items of type JPy_JMethod).
     PyObject* methodList;
+    // Method overloads including the ones inherited from super types, bucketed by the number of Python arguments
+    // they accept (a PyList whose i-th item is a PyList of JPy_JMethod). NULL, if not yet built.
+    PyObject* dispatchTable;
+#if defined(JPY_COMPAT_VECTORCALL)
+    // PEP 590 entry point, always JOverloadedMethod_vectorcall().
+    vectorcallfunc vectorcall;
+#endif
 }
 JPy_JOverloadedMethod;
 
 /**
- * The Python 'JOverloadedMethod' type singleton.
+ * The template of the Python 'JOverloadedMethod' type. Use JPy_GetModuleState()->joverloadedMethodType, the copy of the current interpreter.
  */
 extern PyTypeObject JOverloadedMethod_Type;
 
-JPy_JMethod*           JOverloadedMethod_FindMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, PyObject* argTuple, jboolean visitSuperClass);
+/**
+ * Gives the items of the Python tuple argTuple as argument vector (PyObject* const*) as expected by
+ * JOverloadedMethod_FindMethod(), JMethod_CreateJArgs() and JMethod_InvokeMethod().
+ */
+#define JPy_TUPLE_ITEMS(argTuple) (&PyTuple_GET_ITEM(argTuple, 0))
+
+JPy_JMethod*           JOverloadedMethod_FindMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, int argCount, PyObject* const* args, jboolean visitSuperClass);
 JPy_JMethod*           JOverloadedMethod_FindStaticMethod(JPy_JOverloadedMethod* overloadedMethod, PyObject* argTuple);
 JPy_JOverloadedMethod* JOverloadedMethod_New(JPy_JType* declaringClass, PyObject* name, JPy_JMethod* method);
 int                    JOverloadedMethod_AddMethod(JPy_JOverloadedMethod* overloadedMethod, JPy_JMethod* method);
+int                    JOverloadedMethod_InitDispatchTable(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod);
+JPy_JMethod*           JOverloadedMethod_FindExactMethod(JNIEnv* jenv, JPy_JOverloadedMethod* overloadedMethod, const char* signature, int paramCount, JPy_JType** paramTypes);
 
 JPy_JMethod* JMethod_New(JPy_JType* declaringClass,
                          PyObject* name,
@@ -90,8 +109,16 @@ void JMethod_Del(JPy_JMethod* method);
 
 int JMethod_ConvertToJavaValues(JNIEnv* jenv, JPy_JMethod* jMethod, int argCount, PyObject* argTuple, jvalue* jArgs);
 
-int  JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* jMethod, PyObject* argTuple, jvalue** jValues, JPy_ArgDisposer** jDisposers);
+int  JMethod_CheckPyArgs(JNIEnv* jenv, JPy_JMethod* jMethod, int argCount, PyObject* const* args);
+int  JMethod_ConvertPyArgs(JNIEnv* jenv, JPy_JMethod* jMethod, int argCount, PyObject* const* args, jvalue* jValues, JPy_ArgDisposer* jDisposers);
+int  JMethod_CreateJArgs(JNIEnv* jenv, JPy_JMethod* jMethod, int argCount, PyObject* const* args, jvalue** jValues, JPy_ArgDisposer** jDisposers);
+PyObject* JMethod_InvokeMethod(JNIEnv* jenv, JPy_JMethod* jMethod, int argCount, PyObject* const* args);
+void JMethod_DisposeJArgValues(JNIEnv* jenv, int argCount, jvalue* jValues, JPy_ArgDisposer* jDisposers);
 void JMethod_DisposeJArgs(JNIEnv* jenv, int paramCount, jvalue* jValues, JPy_ArgDisposer* jDisposers);
+int  JMethod_CallJavaMethod(JNIEnv* jenv, JPy_JMethod* jMethod, jobject objectRef, jvalue* jArgs, jvalue* result);
+PyObject* JMethod_FromJValue(JNIEnv* jenv, JPy_JMethod* jMethod, PyObject* const* args, jvalue* jArgs, jvalue* result);
+PyObject* JMethod_Map(JNIEnv* jenv, PyObject* callable, PyObject* argsSeq, jboolean asNumPy, jboolean releaseGIL);
+PyObject* JMethod_Vectorize(PyObject* callable);
 
 #ifdef __cplusplus
 }  /* extern "C" */
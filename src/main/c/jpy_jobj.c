@@ -22,6 +22,8 @@
 #include "jpy_jmethod.h"
 #include "jpy_jfield.h"
 #include "jpy_conv.h"
+#include "jpy_jfuture.h"
+#include "jpy_jcoll.h"
 
 JPy_JObj* JObj_New(JNIEnv* jenv, jobject objectRef)
 {
@@ -38,22 +40,235 @@ JPy_JObj* JObj_New(JNIEnv* jenv, jobject objectRef)
     return JObj_FromType(jenv, type, objectRef);
 }
 
+/**
+ * Returns the key of the given Java object in the identity caches, which is its System.identityHashCode().
+ * Returns NULL without an error set, if the key could not be computed.
+ */
+static PyObject* JObj_GetIdentityKey(JNIEnv* jenv, jobject objectRef)
+{
+    jint hashCode;
+
+    hashCode = (*jenv)->CallStaticIntMethod(jenv, JPy_System_JClass, JPy_System_IdentityHashCode_MID, objectRef);
+    if ((*jenv)->ExceptionCheck(jenv)) {
+        (*jenv)->ExceptionClear(jenv);
+        return NULL;
+    }
+    return JPy_FROM_CLONG(hashCode);
+}
+
+/**
+ * Returns a new reference to the object of the given weak reference, or NULL without an error set if it is dead.
+ */
+static PyObject* JObj_GetReferent(PyObject* ref)
+{
+    PyObject* obj;
+
+#if PY_VERSION_HEX >= 0x030D0000
+    if (PyWeakref_GetRef(ref, &obj) <= 0) {
+        PyErr_Clear();
+        return NULL;
+    }
+#else
+    obj = PyWeakref_GET_OBJECT(ref);
+    if (obj == Py_None) {
+        return NULL;
+    }
+    Py_INCREF(obj);
+#endif
+    return obj;
+}
+
+/*
+ * The entries of an identity cache are weak references to wrappers. If the Java objects of several live wrappers
+ * have the same identity hash code, the entry is a list (bucket) of weak references to them. Lookups and additions
+ * hold a critical section of the cache, inside which purging takes place.
+ */
+
+/**
+ * Looks up the wrapper of the given Java object in the given identity cache.
+ * Returns a new reference, or NULL if there is none.
+ */
+static JPy_JObj* JObj_LookupIdentityCache(JNIEnv* jenv, PyObject* cache, PyObject* key, jobject objectRef)
+{
+    PyObject* entry;
+    PyObject* obj;
+    Py_ssize_t count;
+    Py_ssize_t i;
+
+    obj = NULL;
+    JPy_BEGIN_CRITICAL_SECTION(cache);
+    entry = PyDict_GetItem(cache, key);
+    if (entry != NULL) {
+        count = PyList_Check(entry) ? PyList_GET_SIZE(entry) : 1;
+        for (i = 0; obj == NULL && i < count; i++) {
+            obj = JObj_GetReferent(PyList_Check(entry) ? PyList_GET_ITEM(entry, i) : entry);
+            if (obj != NULL && !(*jenv)->IsSameObject(jenv, ((JPy_JObj*) obj)->objectRef, objectRef)) {
+                // Another Java object with the same identity hash code
+                Py_DECREF(obj);
+                obj = NULL;
+            }
+        }
+    }
+    JPy_END_CRITICAL_SECTION();
+    return (JPy_JObj*) obj;
+}
+
+/**
+ * Removes the weak references to deallocated wrappers from the given bucket.
+ */
+static void JObj_PurgeIdentityBucket(PyObject* bucket)
+{
+    PyObject* obj;
+    Py_ssize_t i;
+
+    for (i = PyList_GET_SIZE(bucket) - 1; i >= 0; i--) {
+        obj = JObj_GetReferent(PyList_GET_ITEM(bucket, i));
+        if (obj == NULL) {
+            PyList_SetSlice(bucket, i, i + 1, NULL);
+        } else {
+            Py_DECREF(obj);
+        }
+    }
+}
+
+/**
+ * Removes the weak references to deallocated wrappers from the given identity cache.
+ */
+static void JObj_PurgeIdentityCache(PyObject* cache)
+{
+    PyObject* deadKeys;
+    PyObject* key;
+    PyObject* entry;
+    PyObject* obj;
+    Py_ssize_t pos;
+    Py_ssize_t i;
+    int dead;
+
+    deadKeys = PyList_New(0);
+    if (deadKeys == NULL) {
+        PyErr_Clear();
+        return;
+    }
+    pos = 0;
+    while (PyDict_Next(cache, &pos, &key, &entry)) {
+        if (PyList_Check(entry)) {
+            JObj_PurgeIdentityBucket(entry);
+            dead = PyList_GET_SIZE(entry) == 0;
+        } else {
+            obj = JObj_GetReferent(entry);
+            dead = obj == NULL;
+            Py_XDECREF(obj);
+        }
+        if (dead) {
+            PyList_Append(deadKeys, key);
+        }
+    }
+    for (i = 0; i < PyList_GET_SIZE(deadKeys); i++) {
+        PyDict_DelItem(cache, PyList_GET_ITEM(deadKeys, i));
+    }
+    Py_DECREF(deadKeys);
+    PyErr_Clear();
+}
+
+/**
+ * Adds the given wrapper to the identity cache of its type. Failures are ignored, since the cache
+ * is only an optimisation.
+ */
+static void JObj_AddToIdentityCache(JPy_JType* type, PyObject* cache, PyObject* key, JPy_JObj* obj)
+{
+    PyObject* ref;
+    PyObject* entry;
+    PyObject* other;
+    PyObject* bucket;
+    Py_ssize_t size;
+    int status;
+
+    ref = PyWeakref_NewRef((PyObject*) obj, NULL);
+    if (ref == NULL) {
+        PyErr_Clear();
+        return;
+    }
+
+    JPy_BEGIN_CRITICAL_SECTION(cache);
+    entry = PyDict_GetItem(cache, key);
+    if (entry == NULL) {
+        status = PyDict_SetItem(cache, key, ref);
+    } else if (PyList_Check(entry)) {
+        JObj_PurgeIdentityBucket(entry);
+        status = PyList_Append(entry, ref);
+    } else {
+        other = JObj_GetReferent(entry);
+        if (other == NULL) {
+            status = PyDict_SetItem(cache, key, ref);
+        } else {
+            // Another live wrapper of an object with the same identity hash code, both share a bucket
+            Py_DECREF(other);
+            bucket = PyList_New(2);
+            if (bucket != NULL) {
+                Py_INCREF(entry);
+                PyList_SET_ITEM(bucket, 0, entry);
+                Py_INCREF(ref);
+                PyList_SET_ITEM(bucket, 1, ref);
+                status = PyDict_SetItem(cache, key, bucket);
+                Py_DECREF(bucket);
+            } else {
+                status = -1;
+            }
+        }
+    }
+
+    size = PyDict_Size(cache);
+    if (status == 0 && size > type->identityCacheLimit) {
+        JObj_PurgeIdentityCache(cache);
+        size = 2 * PyDict_Size(cache);
+        type->identityCacheLimit = size > JPy_IDENTITY_CACHE_MIN_LIMIT ? size : JPy_IDENTITY_CACHE_MIN_LIMIT;
+    }
+    JPy_END_CRITICAL_SECTION();
+
+    Py_DECREF(ref);
+    if (status < 0) {
+        PyErr_Clear();
+    }
+}
+
 JPy_JObj* JObj_FromType(JNIEnv* jenv, JPy_JType* type, jobject objectRef)
 {
     JPy_JObj* obj;
+    PyObject* cache;
+    PyObject* key;
+
+    // If enabled, return the existing wrapper of the Java object, see jpy.set_identity_cache()
+    cache = JType_GetIdentityCache(type);
+    key = NULL;
+    if (cache != NULL) {
+        key = JObj_GetIdentityKey(jenv, objectRef);
+        if (key != NULL) {
+            obj = JObj_LookupIdentityCache(jenv, cache, key, objectRef);
+            if (obj != NULL) {
+                Py_DECREF(key);
+                Py_DECREF(cache);
+                return obj;
+            }
+        }
+    }
 
     obj = (JPy_JObj*) PyObject_New(JPy_JObj, (PyTypeObject*) type);
     if (obj == NULL) {
+        Py_XDECREF(key);
+        Py_XDECREF(cache);
         return NULL;
     }
 
     objectRef = (*jenv)->NewGlobalRef(jenv, objectRef);
     if (objectRef == NULL) {
+        Py_XDECREF(key);
+        Py_XDECREF(cache);
         PyErr_NoMemory();
         return NULL;
     }
 
     obj->objectRef = objectRef;
+    obj->weakrefs = NULL;
 
     // For special treatment of primitive array refer to JType_InitSlots()
     if (type->componentType != NULL && type->componentType->isPrimitive) {
@@ -61,8 +276,15 @@ JPy_JObj* JObj_FromType(JNIEnv* jenv, JPy_JType* type, jobject objectRef)
 
         array = (JPy_JArray*) obj;
         array->bufferExportCount = 0;
+        array->bufferShape = 0;
     }
 
+    if (key != NULL) {
+        JObj_AddToIdentityCache(type, cache, key, obj);
+        Py_DECREF(key);
+    }
+    Py_XDECREF(cache);
+
     return obj;
 }
 
@@ -77,8 +299,11 @@ int JObj_init(JPy_JObj* self, PyObject* args, PyObject* kwds)
     PyObject* constructor;
     JPy_JMethod* jMethod;
     jobject objectRef;
+    int argCount;
     jvalue* jArgs;
     JPy_ArgDisposer* jDisposers;
+    PyObject* cache;
+    PyObject* key;
 
     JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
 
@@ -90,7 +315,7 @@ int JObj_init(JPy_JObj* self, PyObject* args, PyObject* kwds)
         return -1;
     }
 
-    if (!PyObject_TypeCheck(constructor, &JOverloadedMethod_Type)) {
+    if (!PyObject_TypeCheck(constructor, JPy_GetModuleState()->joverloadedMethodType)) {
         PyErr_SetString(PyExc_RuntimeError, "invalid JType attribute '"  JPy_JTYPE_ATTR_NAME_JINIT  "': expected type JOverloadedMethod_Type");
         return -1;
     }
@@ -101,12 +326,13 @@ int JObj_init(JPy_JObj* self, PyObject* args, PyObject* kwds)
         return -1;
     }
 
-    jMethod = JOverloadedMethod_FindMethod(jenv, (JPy_JOverloadedMethod*) constructor, args, JNI_FALSE);
+    argCount = (int) PyTuple_GET_SIZE(args);
+    jMethod = JOverloadedMethod_FindMethod(jenv, (JPy_JOverloadedMethod*) constructor, argCount, JPy_TUPLE_ITEMS(args), JNI_FALSE);
     if (jMethod == NULL) {
         return -1;
     }
 
-    if (JMethod_CreateJArgs(jenv, jMethod, args, &jArgs, &jDisposers) < 0) {
+    if (JMethod_CreateJArgs(jenv, jMethod, argCount, JPy_TUPLE_ITEMS(args), &jArgs, &jDisposers) < 0) {
         return -1;
     }
 
@@ -137,6 +363,17 @@ int JObj_init(JPy_JObj* self, PyObject* args, PyObject* kwds)
 
     self->objectRef = objectRef;
 
+    // Let JObj_FromType() find the new object's wrapper, see jpy.set_identity_cache()
+    cache = JType_GetIdentityCache(jType);
+    if (cache != NULL) {
+        key = JObj_GetIdentityKey(jenv, objectRef);
+        if (key != NULL) {
+            JObj_AddToIdentityCache(jType, cache, key, self);
+            Py_DECREF(key);
+        }
+        Py_DECREF(cache);
+    }
+
     JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JObj_init: self->objectRef=%p\n", self->objectRef);
 
     return 0;
@@ -151,6 +388,10 @@ void JObj_dealloc(JPy_JObj* self)
 
     JPy_DIAG_PRINT(JPy_DIAG_F_MEM, "JObj_dealloc: releasing instance of %s, self->objectRef=%p\n", Py_TYPE(self)->tp_name, self->objectRef);
 
+    if (self->weakrefs != NULL) {
+        PyObject_ClearWeakRefs((PyObject*) self);
+    }
+
     jenv = JPy_GetJNIEnv();
     if (jenv != NULL) {
         if (self->objectRef != NULL) {
@@ -325,86 +566,41 @@ error:
 
 
 /**
- * The JObj type's tp_setattro slot.
+ * The JObj type's tp_setattro slot, only used until the type is resolved.
  */
 int JObj_setattro(JPy_JObj* self, PyObject* name, PyObject* value)
 {
-    PyObject* oldValue;
+    JPy_JType* selfType;
 
     //printf("JObj_setattro: %s.%s\n", Py_TYPE(self)->tp_name, JPy_AS_UTF8(name));
 
-    oldValue = PyObject_GenericGetAttr((PyObject*) self, name);
-    if (oldValue != NULL && PyObject_TypeCheck(oldValue, &JField_Type)) {
+    // Make sure that the Java type is resolved, otherwise we won't find any fields at all.
+    selfType = (JPy_JType*) Py_TYPE(self);
+    if (!JPy_LOAD_FLAG(selfType->isResolved)) {
         JNIEnv* jenv;
-        JPy_JField* field;
-        JPy_JType* type;
-
-        field = (JPy_JField*) oldValue;
-        type = field->type;
-
         JPy_GET_JNI_ENV_OR_RETURN(jenv, -1)
-
-        if (type == JPy_JBoolean) {
-            jboolean item = JPy_AS_JBOOLEAN(value);
-            (*jenv)->SetBooleanField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JChar) {
-            jchar item = JPy_AS_JCHAR(value);
-            (*jenv)->SetCharField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JByte) {
-            jbyte item = JPy_AS_JBYTE(value);
-            (*jenv)->SetByteField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JShort) {
-            jshort item = JPy_AS_JSHORT(value);
-            (*jenv)->SetShortField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JInt) {
-            jint item = JPy_AS_JINT(value);
-            (*jenv)->SetIntField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JLong) {
-            jlong item = JPy_AS_JLONG(value);
-            (*jenv)->SetLongField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JFloat) {
-            jfloat item = JPy_AS_JFLOAT(value);
-            (*jenv)->SetFloatField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else if (type == JPy_JDouble) {
-            jdouble item = JPy_AS_JDOUBLE(value);
-            (*jenv)->SetDoubleField(jenv, self->objectRef, field->fid, item);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
-        } else {
-            jobject objectRef;
-            if (JPy_AsJObjectWithType(jenv, value, &objectRef, field->type) < 0) {
-                return -1;
-            }
-            (*jenv)->SetObjectField(jenv, self->objectRef, field->fid, objectRef);
-            JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+        if (JType_ResolveType(jenv, selfType) < 0) {
+            return -1;
         }
-        return 0;
-    } else {
-        return PyObject_GenericSetAttr((PyObject*) self, name, value);
     }
+
+    // Java fields are data descriptors (see JField_descr_set()), so they are set by the generic implementation.
+    return PyObject_GenericSetAttr((PyObject*) self, name, value);
 }
 
 /**
- * The JObj type's tp_getattro slot.
- * This is important: wrap callable objects of type JOverloadedMethod_Type into python methods so that
- * a method call to an instance x of class X becomes: x.m() --> X.m(x)
+ * The JObj type's tp_getattro slot, only used until the type is resolved.
+ * Method calls to an instance x of class X become x.m() --> X.m(x), see JOverloadedMethod_descr_get().
  */
 PyObject* JObj_getattro(JPy_JObj* self, PyObject* name)
 {
     JPy_JType* selfType;
-    PyObject* value;
 
     //printf("JObj_getattro: %s.%s\n", Py_TYPE(self)->tp_name, JPy_AS_UTF8(name));
 
     // First make sure that the Java type is resolved, otherwise we won't find any methods at all.
     selfType = (JPy_JType*) Py_TYPE(self);
-    if (!selfType->isResolved) {
+    if (!JPy_LOAD_FLAG(selfType->isResolved)) {
         JNIEnv* jenv;
         JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
         if (JType_ResolveType(jenv, selfType) < 0) {
@@ -412,79 +608,10 @@ PyObject* JObj_getattro(JPy_JObj* self, PyObject* name)
         }
     }
 
-    // todo: implement a special lookup: we need to override __getattro__ of JType (--> JType_getattro) as well so that we know if a method
-    // is called on a class rather than on an instance. Using PyObject_GenericGetAttr will also call  JType_getattro,
-    // but then we loose the information that a method is called on an instance and not on a class.
-    value = PyObject_GenericGetAttr((PyObject*) self, name);
-    if (value == NULL) {
-        //printf("JObj_getattro: not found!\n");
-        return NULL;
-    }
-    if (PyObject_TypeCheck(value, &JOverloadedMethod_Type)) {
-        //JPy_JOverloadedMethod* overloadedMethod = (JPy_JOverloadedMethod*) value;
-        //printf("JObj_getattro: wrapping JOverloadedMethod, overloadCount=%d\n", PyList_Size(overloadedMethod->methodList));
-#if defined(JPY_COMPAT_33P)
-        return PyMethod_New(value, (PyObject*) self);
-#elif defined(JPY_COMPAT_27)
-        // todo: py27: 3rd arg must be class of self, check if NULL is ok here
-        return PyMethod_New(value, (PyObject*) self, NULL);
-#else
-#error JPY_VERSION_ERROR
-#endif
-    } else if (PyObject_TypeCheck(value, &JField_Type)) {
-        JNIEnv* jenv;
-        JPy_JField* field;
-        JPy_JType* type;
-
-        field = (JPy_JField*) value;
-        type = field->type;
-
-        JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
-
-        if (type == JPy_JBoolean) {
-            jboolean item = (*jenv)->GetBooleanField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JBOOLEAN(item);
-        } else if (type == JPy_JChar) {
-            jchar item = (*jenv)->GetCharField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JCHAR(item);
-        } else if (type == JPy_JByte) {
-            jbyte item = (*jenv)->GetByteField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JBYTE(item);
-        } else if (type == JPy_JShort) {
-            jshort item = (*jenv)->GetShortField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JSHORT(item);
-        } else if (type == JPy_JInt) {
-            jint item = (*jenv)->GetIntField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JINT(item);
-        } else if (type == JPy_JLong) {
-            jlong item = (*jenv)->GetLongField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JLONG(item);
-        } else if (type == JPy_JFloat) {
-            jfloat item = (*jenv)->GetFloatField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JFLOAT(item);
-        } else if (type == JPy_JDouble) {
-            jdouble item = (*jenv)->GetDoubleField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            return JPy_FROM_JDOUBLE(item);
-        } else {
-            PyObject* returnValue;
-            jobject item = (*jenv)->GetObjectField(jenv, self->objectRef, field->fid);
-            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
-            returnValue = JPy_FromJObjectWithType(jenv, item, field->type);
-            (*jenv)->DeleteLocalRef(jenv, item);
-            return returnValue;
-        }
-    } else {
-        //printf("JObj_getattro: passing through\n");
-    }
-    return value;
+    // Java fields and methods are descriptors (see JField_descr_get() and JOverloadedMethod_descr_get()),
+    // so both are looked up by the generic implementation. Once the type is resolved, JType_ResolveType()
+    // replaces this slot by PyObject_GenericGetAttr.
+    return PyObject_GenericGetAttr((PyObject*) self, name);
 }
 
 /**
@@ -668,21 +795,62 @@ static PySequenceMethods JObj_as_sequence = {
     NULL,   /* sq_inplace_repeat */
 };
 
+/*
+ * The tp_iter slot of 'java.lang.String[]'. Converts all strings in one go, using a single scratch buffer,
+ * instead of calling sq_item for every item.
+ */
+static PyObject* JObj_StringArray_iter(JPy_JObj* self)
+{
+    JNIEnv* jenv;
+    PyObject* pyList;
+    PyObject* pyIter;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    pyList = JPy_FromJStringArray(jenv, self->objectRef);
+    if (pyList == NULL) {
+        return NULL;
+    }
+    pyIter = PyObject_GetIter(pyList);
+    Py_DECREF(pyList);
+    return pyIter;
+}
+
+
+#if defined(JPY_COMPAT_ASYNC)
+/*
+ * Implements the <async> interface for types implementing java.util.concurrent.CompletionStage.
+ */
+static PyAsyncMethods JObj_as_async = {
+    (unaryfunc) JFuture_Await,           /* am_await */
+    NULL,   /* am_aiter */
+    NULL,   /* am_anext */
+};
+#endif
 
-int JType_InitSlots(JPy_JType* type)
+int JType_InitSlots(JNIEnv* jenv, JPy_JType* type)
 {
     PyTypeObject* typeObj;
     jboolean isArray;
     jboolean isPrimitiveArray;
+    jboolean isNestedPrimitiveArray;
+    JPy_JType* itemType;
 
     isArray = type->componentType != NULL;
     isPrimitiveArray = isArray && type->componentType->isPrimitive;
 
+    // Nested primitive arrays, e.g. 'double[][]', may export multi-dimensional buffers
+    itemType = type->componentType;
+    while (itemType != NULL && itemType->componentType != NULL) {
+        itemType = itemType->componentType;
+    }
+    isNestedPrimitiveArray = isArray && !isPrimitiveArray && itemType->isPrimitive;
+
     typeObj = (PyTypeObject*) type;
 
-    Py_REFCNT(typeObj) = 1;
-    Py_TYPE(typeObj) = NULL;
-    Py_SIZE(typeObj) = 0;
+    Py_SET_REFCNT(typeObj, 1);
+    Py_SET_TYPE(typeObj, NULL);
+    Py_SET_SIZE(typeObj, 0);
     // todo: The following lines are actually correct, but setting Py_TYPE(type) = &JType_Type results in an interpreter crash. Why?
     // This is still a problem because all the JType slots are actually never called (especially JType_getattro is
     // needed to resolve unresolved JTypes and to recognize static field and methods access)
@@ -691,8 +859,15 @@ int JType_InitSlots(JPy_JType* type)
     //Py_SIZE(type) = sizeof (JPy_JType);
 
     typeObj->tp_basicsize = isPrimitiveArray ? sizeof (JPy_JArray) : sizeof (JPy_JObj);
+    typeObj->tp_weaklistoffset = offsetof(JPy_JObj, weakrefs);
     typeObj->tp_itemsize = 0;
-    typeObj->tp_base = type->superType != NULL ? (PyTypeObject*) type->superType : &JType_Type;
+#if defined(JPY_COMPAT_MODULE_STATE)
+    // Root types, e.g. java.lang.Object and interfaces, derive from 'object'. They cannot derive from the
+    // meta type jpy.JType, which is then a heap type, while the Java types are not.
+    typeObj->tp_base = type->superType != NULL ? (PyTypeObject*) type->superType : &PyBaseObject_Type;
+#else
+    typeObj->tp_base = type->superType != NULL ? (PyTypeObject*) type->superType : JPy_GetModuleState()->jtypeType;
+#endif
     //typeObj->tp_base = (PyTypeObject*) type->superType;
     typeObj->tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE;
     // If I uncomment the following line, I get (unpredictable) interpreter crashes
@@ -700,7 +875,7 @@ int JType_InitSlots(JPy_JType* type)
     //typeObj->tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE | Py_TPFLAGS_HEAPTYPE;
 
     #if defined(JPY_COMPAT_27)
-    if (isPrimitiveArray) {
+    if (isPrimitiveArray || isNestedPrimitiveArray) {
         typeObj->tp_flags |= Py_TPFLAGS_HAVE_NEWBUFFER;
     }
     #endif
@@ -708,18 +883,30 @@ int JType_InitSlots(JPy_JType* type)
     typeObj->tp_getattro = (getattrofunc) JObj_getattro;
     typeObj->tp_setattro = (setattrofunc) JObj_setattro;
 
-    // Note: we may later want to add  <sequence> protocol to 'java.lang.String' and 'java.util.List' types.
-    // However, we cannot check directly against these global variable 'JPy_JString' and 'JPy_JList' here because
-    // the current function (JType_InitSlots) is called to compute the actual values for the global
-    // 'JPy_JString' and 'JPy_JList' variables!
-    // So we actually have to check against the Java Object types in order to create and assign slots for the
-    // Python protocols: java.lang.String --> sequence, java.util.Map --> dict, java.util.List --> list, java.util.Set --> set.
+    // Note: we may later want to add  <sequence> protocol to 'java.lang.String' types.
+    // However, we cannot check directly against the global variable 'JPy_JString' here because
+    // the current function (JType_InitSlots) is called to compute the actual value for the global
+    // 'JPy_JString' variable!
+    // So we actually have to check against the Java classes in order to create and assign slots for the
+    // Python protocols, as done for java.util.List --> list, java.util.Map --> dict (see JColl_InitSlots()).
 
 
     // If this type is an array type, add support for the <sequence> protocol
     if (isArray) {
         typeObj->tp_as_sequence = &JObj_as_sequence;
+        if ((*jenv)->IsSameObject(jenv, type->componentType->classRef, JPy_String_JClass)) {
+            typeObj->tp_iter = (getiterfunc) JObj_StringArray_iter;
+        }
+    } else {
+        JColl_InitSlots(jenv, type);
+    }
+
+    #if defined(JPY_COMPAT_ASYNC)
+    // If this type is a Java future, make its instances awaitable
+    if (JPy_CompletionStage_JClass != NULL && (*jenv)->IsAssignableFrom(jenv, type->classRef, JPy_CompletionStage_JClass)) {
+        typeObj->tp_as_async = &JObj_as_async;
     }
+    #endif
 
     if (isPrimitiveArray) {
         const char* componentTypeName = type->componentType->javaName;
@@ -740,6 +927,8 @@ int JType_InitSlots(JPy_JType* type)
         } else if (strcmp(componentTypeName, "double") == 0) {
             typeObj->tp_as_buffer = &JArray_as_buffer_double;
         }
+    } else if (isNestedPrimitiveArray) {
+        typeObj->tp_as_buffer = &JArray_as_nd_buffer;
     }
 
     //printf("JType_InitSlots: typeObj->tp_as_buffer=%p\n", typeObj->tp_as_buffer);
@@ -763,10 +952,14 @@ int JType_InitSlots(JPy_JType* type)
         return -1;
     }
 
+    if (!isArray) {
+        JColl_RegisterAbc(jenv, type);
+    }
+
     //printf("+++++++++++++++++++++++++++++++++++++++++ typeObj->ob_type=%p\n", ((PyObject*)typeObj)->ob_type);
 
-    JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_InitSlots: typeObj=%p, Py_TYPE(typeObj)=%p, typeObj->tp_name=\"%s\", typeObj->tp_base=%p, typeObj->tp_init=%p, &JType_Type=%p, &PyType_Type=%p, JObj_init=%p\n",
-                   typeObj, Py_TYPE(typeObj), typeObj->tp_name, typeObj->tp_base, typeObj->tp_init, &JType_Type, &PyType_Type, JObj_init);
+    JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_InitSlots: typeObj=%p, Py_TYPE(typeObj)=%p, typeObj->tp_name=\"%s\", typeObj->tp_base=%p, typeObj->tp_init=%p, JType_Type=%p, &PyType_Type=%p, JObj_init=%p\n",
+                   typeObj, Py_TYPE(typeObj), typeObj->tp_name, typeObj->tp_base, typeObj->tp_init, JPy_GetModuleState()->jtypeType, &PyType_Type, JObj_init);
 
     return 0;
 }
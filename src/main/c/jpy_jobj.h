@@ -31,14 +31,21 @@ typedef struct JPy_JObj
 {
     PyObject_HEAD
     jobject objectRef;
+    // The list of weak references to this wrapper, used by the identity cache of its type
+    PyObject* weakrefs;
 }
 JPy_JObj;
 
+// The minimum size of a type's identity cache above which dead weak references are purged
+#define JPy_IDENTITY_CACHE_MIN_LIMIT 64
+
 
 int JObj_Check(PyObject* arg);
 
 JPy_JObj* JObj_New(JNIEnv* jenv, jobject objectRef);
 JPy_JObj* JObj_FromType(JNIEnv* jenv, JPy_JType* type, jobject objectRef);
+PyObject* JObj_getattro(JPy_JObj* self, PyObject* name);
+int JObj_setattro(JPy_JObj* self, PyObject* name, PyObject* value);
 
 int JObj_InitTypeSlots(PyTypeObject* type, const char* typeName, PyTypeObject* superType);
 
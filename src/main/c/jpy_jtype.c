@@ -32,6 +32,7 @@ int JType_ProcessClassConstructors(JNIEnv* jenv, JPy_JType* type);
 int JType_ProcessClassFields(JNIEnv* jenv, JPy_JType* type);
 int JType_ProcessClassMethods(JNIEnv* jenv, JPy_JType* type);
 int JType_AddMethod(JPy_JType* type, JPy_JMethod* method);
+int JType_InitDispatchTables(JNIEnv* jenv, JPy_JType* type);
 JPy_ReturnDescriptor* JType_CreateReturnDescriptor(JNIEnv* jenv, jclass returnType);
 JPy_ParamDescriptor* JType_CreateParamDescriptors(JNIEnv* jenv, int paramCount, jarray paramTypes);
 void JType_InitParamDescriptorFunctions(JPy_ParamDescriptor* paramDescriptor);
@@ -113,25 +114,14 @@ JPy_JType* JType_GetTypeForName(JNIEnv* jenv, const char* typeName, jboolean res
 }
 
 /**
- * Returns a new reference.
+ * Looks up or creates the type for the given typeKey (whose reference is stolen) while holding the type lock.
  */
-JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve)
+static JPy_JType* JType_GetTypeLocked(JNIEnv* jenv, jclass classRef, PyObject* typeKey, jboolean resolve)
 {
-    PyObject* typeKey;
     PyObject* typeValue;
     JPy_JType* type;
     jboolean found;
 
-    if (JPy_Types == NULL) {
-        PyErr_SetString(PyExc_RuntimeError, "jpy internal error: module 'jpy' not initialized");
-        return NULL;
-    }
-
-    typeKey = JPy_FromTypeName(jenv, classRef);
-    if (typeKey == NULL) {
-        return NULL;
-    }
-
     typeValue = PyDict_GetItem(JPy_Types, typeKey);
     if (typeValue == NULL) {
 
@@ -168,7 +158,7 @@ JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve)
         //printf("T4: type->tp_init=%p\n", ((PyTypeObject*)type)->tp_init);
 
         // Finally we initialise the type's slots, so that our JObj instances behave pythonic.
-        if (JType_InitSlots(type) < 0) {
+        if (JType_InitSlots(jenv, type) < 0) {
             JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_GetType: error: JType_InitSlots() failed for javaName=\"%s\"\n", type->javaName);
             PyDict_DelItem(JPy_Types, typeKey);
             return NULL;
@@ -179,7 +169,7 @@ JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve)
         //printf("T5: type->tp_init=%p\n", ((PyTypeObject*)type)->tp_init);
 
     } else {
-        jboolean isTypeInProgress = typeValue->ob_type == &JType_Type;
+        jboolean isTypeInProgress = typeValue->ob_type == JPy_GetModuleState()->jtypeType;
         jboolean isFinalizedType = PyType_Check(typeValue);
 
         found = JNI_TRUE;
@@ -202,7 +192,7 @@ JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve)
 
     JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_GetType: javaName=\"%s\", found=%d, resolve=%d, resolved=%d, type=%p\n", type->javaName, found, resolve, type->isResolved, type);
 
-    if (!type->isResolved && resolve) {
+    if (!JPy_LOAD_FLAG(type->isResolved) && resolve) {
         if (JType_ResolveType(jenv, type) < 0) {
             return NULL;
         }
@@ -211,6 +201,219 @@ JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve)
     return type;
 }
 
+/**
+ * Returns a new reference.
+ */
+JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve)
+{
+    PyObject* typeKey;
+    JPy_JType* type;
+
+    if (JPy_Types == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "jpy internal error: module 'jpy' not initialized");
+        return NULL;
+    }
+
+    typeKey = JPy_FromTypeName(jenv, classRef);
+    if (typeKey == NULL) {
+        return NULL;
+    }
+
+    // Resolved types are complete and never removed from JPy_Types, so they are looked up without the type lock.
+    type = (JPy_JType*) PyDict_GetItem(JPy_Types, typeKey);
+    if (type != NULL && JType_Check((PyObject*) type) && JPy_LOAD_FLAG(type->isResolved)) {
+        Py_DECREF(typeKey);
+        return type;
+    }
+
+    JType_LockTypes();
+    type = JType_GetTypeLocked(jenv, classRef, typeKey, resolve);
+    JType_UnlockTypes();
+    return type;
+}
+
+#if defined(JPY_COMPAT_FREE_THREADING)
+#define JType_LOAD_LOCK_OWNER(state)            _Py_atomic_load_ulong_relaxed(&(state)->typeLockOwner)
+#define JType_STORE_LOCK_OWNER(state, thread)   _Py_atomic_store_ulong_relaxed(&(state)->typeLockOwner, thread)
+#else
+// The owner is only written and compared while holding the GIL
+#define JType_LOAD_LOCK_OWNER(state)            ((state)->typeLockOwner)
+#define JType_STORE_LOCK_OWNER(state, thread)   ((state)->typeLockOwner = (thread))
+#endif
+
+/**
+ * Acquires the type lock of the current interpreter. The lock is recursive, because creating
+ * or resolving a type creates and resolves its super, component, parameter and return types.
+ * The thread state is detached while waiting for the lock, so the owner can take the GIL.
+ */
+void JType_LockTypes(void)
+{
+    JPy_ModuleState* state = JPy_GetModuleState();
+    unsigned long thread = PyThread_get_thread_ident();
+
+    if (JType_LOAD_LOCK_OWNER(state) == thread) {
+        state->typeLockDepth++;
+        return;
+    }
+#if defined(JPY_COMPAT_FREE_THREADING)
+    PyMutex_Lock(&state->typeLock);
+#else
+    if (!PyThread_acquire_lock(state->typeLock, NOWAIT_LOCK)) {
+        Py_BEGIN_ALLOW_THREADS
+        PyThread_acquire_lock(state->typeLock, WAIT_LOCK);
+        Py_END_ALLOW_THREADS
+    }
+#endif
+    JType_STORE_LOCK_OWNER(state, thread);
+    state->typeLockDepth = 1;
+}
+
+/**
+ * Releases the type lock of the current interpreter.
+ */
+void JType_UnlockTypes(void)
+{
+    JPy_ModuleState* state = JPy_GetModuleState();
+
+    if (--state->typeLockDepth == 0) {
+        JType_STORE_LOCK_OWNER(state, 0);
+#if defined(JPY_COMPAT_FREE_THREADING)
+        PyMutex_Unlock(&state->typeLock);
+#else
+        PyThread_release_lock(state->typeLock);
+#endif
+    }
+}
+
+/**
+ * Enables or disables the identity cache of the given type, which lets JObj_FromType() return the existing
+ * wrapper of a Java object instead of creating a new one. Returns the previous setting, or -1 on error.
+ */
+int JType_SetIdentityCache(JPy_JType* type, jboolean enabled)
+{
+    PyObject* newCache;
+    PyObject* oldCache;
+    int wasEnabled;
+
+    newCache = NULL;
+    oldCache = NULL;
+    if (enabled) {
+        newCache = PyDict_New();
+        if (newCache == NULL) {
+            return -1;
+        }
+    }
+
+    // The cache is replaced in a critical section, other threads may be using it, see JType_GetIdentityCache()
+    JPy_BEGIN_CRITICAL_SECTION((PyObject*) type);
+    wasEnabled = type->identityCache != NULL;
+    if (enabled && !wasEnabled) {
+        type->identityCacheLimit = JPy_IDENTITY_CACHE_MIN_LIMIT;
+        type->identityCache = newCache;
+        newCache = NULL;
+    } else if (!enabled && wasEnabled) {
+        oldCache = type->identityCache;
+        type->identityCache = NULL;
+    }
+    JPy_END_CRITICAL_SECTION();
+
+    Py_XDECREF(newCache);
+    Py_XDECREF(oldCache);
+    return wasEnabled;
+}
+
+/**
+ * Returns a new reference to the identity cache of the given type, or NULL if it is disabled.
+ */
+PyObject* JType_GetIdentityCache(JPy_JType* type)
+{
+    PyObject* cache;
+
+    JPy_BEGIN_CRITICAL_SECTION((PyObject*) type);
+    cache = type->identityCache;
+    Py_XINCREF(cache);
+    JPy_END_CRITICAL_SECTION();
+    return cache;
+}
+
+/**
+ * Preloads the types of the Java classes given by a sequence of class names and package patterns,
+ * e.g. 'com.acme.*'. The classes are loaded and their reflection data is computed in parallel by Java threads
+ * (see org.jpy.PyPreloader) while the GIL is released. Then their types are created and resolved one by one.
+ * Returns the number of preloaded types, or -1 on error.
+ */
+int JType_PreloadTypes(JNIEnv* jenv, PyObject* names)
+{
+    JPy_JType* preloaderType;
+    jmethodID loadClassesMID;
+    PyObject* nameSeq;
+    jobjectArray nameArray;
+    jobjectArray classArray;
+    jstring nameRef;
+    jclass classRef;
+    JPy_JType* type;
+    Py_ssize_t nameCount;
+    Py_ssize_t i;
+    jint classCount;
+    jint j;
+
+    preloaderType = JType_GetTypeForName(jenv, "org.jpy.PyPreloader", JNI_FALSE);
+    if (preloaderType == NULL) {
+        PyErr_Clear();
+        PyErr_SetString(PyExc_RuntimeError, "jpy: Java class 'org.jpy.PyPreloader' not found, the jpy JAR must be on the Java classpath");
+        return -1;
+    }
+    loadClassesMID = (*jenv)->GetStaticMethodID(jenv, preloaderType->classRef, "loadClasses", "([Ljava/lang/String;)[Ljava/lang/Class;");
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+
+    nameSeq = PySequence_Fast(names, "preload: argument 1 (names) must be a sequence of class names");
+    if (nameSeq == NULL) {
+        return -1;
+    }
+    nameCount = PySequence_Fast_GET_SIZE(nameSeq);
+    nameArray = (*jenv)->NewObjectArray(jenv, (jsize) nameCount, JPy_String_JClass, NULL);
+    if (nameArray == NULL) {
+        Py_DECREF(nameSeq);
+        PyErr_NoMemory();
+        return -1;
+    }
+    for (i = 0; i < nameCount; i++) {
+        if (JPy_AsJString(jenv, PySequence_Fast_GET_ITEM(nameSeq, i), &nameRef) < 0) {
+            Py_DECREF(nameSeq);
+            (*jenv)->DeleteLocalRef(jenv, nameArray);
+            return -1;
+        }
+        (*jenv)->SetObjectArrayElement(jenv, nameArray, (jsize) i, nameRef);
+        (*jenv)->DeleteLocalRef(jenv, nameRef);
+    }
+    Py_DECREF(nameSeq);
+
+    // Loading classes and reflecting on them is the expensive part, so let other Python threads run meanwhile
+    Py_BEGIN_ALLOW_THREADS
+    classArray = (*jenv)->CallStaticObjectMethod(jenv, preloaderType->classRef, loadClassesMID, nameArray);
+    Py_END_ALLOW_THREADS
+    (*jenv)->DeleteLocalRef(jenv, nameArray);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+
+    classCount = (*jenv)->GetArrayLength(jenv, classArray);
+    for (j = 0; j < classCount; j++) {
+        classRef = (*jenv)->GetObjectArrayElement(jenv, classArray, j);
+        type = JType_GetType(jenv, classRef, JNI_TRUE);
+        (*jenv)->DeleteLocalRef(jenv, classRef);
+        if (type == NULL) {
+            (*jenv)->DeleteLocalRef(jenv, classArray);
+            return -1;
+        }
+        // Give threads waiting for the GIL a chance to run between two types
+        Py_BEGIN_ALLOW_THREADS
+        Py_END_ALLOW_THREADS
+    }
+    (*jenv)->DeleteLocalRef(jenv, classArray);
+
+    JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_PreloadTypes: preloaded %d types\n", classCount);
+    return classCount;
+}
+
 /**
  * Creates a type instance of the meta type 'JType_Type'.
  * Such type instances are used as types for Java Objects in Python.
@@ -220,7 +423,7 @@ JPy_JType* JType_New(JNIEnv* jenv, jclass classRef, jboolean resolve)
     PyTypeObject* metaType;
     JPy_JType* type;
 
-    metaType = &JType_Type;
+    metaType = JPy_GetModuleState()->jtypeType;
 
     type = (JPy_JType*) metaType->tp_alloc(metaType, 0);
     if (type == NULL) {
@@ -232,6 +435,9 @@ JPy_JType* JType_New(JNIEnv* jenv, jclass classRef, jboolean resolve)
     type->classRef = NULL;
     type->isResolved = JNI_FALSE;
     type->isResolving = JNI_FALSE;
+    type->identityCache = NULL;
+    type->identityCacheLimit = 0;
+    type->functionalInterface = 0;
 
     type->javaName = JPy_GetTypeName(jenv, classRef);
     if (type->javaName == NULL) {
@@ -268,28 +474,51 @@ PyObject* JType_ConvertJavaToPythonObject(JNIEnv* jenv, JPy_JType* type, jobject
 
     if (type->componentType == NULL) {
         // Scalar type, not an array, try to convert to Python equivalent
+        // The wrapper classes are final, so their 'value' fields are read directly instead of calling e.g. intValue()
         if (type == JPy_JBooleanObj) {
-            jboolean value = (*jenv)->CallBooleanMethod(jenv, objectRef, JPy_Boolean_BooleanValue_MID);
+            jboolean value = JPy_Boolean_Value_FID != NULL ? (*jenv)->GetBooleanField(jenv, objectRef, JPy_Boolean_Value_FID)
+                                                           : (*jenv)->CallBooleanMethod(jenv, objectRef, JPy_Boolean_BooleanValue_MID);
             JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
             return JPy_FROM_JBOOLEAN(value);
         } else if (type == JPy_JCharacterObj) {
-            jchar value = (*jenv)->CallCharMethod(jenv, objectRef, JPy_Character_CharValue_MID);
+            jchar value = JPy_Character_Value_FID != NULL ? (*jenv)->GetCharField(jenv, objectRef, JPy_Character_Value_FID)
+                                                          : (*jenv)->CallCharMethod(jenv, objectRef, JPy_Character_CharValue_MID);
             JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
             return JPy_FROM_JCHAR(value);
-        } else if (type == JPy_JByteObj || type == JPy_JShortObj || type == JPy_JIntegerObj) {
-            jint value = (*jenv)->CallIntMethod(jenv, objectRef, JPy_Number_IntValue_MID);
+        } else if (type == JPy_JByteObj) {
+            jint value = JPy_Byte_Value_FID != NULL ? (*jenv)->GetByteField(jenv, objectRef, JPy_Byte_Value_FID)
+                                                    : (*jenv)->CallIntMethod(jenv, objectRef, JPy_Number_IntValue_MID);
+            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+            return JPy_FROM_JINT(value);
+        } else if (type == JPy_JShortObj) {
+            jint value = JPy_Short_Value_FID != NULL ? (*jenv)->GetShortField(jenv, objectRef, JPy_Short_Value_FID)
+                                                     : (*jenv)->CallIntMethod(jenv, objectRef, JPy_Number_IntValue_MID);
+            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+            return JPy_FROM_JINT(value);
+        } else if (type == JPy_JIntegerObj) {
+            jint value = JPy_Integer_Value_FID != NULL ? (*jenv)->GetIntField(jenv, objectRef, JPy_Integer_Value_FID)
+                                                       : (*jenv)->CallIntMethod(jenv, objectRef, JPy_Number_IntValue_MID);
             JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
             return JPy_FROM_JINT(value);
         } else if (type == JPy_JLongObj) {
-            jlong value = (*jenv)->CallLongMethod(jenv, objectRef, JPy_Number_LongValue_MID);
+            jlong value = JPy_Long_Value_FID != NULL ? (*jenv)->GetLongField(jenv, objectRef, JPy_Long_Value_FID)
+                                                     : (*jenv)->CallLongMethod(jenv, objectRef, JPy_Number_LongValue_MID);
             JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
             return JPy_FROM_JLONG(value);
-        } else if (type == JPy_JFloatObj || type == JPy_JDoubleObj) {
-            jdouble value = (*jenv)->CallDoubleMethod(jenv, objectRef, JPy_Number_DoubleValue_MID);
+        } else if (type == JPy_JFloatObj) {
+            jdouble value = JPy_Float_Value_FID != NULL ? (*jenv)->GetFloatField(jenv, objectRef, JPy_Float_Value_FID)
+                                                        : (*jenv)->CallDoubleMethod(jenv, objectRef, JPy_Number_DoubleValue_MID);
+            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+            return JPy_FROM_JDOUBLE(value);
+        } else if (type == JPy_JDoubleObj) {
+            jdouble value = JPy_Double_Value_FID != NULL ? (*jenv)->GetDoubleField(jenv, objectRef, JPy_Double_Value_FID)
+                                                         : (*jenv)->CallDoubleMethod(jenv, objectRef, JPy_Number_DoubleValue_MID);
             JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
             return JPy_FROM_JDOUBLE(value);
         } else if (type == JPy_JPyObject || type == JPy_JPyModule) {
             jlong value = (*jenv)->CallLongMethod(jenv, objectRef, JPy_PyObject_GetPointer_MID);
+            JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+            Py_INCREF((PyObject*) value);
             return (PyObject*) value;
         } else if (type == JPy_JString) {
             return JPy_FromJString(jenv, objectRef);
@@ -333,6 +562,21 @@ int JType_CreateJavaObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jclas
     return 0;
 }
 
+/**
+ * Boxes a primitive value using the static valueOf() method of a wrapper class, which returns
+ * cached instances for small integers, characters and booleans instead of allocating new objects.
+ */
+int JType_CreateJavaBoxObject(JNIEnv* jenv, jclass classRef, jmethodID valueOfMID, jvalue value, jobject* objectRef)
+{
+    *objectRef = (*jenv)->CallStaticObjectMethodA(jenv, classRef, valueOfMID, &value);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    if (*objectRef == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
 int JType_CreateJavaBooleanObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
 {
     jvalue value;
@@ -341,7 +585,7 @@ int JType_CreateJavaBooleanObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg
     } else {
         return JType_PythonToJavaConversionError(type, pyArg);
     }
-    return JType_CreateJavaObject(jenv, type, pyArg, JPy_Boolean_JClass, JPy_Boolean_Init_MID, value, objectRef);
+    return JType_CreateJavaBoxObject(jenv, JPy_Boolean_JClass, JPy_Boolean_ValueOf_MID, value, objectRef);
 }
 
 int JType_CreateJavaCharacterObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
@@ -352,7 +596,7 @@ int JType_CreateJavaCharacterObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyA
     } else {
         return JType_PythonToJavaConversionError(type, pyArg);
     }
-    return JType_CreateJavaObject(jenv, type, pyArg, JPy_Character_JClass, JPy_Character_Init_MID, value, objectRef);
+    return JType_CreateJavaBoxObject(jenv, JPy_Character_JClass, JPy_Character_ValueOf_MID, value, objectRef);
 }
 
 int JType_CreateJavaByteObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
@@ -363,7 +607,7 @@ int JType_CreateJavaByteObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, j
     } else {
         return JType_PythonToJavaConversionError(type, pyArg);
     }
-    return JType_CreateJavaObject(jenv, type, pyArg, JPy_Byte_JClass, JPy_Byte_Init_MID, value, objectRef);
+    return JType_CreateJavaBoxObject(jenv, JPy_Byte_JClass, JPy_Byte_ValueOf_MID, value, objectRef);
 }
 
 int JType_CreateJavaShortObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
@@ -374,7 +618,7 @@ int JType_CreateJavaShortObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg,
     } else {
         return JType_PythonToJavaConversionError(type, pyArg);
     }
-    return JType_CreateJavaObject(jenv, type, pyArg, JPy_Short_JClass, JPy_Short_Init_MID, value, objectRef);
+    return JType_CreateJavaBoxObject(jenv, JPy_Short_JClass, JPy_Short_ValueOf_MID, value, objectRef);
 }
 
 int JType_CreateJavaIntegerObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
@@ -385,7 +629,7 @@ int JType_CreateJavaIntegerObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg
     } else {
         return JType_PythonToJavaConversionError(type, pyArg);
     }
-    return JType_CreateJavaObject(jenv, type, pyArg, JPy_Integer_JClass, JPy_Integer_Init_MID, value, objectRef);
+    return JType_CreateJavaBoxObject(jenv, JPy_Integer_JClass, JPy_Integer_ValueOf_MID, value, objectRef);
 }
 
 int JType_CreateJavaLongObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
@@ -396,7 +640,7 @@ int JType_CreateJavaLongObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, j
     } else {
         return JType_PythonToJavaConversionError(type, pyArg);
     }
-    return JType_CreateJavaObject(jenv, type, pyArg, JPy_Long_JClass, JPy_Long_Init_MID, value, objectRef);
+    return JType_CreateJavaBoxObject(jenv, JPy_Long_JClass, JPy_Long_ValueOf_MID, value, objectRef);
 }
 
 int JType_CreateJavaFloatObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
@@ -409,7 +653,7 @@ int JType_CreateJavaFloatObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg,
     } else {
         return JType_PythonToJavaConversionError(type, pyArg);
     }
-    return JType_CreateJavaObject(jenv, type, pyArg, JPy_Float_JClass, JPy_Float_Init_MID, value, objectRef);
+    return JType_CreateJavaBoxObject(jenv, JPy_Float_JClass, JPy_Float_ValueOf_MID, value, objectRef);
 }
 
 int JType_CreateJavaDoubleObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
@@ -422,14 +666,164 @@ int JType_CreateJavaDoubleObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg,
     } else {
         return JType_PythonToJavaConversionError(type, pyArg);
     }
-    return JType_CreateJavaObject(jenv, type, pyArg, JPy_Double_JClass, JPy_Double_Init_MID, value, objectRef);
+    return JType_CreateJavaBoxObject(jenv, JPy_Double_JClass, JPy_Double_ValueOf_MID, value, objectRef);
 }
 
 int JType_CreateJavaPyObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
 {
     jvalue value;
+    // The new org.jpy.PyObject takes over the ownership of a new reference
+    Py_INCREF(pyArg);
     value.j = (jlong) pyArg;
-    return JType_CreateJavaObject(jenv, type, pyArg, type->classRef, JPy_PyObject_Init_MID, value, objectRef);
+    if (JType_CreateJavaObject(jenv, type, pyArg, type->classRef, JPy_PyObject_Init_MID, value, objectRef) < 0) {
+        Py_DECREF(pyArg);
+        return -1;
+    }
+    return 0;
+}
+
+// The static methods of org.jpy.PyCallableAdapter, see JType_GetCallableAdapterClass()
+static jmethodID JType_CallableAdapter_IsFunctionalInterface_MID = NULL;
+static jmethodID JType_CallableAdapter_Create_MID = NULL;
+
+/**
+ * Returns the class org.jpy.PyCallableAdapter, or NULL with a Python error set if it is not on the Java classpath.
+ */
+static jclass JType_GetCallableAdapterClass(JNIEnv* jenv)
+{
+    JPy_JType* adapterType;
+
+    adapterType = JType_GetTypeForName(jenv, "org.jpy.PyCallableAdapter", JNI_FALSE);
+    if (adapterType == NULL) {
+        return NULL;
+    }
+    if (JType_CallableAdapter_Create_MID == NULL) {
+        JType_CallableAdapter_IsFunctionalInterface_MID = (*jenv)->GetStaticMethodID(jenv, adapterType->classRef, "isFunctionalInterface", "(Ljava/lang/Class;)Z");
+        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+        JType_CallableAdapter_Create_MID = (*jenv)->GetStaticMethodID(jenv, adapterType->classRef, "create", "(Ljava/lang/Class;J)Ljava/lang/Object;");
+        JPy_ON_JAVA_EXCEPTION_RETURN(NULL);
+    }
+    return adapterType->classRef;
+}
+
+// The static wrap() methods of org.jpy.PyListView and org.jpy.PyMapView, see JType_GetJavaViewClass()
+static jmethodID JType_ListView_Wrap_MID = NULL;
+static jmethodID JType_MapView_Wrap_MID = NULL;
+
+/**
+ * Returns the class of the live Java view of the given Python list or tuple (org.jpy.PyListView) or dict
+ * (org.jpy.PyMapView) and its static wrap() method. Returns NULL for other Python objects and if the view
+ * classes are not on the Java classpath.
+ */
+static jclass JType_GetJavaViewClass(JNIEnv* jenv, PyObject* pyArg, jmethodID* wrapMID)
+{
+    JPy_JType* viewType;
+    jmethodID* viewWrapMID;
+    const char* className;
+    const char* signature;
+
+    if (PyList_Check(pyArg) || PyTuple_Check(pyArg)) {
+        className = "org.jpy.PyListView";
+        signature = "(J)Lorg/jpy/PyListView;";
+        viewWrapMID = &JType_ListView_Wrap_MID;
+    } else if (PyDict_Check(pyArg)) {
+        className = "org.jpy.PyMapView";
+        signature = "(J)Lorg/jpy/PyMapView;";
+        viewWrapMID = &JType_MapView_Wrap_MID;
+    } else {
+        return NULL;
+    }
+
+    viewType = JType_GetTypeForName(jenv, className, JNI_FALSE);
+    if (viewType == NULL) {
+        PyErr_Clear();
+        return NULL;
+    }
+    if (*viewWrapMID == NULL) {
+        *viewWrapMID = (*jenv)->GetStaticMethodID(jenv, viewType->classRef, "wrap", signature);
+        if (*viewWrapMID == NULL) {
+            (*jenv)->ExceptionClear(jenv);
+            return NULL;
+        }
+    }
+    *wrapMID = *viewWrapMID;
+    return viewType->classRef;
+}
+
+/**
+ * Creates a live Java view (org.jpy.PyListView or org.jpy.PyMapView) of the given Python list, tuple or dict,
+ * if it can be passed for the given type. Returns 1 and a new local reference if so, 0 if not, and -1 on error.
+ */
+static int JType_CreateJavaView(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
+{
+    jclass viewClass;
+    jmethodID wrapMID;
+
+    viewClass = JType_GetJavaViewClass(jenv, pyArg, &wrapMID);
+    if (viewClass == NULL || !(*jenv)->IsAssignableFrom(jenv, viewClass, type->classRef)) {
+        return 0;
+    }
+
+    // The view's org.jpy.PyObject takes over the ownership of a new reference
+    Py_INCREF(pyArg);
+    *objectRef = (*jenv)->CallStaticObjectMethod(jenv, viewClass, wrapMID, (jlong) pyArg);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return 1;
+}
+
+/**
+ * Returns 1 if the given type is a Java interface with a single abstract method, such as java.lang.Runnable
+ * or java.util.function.Function, whose parameters accept Python callables. Otherwise returns 0.
+ * The result is cached by the type.
+ */
+int JType_IsFunctionalInterface(JNIEnv* jenv, JPy_JType* type)
+{
+    char functionalInterface;
+    jclass adapterClass;
+    jboolean result;
+
+    if (!type->isInterface) {
+        return 0;
+    }
+    functionalInterface = JPy_LOAD_FLAG(type->functionalInterface);
+    if (functionalInterface != 0) {
+        return functionalInterface == JType_FUNCTIONAL_YES;
+    }
+
+    adapterClass = JType_GetCallableAdapterClass(jenv);
+    if (adapterClass == NULL) {
+        // Without the jpy JAR on the classpath, no interface is treated as functional interface
+        PyErr_Clear();
+        result = JNI_FALSE;
+    } else {
+        result = (*jenv)->CallStaticBooleanMethod(jenv, adapterClass, JType_CallableAdapter_IsFunctionalInterface_MID, type->classRef);
+        if ((*jenv)->ExceptionCheck(jenv)) {
+            (*jenv)->ExceptionClear(jenv);
+            result = JNI_FALSE;
+        }
+    }
+    JPy_STORE_FLAG(type->functionalInterface, result ? JType_FUNCTIONAL_YES : JType_FUNCTIONAL_NO);
+    return result ? 1 : 0;
+}
+
+/**
+ * Creates an instance of the given functional interface which calls the given Python callable
+ * (see org.jpy.PyCallableAdapter). Returns a new local reference.
+ */
+int JType_CreateJavaCallableAdapter(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
+{
+    jclass adapterClass;
+
+    adapterClass = JType_GetCallableAdapterClass(jenv);
+    if (adapterClass == NULL) {
+        return -1;
+    }
+
+    // The adapter's org.jpy.PyObject takes over the ownership of a new reference
+    Py_INCREF(pyArg);
+    *objectRef = (*jenv)->CallStaticObjectMethod(jenv, adapterClass, JType_CallableAdapter_Create_MID, type->classRef, (jlong) pyArg);
+    JPy_ON_JAVA_EXCEPTION_RETURN(-1);
+    return 0;
 }
 
 int JType_CreateJavaArray(JNIEnv* jenv, JPy_JType* componentType, PyObject* pyArg, jobject* objectRef)
@@ -451,6 +845,11 @@ int JType_CreateJavaArray(JNIEnv* jenv, JPy_JType* componentType, PyObject* pyAr
         return -1;
     }
 
+    if (componentType == JPy_JString && itemCount > 0) {
+        // Strings are transcoded using a single scratch buffer
+        return JPy_AsJStringArray(jenv, pyArg, (jobjectArray*) objectRef);
+    }
+
     arrayRef = NULL;
 
     if (componentType == JPy_JBoolean) {
@@ -732,6 +1131,8 @@ int JType_CreateJavaArray(JNIEnv* jenv, JPy_JType* componentType, PyObject* pyAr
 
 int JType_ConvertPythonToJavaObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
 {
+    int viewCreated;
+
     // Note: There may be a potential memory leak here.
     // If a new local reference is created in this function and assigned to *objectRef, the reference may escape.
     // If the reference is created for an argument to a JNI call, we already delete the ref (see JMethod_InvokeMethod()).
@@ -780,21 +1181,67 @@ int JType_ConvertPythonToJavaObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyA
         if (JPy_IS_STR(pyArg)) {
             return JPy_AsJString(jenv, pyArg, objectRef);
         }
+    } else if (type->isInterface && PyCallable_Check(pyArg) && JType_IsFunctionalInterface(jenv, type)) {
+        return JType_CreateJavaCallableAdapter(jenv, type, pyArg, objectRef);
+    }
+    // Python lists, tuples and dicts are passed to java.util.List, java.util.Map (or super types) as live views
+    viewCreated = JType_CreateJavaView(jenv, type, pyArg, objectRef);
+    if (viewCreated != 0) {
+        return viewCreated < 0 ? -1 : 0;
     }
     return JType_PythonToJavaConversionError(type, pyArg);
 }
 
+static int JType_ConvertPythonToJavaString(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef)
+{
+    if (JPy_IS_STR(pyArg)) {
+        return JPy_AsJString(jenv, pyArg, objectRef);
+    }
+    return JType_ConvertPythonToJavaObject(jenv, type, pyArg, objectRef);
+}
+
+/**
+ * Returns the converter for many values of the same target type, so that the dispatch on the type done by
+ * JType_ConvertPythonToJavaObject() is done only once, e.g. for the items of a collection.
+ * Primitive types are converted into their boxed types.
+ */
+JType_PythonToJavaConverter JType_GetPythonToJavaConverter(JPy_JType* type)
+{
+    if (type->componentType != NULL) {
+        return JType_ConvertPythonToJavaObject;
+    } else if (type == JPy_JBoolean || type == JPy_JBooleanObj) {
+        return JType_CreateJavaBooleanObject;
+    } else if (type == JPy_JChar || type == JPy_JCharacterObj) {
+        return JType_CreateJavaCharacterObject;
+    } else if (type == JPy_JByte || type == JPy_JByteObj) {
+        return JType_CreateJavaByteObject;
+    } else if (type == JPy_JShort || type == JPy_JShortObj) {
+        return JType_CreateJavaShortObject;
+    } else if (type == JPy_JInt || type == JPy_JIntegerObj) {
+        return JType_CreateJavaIntegerObject;
+    } else if (type == JPy_JLong || type == JPy_JLongObj) {
+        return JType_CreateJavaLongObject;
+    } else if (type == JPy_JFloat || type == JPy_JFloatObj) {
+        return JType_CreateJavaFloatObject;
+    } else if (type == JPy_JDouble || type == JPy_JDoubleObj) {
+        return JType_CreateJavaDoubleObject;
+    } else if (type == JPy_JPyObject) {
+        return JType_CreateJavaPyObject;
+    } else if (type == JPy_JString) {
+        return JType_ConvertPythonToJavaString;
+    }
+    return JType_ConvertPythonToJavaObject;
+}
+
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // The following functions deal with type creation, initialisation, and resolution.
 
 
 /**
- * Fill the type __dict__ with our Java class constructors and methods.
- * Constructors will be available using the key named __jinit__.
- * Methods will be available using their method name.
+ * Resolves the given type while holding the type lock, see JType_ResolveType().
  */
-int JType_ResolveType(JNIEnv* jenv, JPy_JType* type)
+static int JType_ResolveTypeLocked(JNIEnv* jenv, JPy_JType* type)
 {
     PyTypeObject* typeObj;
 
@@ -807,7 +1254,7 @@ int JType_ResolveType(JNIEnv* jenv, JPy_JType* type)
     typeObj = (PyTypeObject*) type;
     if (typeObj->tp_base != NULL && JType_Check((PyObject*) typeObj->tp_base)) {
         JPy_JType* baseType = (JPy_JType*) typeObj->tp_base;
-        if (!baseType->isResolved) {
+        if (!JPy_LOAD_FLAG(baseType->isResolved)) {
             if (JType_ResolveType(jenv, baseType) < 0) {
                 type->isResolving = JNI_FALSE;
                 return -1;
@@ -827,6 +1274,11 @@ int JType_ResolveType(JNIEnv* jenv, JPy_JType* type)
         return -1;
     }
 
+    if (JType_InitDispatchTables(jenv, type) < 0) {
+        type->isResolving = JNI_FALSE;
+        return -1;
+    }
+
     //printf("JType_ResolveType 3\n");
     if (JType_ProcessClassFields(jenv, type) < 0) {
         type->isResolving = JNI_FALSE;
@@ -835,10 +1287,42 @@ int JType_ResolveType(JNIEnv* jenv, JPy_JType* type)
 
     //printf("JType_ResolveType 4\n");
     type->isResolving = JNI_FALSE;
-    type->isResolved = JNI_TRUE;
+
+    // All fields and methods are now in the type's dictionary, so instances can use the generic attribute access.
+    // This also lets Python 3.8+ call Java methods without creating bound methods, see JOverloadedMethod_vectorcall().
+    if (typeObj->tp_getattro == (getattrofunc) JObj_getattro) {
+        typeObj->tp_getattro = PyObject_GenericGetAttr;
+    }
+    if (typeObj->tp_setattro == (setattrofunc) JObj_setattro) {
+        typeObj->tp_setattro = PyObject_GenericSetAttr;
+    }
+    // The type's dictionary has been modified directly, so invalidate the interpreter's attribute caches.
+    PyType_Modified(typeObj);
+
+    // Set last, other threads use resolved types without acquiring the type lock.
+    JPy_STORE_FLAG(type->isResolved, JNI_TRUE);
     return 0;
 }
 
+/**
+ * Fill the type __dict__ with our Java class constructors and methods.
+ * Constructors will be available using the key named __jinit__.
+ * Methods will be available using their method name.
+ */
+int JType_ResolveType(JNIEnv* jenv, JPy_JType* type)
+{
+    int result;
+
+    if (JPy_LOAD_FLAG(type->isResolved)) {
+        return 0;
+    }
+
+    JType_LockTypes();
+    result = JType_ResolveTypeLocked(jenv, type);
+    JType_UnlockTypes();
+    return result;
+}
+
 jboolean JType_AcceptMethod(JPy_JType* declaringClass, JPy_JMethod* method)
 {
     PyObject* callable;
@@ -846,17 +1330,27 @@ jboolean JType_AcceptMethod(JPy_JType* declaringClass, JPy_JMethod* method)
 
     //printf("JType_AcceptMethod: javaName='%s'\n", overloadedMethod->declaringClass->javaName);
 
+#if defined(JPY_COMPAT_FREE_THREADING)
+    // Other threads may modify 'jpy.type_callbacks' meanwhile, so hold a strong reference to the callable.
+    if (PyDict_GetItemStringRef(JPy_Type_Callbacks, declaringClass->javaName, &callable) < 0) {
+        PyErr_Clear();
+    }
+#else
     callable = PyDict_GetItemString(JPy_Type_Callbacks, declaringClass->javaName);
+    Py_XINCREF(callable);
+#endif
     if (callable != NULL) {
         if (PyCallable_Check(callable)) {
             callableResult = PyObject_CallFunction(callable, "OO", declaringClass, method);
             if (callableResult == Py_None || callableResult == Py_False) {
+                Py_DECREF(callable);
                 return JNI_FALSE;
             } else if (callableResult == NULL) {
                 JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_AcceptMethod: warning: failed to invoke callback on method addition\n");
                 // Ignore this problem and continue
             }
         }
+        Py_DECREF(callable);
     }
 
     return JNI_TRUE;
@@ -1134,54 +1628,6 @@ int JType_AddClassAttribute(JNIEnv* jenv, JPy_JType* declaringClass)
     return 0;
 }
 
-int JType_AddFieldAttribute(JNIEnv* jenv, JPy_JType* declaringClass, PyObject* fieldName, JPy_JType* fieldType, jfieldID fid)
-{
-    PyObject* typeDict;
-    PyObject* fieldValue;
-
-    typeDict = declaringClass->typeObj.tp_dict;
-    if (typeDict == NULL) {
-        PyErr_SetString(PyExc_RuntimeError, "jpy internal error: missing attribute '__dict__' in JType");
-        return -1;
-    }
-
-    if (fieldType == JPy_JBoolean) {
-        jboolean item = (*jenv)->GetStaticBooleanField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FROM_JBOOLEAN(item);
-    } else if (fieldType == JPy_JChar) {
-        jchar item = (*jenv)->GetStaticCharField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FROM_JCHAR(item);
-    } else if (fieldType == JPy_JByte) {
-        jbyte item = (*jenv)->GetStaticByteField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FROM_JBYTE(item);
-    } else if (fieldType == JPy_JShort) {
-        jshort item = (*jenv)->GetStaticShortField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FROM_JSHORT(item);
-    } else if (fieldType == JPy_JInt) {
-        jint item = (*jenv)->GetStaticIntField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FROM_JINT(item);
-    } else if (fieldType == JPy_JLong) {
-        jlong item = (*jenv)->GetStaticLongField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FROM_JLONG(item);
-    } else if (fieldType == JPy_JFloat) {
-        jfloat item = (*jenv)->GetStaticFloatField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FROM_JFLOAT(item);
-    } else if (fieldType == JPy_JDouble) {
-        jdouble item = (*jenv)->GetStaticDoubleField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FROM_JDOUBLE(item);
-    } else if (fieldType == JPy_JString) {
-        jstring objectRef = (*jenv)->GetStaticObjectField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FromJString(jenv, objectRef);
-        (*jenv)->DeleteLocalRef(jenv, objectRef);
-    } else {
-        jobject objectRef = (*jenv)->GetStaticObjectField(jenv, declaringClass->classRef, fid);
-        fieldValue = JPy_FromJObjectWithType(jenv, objectRef, (JPy_JType*) fieldType);
-        (*jenv)->DeleteLocalRef(jenv, objectRef);
-    }
-    PyDict_SetItem(typeDict, fieldName, fieldValue);
-    return 0;
-}
-
 int JType_ProcessField(JNIEnv* jenv, JPy_JType* declaringClass, PyObject* fieldKey, const char* fieldName, jclass fieldClassRef, jboolean isStatic, jboolean isFinal, jfieldID fid)
 {
     JPy_JField* field;
@@ -1193,27 +1639,18 @@ int JType_ProcessField(JNIEnv* jenv, JPy_JType* declaringClass, PyObject* fieldK
         return -1;
     }
 
-    if (isStatic && isFinal) {
-        // Add static final values to the JPy_JType's tp_dict.
-        // todo: Note that this is a workaround only, because the JPy_JType's tp_getattro slot is not called.
-        if (JType_AddFieldAttribute(jenv, declaringClass, fieldKey, fieldType, fid) < 0) {
-            return -1;
-        }
-    } else if (!isStatic) {
-        // Add instance field accessor to the JPy_JType's tp_dict, this will be evaluated in the JPy_JType's tp_setattro and tp_getattro slots.
-        field = JField_New(declaringClass, fieldKey, fieldType, isStatic, isFinal, fid);
-        if (field == NULL) {
-            JPy_DIAG_PRINT(JPy_DIAG_F_TYPE + JPy_DIAG_F_ERR, "JType_ProcessField: WARNING: Java field '%s' rejected because an error occurred during field instantiation\n", fieldName);
-            return -1;
-        }
+    // Add the field accessor to the JPy_JType's tp_dict. JField objects are data descriptors (see JField_descr_get()
+    // and JField_descr_set()), so instance fields and also static fields are always accessed "live".
+    field = JField_New(declaringClass, fieldKey, fieldType, isStatic, isFinal, fid);
+    if (field == NULL) {
+        JPy_DIAG_PRINT(JPy_DIAG_F_TYPE + JPy_DIAG_F_ERR, "JType_ProcessField: WARNING: Java field '%s' rejected because an error occurred during field instantiation\n", fieldName);
+        return -1;
+    }
 
-        if (JType_AcceptField(declaringClass, field)) {
-            JType_AddField(declaringClass, field);
-        } else {
-            JField_Del(field);
-        }
+    if (JType_AcceptField(declaringClass, field)) {
+        JType_AddField(declaringClass, field);
     } else {
-        JPy_DIAG_PRINT(JPy_DIAG_F_TYPE + JPy_DIAG_F_ERR, "JType_ProcessField: WARNING: Java field '%s' rejected because is is static, but not final\n", fieldName);
+        JField_Del(field);
     }
 
     return 0;
@@ -1244,7 +1681,7 @@ int JType_AddMethod(JPy_JType* type, JPy_JMethod* method)
     if (methodValue == NULL) {
         overloadedMethod = JOverloadedMethod_New(type, method->name, method);
         return PyDict_SetItem(typeDict, method->name, (PyObject*) overloadedMethod);
-    } else if (PyObject_TypeCheck(methodValue, &JOverloadedMethod_Type)) {
+    } else if (PyObject_TypeCheck(methodValue, JPy_GetModuleState()->joverloadedMethodType)) {
         overloadedMethod = (JPy_JOverloadedMethod*) methodValue;
         return JOverloadedMethod_AddMethod(overloadedMethod, method);
     } else {
@@ -1253,6 +1690,36 @@ int JType_AddMethod(JPy_JType* type, JPy_JMethod* method)
     }
 }
 
+/**
+ * Builds the dispatch tables of the overloaded methods declared by the given type, so that calls don't have to
+ * look up inherited overloads in the super-classes. Constructors are not inherited and need no dispatch table.
+ */
+int JType_InitDispatchTables(JNIEnv* jenv, JPy_JType* type)
+{
+    PyObject* typeDict;
+    PyObject* key;
+    PyObject* value;
+    Py_ssize_t pos;
+
+    typeDict = type->typeObj.tp_dict;
+    if (typeDict == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "jpy internal error: missing attribute '__dict__' in JType");
+        return -1;
+    }
+
+    pos = 0;
+    while (PyDict_Next(typeDict, &pos, &key, &value)) {
+        if (PyObject_TypeCheck(value, JPy_GetModuleState()->joverloadedMethodType)
+            && ((JPy_JOverloadedMethod*) value)->declaringClass == type
+            && strcmp(JPy_AS_UTF8(key), JPy_JTYPE_ATTR_NAME_JINIT) != 0) {
+            if (JOverloadedMethod_InitDispatchTable(jenv, (JPy_JOverloadedMethod*) value) < 0) {
+                return -1;
+            }
+        }
+    }
+    return 0;
+}
+
 /**
  * Returns NULL (error), Py_None (borrowed ref), or a JPy_JOverloadedMethod* (borrowed ref)
  */
@@ -1285,7 +1752,7 @@ PyObject* JType_GetOverloadedMethod(JNIEnv* jenv, JPy_JType* type, PyObject* met
         }
     }
 
-    if (PyObject_TypeCheck(methodValue, &JOverloadedMethod_Type)) {
+    if (PyObject_TypeCheck(methodValue, JPy_GetModuleState()->joverloadedMethodType)) {
         return methodValue;
     } else {
         PyErr_SetString(PyExc_RuntimeError, "internal error: expected type 'JOverloadedMethod' in '__dict__' of a JType");
@@ -1311,6 +1778,7 @@ JPy_ReturnDescriptor* JType_CreateReturnDescriptor(JNIEnv* jenv, jclass returnCl
 
     returnDescriptor->type = type;
     returnDescriptor->paramIndex = -1;
+    returnDescriptor->policy = JPy_RETURN_POLICY_WRAPPER;
     Py_INCREF((PyObject*) type);
 
     JPy_DIAG_PRINT(JPy_DIAG_F_TYPE, "JType_ProcessReturnType: type->javaName=\"%s\", type=%p\n", type->javaName, type);
@@ -1645,6 +2113,20 @@ int JType_MatchPyArgAsJObject(JNIEnv* jenv, JPy_JType* paramType, PyObject* pyAr
         } else if (PyBool_Check(pyArg)) {
             return 10;
         }
+    } else if (paramType->isInterface && PyCallable_Check(pyArg) && JType_IsFunctionalInterface(jenv, paramType)) {
+        // Parameter type is a functional interface, pyArg will be wrapped by a org.jpy.PyCallableAdapter
+        return 50;
+    }
+
+    if (PyList_Check(pyArg) || PyTuple_Check(pyArg) || PyDict_Check(pyArg)) {
+        jclass viewClass;
+        jmethodID wrapMID;
+        viewClass = JType_GetJavaViewClass(jenv, pyArg, &wrapMID);
+        if (viewClass != NULL && (*jenv)->IsAssignableFrom(jenv, viewClass, paramType->classRef)) {
+            // Parameter type is e.g. java.util.List or java.util.Map, pyArg will be wrapped by a live view.
+            // Matches below a Java array parameter (10), so that overloads taking arrays keep being preferred.
+            return 9;
+        }
     }
 
     return 0;
@@ -1937,7 +2419,10 @@ void JType_dealloc(JPy_JType* self)
     Py_XDECREF(self->componentType);
     self->componentType = NULL;
 
-    Py_TYPE(self)->tp_free((PyObject*) self);
+    Py_XDECREF(self->identityCache);
+    self->identityCache = NULL;
+
+    JPy_FREE_INSTANCE(self)
 }
 
 /**
@@ -1947,7 +2432,7 @@ PyObject* JType_getattro(JPy_JType* self, PyObject* name)
 {
     //printf("JType_getattro: %s.%s\n", Py_TYPE(self)->tp_name, JPy_AS_UTF8(name));
 
-    if (!self->isResolved && !self->isResolving) {
+    if (!JPy_LOAD_FLAG(self->isResolved)) {
         JNIEnv* jenv;
         JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL);
         JType_ResolveType(jenv, self);
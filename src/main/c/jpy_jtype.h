@@ -44,15 +44,23 @@ typedef struct JPy_JType
     char isPrimitive;
     // If TRUE, 'classRef' refers to a Java interface type.
     char isInterface;
-    // If TRUE, the type is currently being resolved.
+    // If TRUE, the type is currently being resolved. Only accessed while holding the type lock.
     char isResolving;
-    // If TRUE, all the class constructors and methods have already been resolved.
+    // If TRUE, all the class constructors and methods have already been resolved. Read with JPy_LOAD_FLAG().
     char isResolved;
+    // If not NULL, maps System.identityHashCode() of Java objects to weak references to their wrappers of this type,
+    // see jpy.set_identity_cache() and JObj_FromType(). Read with JType_GetIdentityCache().
+    PyObject* identityCache;
+    // The size of identityCache above which dead weak references are purged. Accessed in a critical section of the cache.
+    Py_ssize_t identityCacheLimit;
+    // JType_FUNCTIONAL_YES if 'classRef' refers to a functional interface, JType_FUNCTIONAL_NO if not,
+    // 0 if not yet known. Read with JPy_LOAD_FLAG(), see JType_IsFunctionalInterface().
+    char functionalInterface;
 }
 JPy_JType;
 
 /**
- * The 'JType' singleton.
+ * The template of the 'JType' meta type. Use JPy_GetModuleState()->jtypeType, the copy of the current interpreter.
  */
 extern PyTypeObject JType_Type;
 
@@ -76,6 +84,15 @@ struct JPy_ParamDescriptor;
 typedef int (*JPy_MatchPyArg)(JNIEnv*, struct JPy_ParamDescriptor*, PyObject*);
 typedef int (*JPy_ConvertPyArg)(JNIEnv*, struct JPy_ParamDescriptor*, PyObject*, jvalue*, JPy_ArgDisposer*);
 
+/**
+ * Return policies of methods returning objects, see JMethod.set_return_policy().
+ */
+#define JPy_RETURN_POLICY_WRAPPER 0
+#define JPy_RETURN_POLICY_BYTES   1
+#define JPy_RETURN_POLICY_NUMPY   2
+#define JPy_RETURN_POLICY_LIST    3
+#define JPy_RETURN_POLICY_DICT    4
+
 /**
  * Method return value descriptor.
  */
@@ -90,6 +107,11 @@ typedef struct JPy_ReturnDescriptor
      * If JPy_ParamDescriptor.isReturnIndex == FALSE it will be -1.
      */
     jint paramIndex;
+    /**
+     * One of the JPy_RETURN_POLICY_* values. Any policy other than JPy_RETURN_POLICY_WRAPPER converts
+     * the returned object right after the call, without creating a Java object wrapper.
+     */
+    jint policy;
 }
 JPy_ReturnDescriptor;
 
@@ -117,17 +139,41 @@ JPy_JType* JType_GetType(JNIEnv* jenv, jclass classRef, jboolean resolve);
 PyObject* JType_ConvertJavaToPythonObject(JNIEnv* jenv, JPy_JType* type, jobject objectRef);
 int       JType_ConvertPythonToJavaObject(JNIEnv* jenv, JPy_JType* type, PyObject* arg, jobject* objectRef);
 
+/**
+ * A function converting a Python object into a (boxed) Java object of the given type.
+ * The converters returned by JType_GetPythonToJavaConverter() expect that None and Java object wrappers (JObj)
+ * have already been handled by the caller.
+ */
+typedef int (*JType_PythonToJavaConverter)(JNIEnv* jenv, JPy_JType* type, PyObject* arg, jobject* objectRef);
+
+JType_PythonToJavaConverter JType_GetPythonToJavaConverter(JPy_JType* type);
+int JType_PythonToJavaConversionError(JPy_JType* type, PyObject* pyArg);
+
 PyObject* JType_GetOverloadedMethod(JNIEnv* jenv, JPy_JType* type, PyObject* methodName, jboolean useSuperClass);
 
 int JType_MatchPyArgAsJObject(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg);
 
+#define JType_FUNCTIONAL_YES 1
+#define JType_FUNCTIONAL_NO  2
+
+int JType_IsFunctionalInterface(JNIEnv* jenv, JPy_JType* type);
+int JType_CreateJavaCallableAdapter(JNIEnv* jenv, JPy_JType* type, PyObject* pyArg, jobject* objectRef);
+
 int JType_CreateJavaArray(JNIEnv* jenv, JPy_JType* componentType, PyObject* pyArg, jobject* objectRef);
 
 // Non-API. Defined in jpy_jobj.c
-int JType_InitSlots(JPy_JType* type);
+int JType_InitSlots(JNIEnv* jenv, JPy_JType* type);
 // Non-API. Defined in jpy_jtype.c
 int JType_ResolveType(JNIEnv* jenv, JPy_JType* type);
 
+// Non-API. Defined in jpy_jtype.c. Types are created and resolved while holding the (recursive) type lock
+// of the current interpreter. The GIL alone doesn't suffice, since type callbacks and preloading may release it.
+void JType_LockTypes(void);
+void JType_UnlockTypes(void);
+int JType_PreloadTypes(JNIEnv* jenv, PyObject* names);
+int JType_SetIdentityCache(JPy_JType* type, jboolean enabled);
+PyObject* JType_GetIdentityCache(JPy_JType* type);
+
 int JType_AddClassAttribute(JNIEnv* jenv, JPy_JType* type);
 
 #ifdef __cplusplus
@@ -20,6 +20,9 @@
 #include "jpy_jmethod.h"
 #include "jpy_jfield.h"
 #include "jpy_jobj.h"
+#include "jpy_jarray.h"
+#include "jpy_jfuture.h"
+#include "jpy_jcoll.h"
 #include "jpy_conv.h"
 #include "jpy_compat.h"
 
@@ -32,8 +35,20 @@ PyObject* JPy_has_jvm(PyObject* self);
 PyObject* JPy_create_jvm(PyObject* self, PyObject* args, PyObject* kwds);
 PyObject* JPy_destroy_jvm(PyObject* self, PyObject* args);
 PyObject* JPy_get_type(PyObject* self, PyObject* args, PyObject* kwds);
+PyObject* JPy_preload(PyObject* self, PyObject* args, PyObject* kwds);
+PyObject* JPy_set_identity_cache(PyObject* self, PyObject* args);
 PyObject* JPy_cast(PyObject* self, PyObject* args);
 PyObject* JPy_array(PyObject* self, PyObject* args);
+PyObject* JPy_to_numpy(PyObject* self, PyObject* args, PyObject* kwds);
+PyObject* JPy_from_numpy(PyObject* self, PyObject* args);
+PyObject* JPy_set_nd_buffers(PyObject* self, PyObject* args);
+PyObject* JPy_get_fields(PyObject* self, PyObject* args, PyObject* kwds);
+PyObject* JPy_get_method(PyObject* self, PyObject* args);
+PyObject* JPy_map(PyObject* self, PyObject* args, PyObject* kwds);
+PyObject* JPy_vectorize(PyObject* self, PyObject* args);
+PyObject* JPy_to_java_future(PyObject* self, PyObject* args, PyObject* kwds);
+PyObject* JPy_to_java_list(PyObject* self, PyObject* args, PyObject* kwds);
+PyObject* JPy_to_java_map(PyObject* self, PyObject* args, PyObject* kwds);
 
 
 static PyMethodDef JPy_Functions[] = {
@@ -51,6 +66,17 @@ static PyMethodDef JPy_Functions[] = {
                     "get_type(name, resolve=True) - Return the Java class with the given name, e.g. 'java.io.File'. "
                     "Loads the Java class from the JVM if not already done. Optionally avoids resolving the class' methods."},
 
+    {"preload",     (PyCFunction) JPy_preload, METH_VARARGS|METH_KEYWORDS,
+                    "preload(names, background=False) - Load and resolve the Java classes with the given names, e.g. 'java.util.HashMap', "
+                    "and of the packages given as 'com.acme.*' (or 'com.acme.**' including sub-packages), so that their first use is fast. "
+                    "The classes are loaded in parallel by Java threads. Returns the number of preloaded types, or if background is True, "
+                    "the started daemon threading.Thread which preloads them."},
+
+    {"set_identity_cache", JPy_set_identity_cache, METH_VARARGS,
+                    "set_identity_cache(type, enabled) - Enable or disable the identity cache of the given Java type (type name or type object). "
+                    "If enabled, a Java object returned as this type is wrapped by the same Python object as long as that is alive, "
+                    "so that 'is' compares Java object identity. Returns the previous setting."},
+
     {"cast",        JPy_cast, METH_VARARGS,
                     "cast(obj, type) - Cast the given Java object to the given Java type (type name or type object). "
                     "Returns None if the cast is not possible."},
@@ -59,15 +85,89 @@ static PyMethodDef JPy_Functions[] = {
                     "array(name, init) - Return a new Java array of given Java type (type name or type object) and initializer (array length or sequence). "
                     "Possible primitive types are 'boolean', 'byte', 'char', 'short', 'int', 'long', 'float', and 'double'."},
 
+    {"to_numpy",    (PyCFunction) JPy_to_numpy, METH_VARARGS|METH_KEYWORDS,
+                    "to_numpy(jarr, copy=True) - Return a new numpy.ndarray for the given Java primitive array or rectangular array of primitive arrays. "
+                    "If copy is False, a one-dimensional, read-only ndarray uses the Java array's buffer export instead of a copy."},
+
+    {"from_numpy",  JPy_from_numpy, METH_VARARGS,
+                    "from_numpy(arr, type) - Return a new Java array of the given primitive type (type name or type object) "
+                    "from a 1- or 2-dimensional C-contiguous numpy.ndarray or other buffer object."},
+
+    {"set_nd_buffers", JPy_set_nd_buffers, METH_VARARGS,
+                    "set_nd_buffers(enabled) - Enable or disable the multi-dimensional buffer export of rectangular nested Java primitive arrays, "
+                    "e.g. 'double[][]'. Returns the previous setting."},
+
+    {"get_fields",  (PyCFunction) JPy_get_fields, METH_VARARGS|METH_KEYWORDS,
+                    "get_fields(objs, names, as_numpy=False) - Read the given instance fields from all objects of a Java object array or a sequence of Java objects. "
+                    "Returns a list of columns, one per field name. If as_numpy is True, columns of primitive fields are numpy.ndarrays, otherwise lists."},
+
+    {"get_method",  JPy_get_method, METH_VARARGS,
+                    "get_method(target, name, signature) - Return the method overload of the given Java type (type name or type object) or Java object "
+                    "with the given name and JNI signature, e.g. '(ILjava/lang/String;)V'. The return type may be omitted, e.g. '(ILjava/lang/String;)'. "
+                    "Calling the returned JMethod bypasses overload resolution. If target is a Java object, the method is bound to it."},
+
+    {"map",         (PyCFunction) JPy_map, METH_VARARGS|METH_KEYWORDS,
+                    "map(method, args, as_numpy=False, release_gil=False) - Call the Java method for every argument tuple (or single argument) in args "
+                    "and return the list of results. Overloads are resolved once, for the first argument tuple. If as_numpy is True, primitive results are "
+                    "returned as numpy.ndarray. If release_gil is True and the method has only primitive parameters and return type, the GIL is released "
+                    "during the calls."},
+
+    {"vectorize",   JPy_vectorize, METH_VARARGS,
+                    "vectorize(method) - Return a callable which calls the given static Java method with primitive parameters and return type "
+                    "elementwise over 1-D arrays (buffer objects) and scalars, which are broadcast. The results are returned as numpy.ndarray "
+                    "or written into the buffer given by the keyword argument out. The GIL is released during the calls."},
+
+    {"to_java_future", (PyCFunction) JPy_to_java_future, METH_VARARGS|METH_KEYWORDS,
+                    "to_java_future(obj, loop=None) - Return a new Java CompletableFuture which is completed with the outcome of the given "
+                    "coroutine, asyncio future or concurrent.futures.Future. Coroutines are scheduled on the current event loop or, if given, "
+                    "submitted to loop from another thread. Cancelling the Java future cancels the Python future."},
+
+    {"to_java_list", (PyCFunction) JPy_to_java_list, METH_VARARGS|METH_KEYWORDS,
+                    "to_java_list(seq, item_type='java.lang.Object') - Return a new Java ArrayList holding the items of the given sequence or iterable "
+                    "converted into the given Java type (type name or type object) in a single call. Primitive types are boxed."},
+
+    {"to_java_map", (PyCFunction) JPy_to_java_map, METH_VARARGS|METH_KEYWORDS,
+                    "to_java_map(mapping, key_type='java.lang.Object', value_type='java.lang.Object') - Return a new Java HashMap holding the entries "
+                    "of the given dict or other mapping converted into the given Java key and value types (type names or type objects) in a single call. "
+                    "Primitive types are boxed."},
+
     {NULL, NULL, 0, NULL} /*Sentinel*/
 };
 
-void JPy_free(void* unused);
+void JPy_free(void* module);
 
 #define JPY_MODULE_NAME "jpy"
 #define JPY_MODULE_DOC  "Bi-directional Python-Java Bridge"
 
-#if defined(JPY_COMPAT_33P)
+#if defined(JPY_COMPAT_MODULE_STATE)
+int JPy_exec(PyObject* module);
+
+static PyModuleDef_Slot JPy_ModuleSlots[] =
+{
+    {Py_mod_exec, (void*) JPy_exec},
+#if defined(JPY_COMPAT_OWN_GIL)
+    {Py_mod_multiple_interpreters, Py_MOD_PER_INTERPRETER_GIL_SUPPORTED},
+#endif
+#if defined(Py_mod_gil)
+    // jpy doesn't rely on the GIL, so importing it doesn't re-enable the GIL in free-threaded builds
+    {Py_mod_gil, Py_MOD_GIL_NOT_USED},
+#endif
+    {0, NULL}
+};
+
+static struct PyModuleDef JPy_ModuleDef =
+{
+    PyModuleDef_HEAD_INIT,
+    JPY_MODULE_NAME,   /* Name of the Python JPy_Module */
+    JPY_MODULE_DOC,    /* Module documentation */
+    sizeof (JPy_ModuleState), /* Size of per-interpreter state of the JPy_Module */
+    JPy_Functions,     /* Structure containing global jpy-functions */
+    JPy_ModuleSlots,   // m_slots
+    NULL,     // m_traverse
+    NULL,     // m_clear
+    JPy_free  // m_free
+};
+#elif defined(JPY_COMPAT_33P)
 static struct PyModuleDef JPy_ModuleDef =
 {
     PyModuleDef_HEAD_INIT,
@@ -82,44 +182,144 @@ static struct PyModuleDef JPy_ModuleDef =
 };
 #endif
 
-PyObject* JPy_Module = NULL;
-PyObject* JPy_Types = NULL;
-PyObject* JPy_Type_Callbacks = NULL;
-PyObject* JException_Type = NULL;
-
 // A global reference to a Java VM singleton.
 JavaVM* JPy_JVM = NULL;
 
 // If true, this JVM structure has been initialised from Python jpy.create_jvm()
 jboolean JPy_MustDestroyJVM = JNI_FALSE;
 
+// If true, nested Java primitive arrays export a multi-dimensional buffer (see JArray_GetNDBufferProc())
+jboolean JPy_NDBufferExport = JNI_FALSE;
 
-// Global VM Information (maybe better place this in the JPy_JVM structure later)
-// {{{
 
-JPy_JType* JPy_JBoolean = NULL;
-JPy_JType* JPy_JChar = NULL;
-JPy_JType* JPy_JByte = NULL;
-JPy_JType* JPy_JShort = NULL;
-JPy_JType* JPy_JInt = NULL;
-JPy_JType* JPy_JLong = NULL;
-JPy_JType* JPy_JFloat = NULL;
-JPy_JType* JPy_JDouble = NULL;
-JPy_JType* JPy_JVoid = NULL;
-JPy_JType* JPy_JBooleanObj = NULL;
-JPy_JType* JPy_JCharacterObj = NULL;
-JPy_JType* JPy_JByteObj = NULL;
-JPy_JType* JPy_JShortObj = NULL;
-JPy_JType* JPy_JIntegerObj = NULL;
-JPy_JType* JPy_JLongObj = NULL;
-JPy_JType* JPy_JFloatObj = NULL;
-JPy_JType* JPy_JDoubleObj = NULL;
-JPy_JType* JPy_JObject = NULL;
-JPy_JType* JPy_JClass = NULL;
-JPy_JType* JPy_JString = NULL;
-JPy_JType* JPy_JPyObject = NULL;
-JPy_JType* JPy_JPyModule = NULL;
+#if defined(JPY_COMPAT_MODULE_STATE)
 
+// Key of the capsule in the interpreter's dictionary (see PyInterpreterState_GetDict()) which points to the module state
+#define JPY_MODULE_STATE_KEY "jpy.moduleState"
+
+// Returned if 'jpy' has not been imported into the current interpreter, all members are always NULL
+static JPy_ModuleState JPy_NullModuleState;
+// The module state of the main interpreter
+static JPy_ModuleState* JPy_MainModuleState = &JPy_NullModuleState;
+// Incremented if a module state is registered or freed, invalidates the per-thread caches below.
+// Interpreters with their own GIL access it concurrently, hence only atomically.
+static volatile long JPy_ModuleStateGeneration = 0;
+
+// Per-thread cache of the interpreter last used by a thread and its module state
+static JPY_THREAD_LOCAL PyInterpreterState* JPy_CachedInterp = NULL;
+static JPY_THREAD_LOCAL JPy_ModuleState* JPy_CachedModuleState = NULL;
+static JPY_THREAD_LOCAL long JPy_CachedGeneration = 0;
+
+static JPy_ModuleState* JPy_FindModuleState(PyInterpreterState* interp)
+{
+    PyObject* interpDict;
+    PyObject* capsule;
+
+    interpDict = PyInterpreterState_GetDict(interp);
+    capsule = interpDict != NULL ? PyDict_GetItemString(interpDict, JPY_MODULE_STATE_KEY) : NULL;
+    if (capsule == NULL) {
+        return NULL;
+    }
+    return (JPy_ModuleState*) PyCapsule_GetPointer(capsule, JPY_MODULE_STATE_KEY);
+}
+
+JPy_ModuleState* JPy_GetModuleState(void)
+{
+    PyThreadState* tstate;
+    JPy_ModuleState* state;
+    long generation;
+
+    generation = JPy_ATOMIC_LOAD_LONG(JPy_ModuleStateGeneration);
+
+    tstate = JPy_GET_THREAD_STATE_UNCHECKED();
+    if (tstate == NULL) {
+        // No current Python thread state, e.g. a Java thread or the GIL has been released by this thread.
+        if (JPy_CachedModuleState != NULL && JPy_CachedGeneration == generation) {
+            return JPy_CachedModuleState;
+        }
+        return JPy_MainModuleState;
+    }
+
+    if (tstate->interp == JPy_CachedInterp && JPy_CachedGeneration == generation) {
+        return JPy_CachedModuleState;
+    }
+
+    state = JPy_FindModuleState(tstate->interp);
+    if (state == NULL) {
+        // Module not imported into this interpreter (yet), so don't cache
+        return &JPy_NullModuleState;
+    }
+
+    JPy_CachedInterp = tstate->interp;
+    JPy_CachedModuleState = state;
+    JPy_CachedGeneration = generation;
+    return state;
+}
+
+static int JPy_RegisterModuleState(JPy_ModuleState* state)
+{
+    PyInterpreterState* interp;
+    PyObject* interpDict;
+    PyObject* capsule;
+    int result;
+
+    interp = PyThreadState_Get()->interp;
+    interpDict = PyInterpreterState_GetDict(interp);
+    if (interpDict == NULL) {
+        PyErr_SetString(PyExc_RuntimeError, "jpy: failed to access the interpreter's dictionary");
+        return -1;
+    }
+
+    capsule = PyCapsule_New(state, JPY_MODULE_STATE_KEY, NULL);
+    if (capsule == NULL) {
+        return -1;
+    }
+    result = PyDict_SetItemString(interpDict, JPY_MODULE_STATE_KEY, capsule);
+    Py_DECREF(capsule);
+    if (result < 0) {
+        return -1;
+    }
+
+    if (interp == PyInterpreterState_Main()) {
+        JPy_MainModuleState = state;
+    }
+    JPy_ATOMIC_INCREMENT_LONG(JPy_ModuleStateGeneration);
+    return 0;
+}
+
+static void JPy_UnregisterModuleState(JPy_ModuleState* state)
+{
+    PyInterpreterState* interp;
+    PyObject* interpDict;
+
+    interp = PyThreadState_Get()->interp;
+    interpDict = PyInterpreterState_GetDict(interp);
+    // The module may have been imported again, so make sure we remove our own state only
+    if (interpDict != NULL && JPy_FindModuleState(interp) == state) {
+        PyDict_DelItemString(interpDict, JPY_MODULE_STATE_KEY);
+    }
+    PyErr_Clear();
+
+    if (JPy_MainModuleState == state) {
+        JPy_MainModuleState = &JPy_NullModuleState;
+    }
+    JPy_ATOMIC_INCREMENT_LONG(JPy_ModuleStateGeneration);
+}
+
+#else
+
+static JPy_ModuleState JPy_GlobalModuleState;
+
+JPy_ModuleState* JPy_GetModuleState(void)
+{
+    return &JPy_GlobalModuleState;
+}
+
+#endif
+
+
+// Global VM Information (maybe better place this in the JPy_JVM structure later)
+// {{{
 
 // java.lang.Comparable
 jclass JPy_Comparable_JClass = NULL;
@@ -161,34 +361,76 @@ jmethodID JPy_Field_GetName_MID = NULL;
 jmethodID JPy_Field_GetModifiers_MID = NULL;
 jmethodID JPy_Field_GetType_MID = NULL;
 
+// java.lang.System
+jclass JPy_System_JClass = NULL;
+jmethodID JPy_System_IdentityHashCode_MID = NULL;
+
 jclass JPy_RuntimeException_JClass = NULL;
+jclass JPy_CompletionStage_JClass = NULL;
+
+// java.util.Collection, java.util.List, java.util.Map, java.util.Map.Entry
+jclass JPy_Collection_JClass = NULL;
+jmethodID JPy_Collection_Size_MID = NULL;
+jmethodID JPy_Collection_Contains_MID = NULL;
+jmethodID JPy_Collection_ToArray_MID = NULL;
+jclass JPy_List_JClass = NULL;
+jmethodID JPy_List_Get_MID = NULL;
+jmethodID JPy_List_Set_MID = NULL;
+jmethodID JPy_List_Add_MID = NULL;
+jmethodID JPy_List_Remove_MID = NULL;
+jclass JPy_Map_JClass = NULL;
+jmethodID JPy_Map_Size_MID = NULL;
+jmethodID JPy_Map_Get_MID = NULL;
+jmethodID JPy_Map_Put_MID = NULL;
+jmethodID JPy_Map_Remove_MID = NULL;
+jmethodID JPy_Map_ContainsKey_MID = NULL;
+jmethodID JPy_Map_KeySet_MID = NULL;
+jmethodID JPy_Map_EntrySet_MID = NULL;
+jclass JPy_MapEntry_JClass = NULL;
+jmethodID JPy_MapEntry_GetKey_MID = NULL;
+jmethodID JPy_MapEntry_GetValue_MID = NULL;
+// java.util.ArrayList, java.util.Arrays, java.util.HashMap
+jclass JPy_ArrayList_JClass = NULL;
+jmethodID JPy_ArrayList_Init_MID = NULL;
+jclass JPy_Arrays_JClass = NULL;
+jmethodID JPy_Arrays_AsList_MID = NULL;
+jclass JPy_HashMap_JClass = NULL;
+jmethodID JPy_HashMap_Init_MID = NULL;
 
 // java.lang.Boolean
 jclass JPy_Boolean_JClass = NULL;
-jmethodID JPy_Boolean_Init_MID = NULL;
+jmethodID JPy_Boolean_ValueOf_MID = NULL;
+jfieldID JPy_Boolean_Value_FID = NULL;
 jmethodID JPy_Boolean_BooleanValue_MID = NULL;
 
 jclass JPy_Character_JClass = NULL;
-jmethodID JPy_Character_Init_MID;
+jmethodID JPy_Character_ValueOf_MID = NULL;
+jfieldID JPy_Character_Value_FID = NULL;
 jmethodID JPy_Character_CharValue_MID = NULL;
 
 jclass JPy_Byte_JClass = NULL;
-jmethodID JPy_Byte_Init_MID = NULL;
+jmethodID JPy_Byte_ValueOf_MID = NULL;
+jfieldID JPy_Byte_Value_FID = NULL;
 
 jclass JPy_Short_JClass = NULL;
-jmethodID JPy_Short_Init_MID = NULL;
+jmethodID JPy_Short_ValueOf_MID = NULL;
+jfieldID JPy_Short_Value_FID = NULL;
 
 jclass JPy_Integer_JClass = NULL;
-jmethodID JPy_Integer_Init_MID = NULL;
+jmethodID JPy_Integer_ValueOf_MID = NULL;
+jfieldID JPy_Integer_Value_FID = NULL;
 
 jclass JPy_Long_JClass = NULL;
-jmethodID JPy_Long_Init_MID = NULL;
+jmethodID JPy_Long_ValueOf_MID = NULL;
+jfieldID JPy_Long_Value_FID = NULL;
 
 jclass JPy_Float_JClass = NULL;
-jmethodID JPy_Float_Init_MID = NULL;
+jmethodID JPy_Float_ValueOf_MID = NULL;
+jfieldID JPy_Float_Value_FID = NULL;
 
 jclass JPy_Double_JClass = NULL;
-jmethodID JPy_Double_Init_MID = NULL;
+jmethodID JPy_Double_ValueOf_MID = NULL;
+jfieldID JPy_Double_Value_FID = NULL;
 
 // java.lang.Number
 jclass JPy_Number_JClass = NULL;
@@ -249,89 +491,204 @@ JNIEnv* JPy_GetJNIEnv(void)
 #error JPY_VERSION_ERROR
 #endif
 
+#if defined(JPY_COMPAT_MODULE_STATE)
+
+#define JPY_MAX_TYPE_SLOTS   20
+#define JPY_MAX_TYPE_MEMBERS 16
+
+#define JPY_ADD_TYPE_SLOT(ID, FUNC) \
+    if ((FUNC) != NULL) { \
+        slots[slotCount].slot = (ID); \
+        slots[slotCount].pfunc = (void*) (FUNC); \
+        slotCount++; \
+    }
+
 /**
- * Called by the Python interpreter's import machinery, e.g. using 'import jpy'.
+ * Creates a new heap type of the given module from the given static type definition.
+ *
+ * Type objects must not be shared between interpreters which have their own GIL, because their reference counts,
+ * dictionaries and subclass lists are modified by every interpreter. Therefore, every interpreter creates its own
+ * heap types from the static types defined by jpy (e.g. JType_Type), which serve as templates only and are never
+ * readied. Instances of these types own a reference to their type (see JPy_FREE_INSTANCE()).
  */
-PyMODINIT_FUNC JPY_MODULE_INIT_FUNC(void)
+static PyTypeObject* JPy_NewTypeObject(JPy_ModuleState* state, const PyTypeObject* templateType)
 {
-    //printf("PyInit_jpy: JPy_JVM=%p\n", JPy_JVM);
-
-    /////////////////////////////////////////////////////////////////////////
+    PyType_Slot slots[JPY_MAX_TYPE_SLOTS];
+    PyMemberDef members[JPY_MAX_TYPE_MEMBERS];
+    PyType_Spec spec;
+    PyMemberDef* member;
+    PyTypeObject* type;
+    int slotCount;
+    int memberCount;
+
+    slotCount = 0;
+    JPY_ADD_TYPE_SLOT(Py_tp_dealloc, templateType->tp_dealloc)
+    JPY_ADD_TYPE_SLOT(Py_tp_repr, templateType->tp_repr)
+    JPY_ADD_TYPE_SLOT(Py_tp_hash, templateType->tp_hash)
+    JPY_ADD_TYPE_SLOT(Py_tp_call, templateType->tp_call)
+    JPY_ADD_TYPE_SLOT(Py_tp_str, templateType->tp_str)
+    JPY_ADD_TYPE_SLOT(Py_tp_getattro, templateType->tp_getattro)
+    JPY_ADD_TYPE_SLOT(Py_tp_setattro, templateType->tp_setattro)
+    JPY_ADD_TYPE_SLOT(Py_tp_doc, templateType->tp_doc)
+    JPY_ADD_TYPE_SLOT(Py_tp_richcompare, templateType->tp_richcompare)
+    JPY_ADD_TYPE_SLOT(Py_tp_iter, templateType->tp_iter)
+    JPY_ADD_TYPE_SLOT(Py_tp_iternext, templateType->tp_iternext)
+    JPY_ADD_TYPE_SLOT(Py_tp_methods, templateType->tp_methods)
+    JPY_ADD_TYPE_SLOT(Py_tp_getset, templateType->tp_getset)
+    JPY_ADD_TYPE_SLOT(Py_tp_descr_get, templateType->tp_descr_get)
+    JPY_ADD_TYPE_SLOT(Py_tp_descr_set, templateType->tp_descr_set)
+    JPY_ADD_TYPE_SLOT(Py_tp_init, templateType->tp_init)
+    JPY_ADD_TYPE_SLOT(Py_tp_new, templateType->tp_new)
+
+    // The members are copied into the heap type. The vectorcall offset of a heap type is given as a special member.
+    memberCount = 0;
+    for (member = templateType->tp_members; member != NULL && member->name != NULL; member++) {
+        members[memberCount++] = *member;
+    }
+#if defined(JPY_COMPAT_VECTORCALL)
+    if (templateType->tp_vectorcall_offset != 0) {
+        members[memberCount].name = "__vectorcalloffset__";
+        members[memberCount].type = T_PYSSIZET;
+        members[memberCount].offset = templateType->tp_vectorcall_offset;
+        members[memberCount].flags = READONLY;
+        members[memberCount].doc = NULL;
+        memberCount++;
+    }
+#endif
+    members[memberCount].name = NULL;
+    if (memberCount > 0) {
+        slots[slotCount].slot = Py_tp_members;
+        slots[slotCount].pfunc = members;
+        slotCount++;
+    }
+    slots[slotCount].slot = 0;
+    slots[slotCount].pfunc = NULL;
+
+    spec.name = templateType->tp_name;
+    spec.basicsize = (int) templateType->tp_basicsize;
+    spec.itemsize = (int) templateType->tp_itemsize;
+    spec.flags = (unsigned int) templateType->tp_flags;
+#if defined(Py_TPFLAGS_IMMUTABLETYPE)
+    spec.flags |= Py_TPFLAGS_IMMUTABLETYPE;
+#endif
+#if defined(Py_TPFLAGS_DISALLOW_INSTANTIATION)
+    if (templateType->tp_new == NULL) {
+        spec.flags |= Py_TPFLAGS_DISALLOW_INSTANTIATION;
+    }
+#endif
+    spec.slots = slots;
 
-#if defined(JPY_COMPAT_33P)
-    JPy_Module = PyModule_Create(&JPy_ModuleDef);
-    if (JPy_Module == NULL) {
-        JPY_RETURN(NULL);
+    type = (PyTypeObject*) PyType_FromModuleAndSpec(state->module, &spec, NULL);
+    if (type == NULL) {
+        return NULL;
     }
-#elif defined(JPY_COMPAT_27)
-    JPy_Module = Py_InitModule3(JPY_MODULE_NAME, JPy_Functions, JPY_MODULE_DOC);
-    if (JPy_Module == NULL) {
-        JPY_RETURN(NULL);
+#if !defined(Py_TPFLAGS_DISALLOW_INSTANTIATION)
+    // Heap types inherit tp_new from 'object', but jpy's types cannot be instantiated from Python
+    if (templateType->tp_new == NULL) {
+        type->tp_new = NULL;
     }
+#endif
+    return type;
+}
+
 #else
-    #error JPY_VERSION_ERROR
+
+/**
+ * Readies the given static type object, used by the only interpreter which imports jpy.
+ */
+static PyTypeObject* JPy_NewTypeObject(JPy_ModuleState* state, PyTypeObject* staticType)
+{
+    if (PyType_Ready(staticType) < 0) {
+        return NULL;
+    }
+    return staticType;
+}
+
+#endif
+
+static int JPy_AddTypeObject(JPy_ModuleState* state, const char* name, PyTypeObject* type)
+{
+    if (type == NULL) {
+        return -1;
+    }
+    Py_INCREF(type);
+    PyModule_AddObject(state->module, name, (PyObject*) type);
+    return 0;
+}
+
+/**
+ * Initialises the given module state of the current interpreter.
+ */
+static int JPy_InitModule(JPy_ModuleState* state)
+{
+    /////////////////////////////////////////////////////////////////////////
+
+#if !defined(JPY_COMPAT_FREE_THREADING)
+    // The PyMutex of free-threaded builds is zero-initialised with the state
+    state->typeLock = PyThread_allocate_lock();
+    if (state->typeLock == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
 #endif
 
     /////////////////////////////////////////////////////////////////////////
 
-    if (PyType_Ready(&JType_Type) < 0) {
-        JPY_RETURN(NULL);
+    state->jtypeType = JPy_NewTypeObject(state, &JType_Type);
+    if (JPy_AddTypeObject(state, "JType", state->jtypeType) < 0) {
+        return -1;
     }
-    Py_INCREF(&JType_Type);
-    PyModule_AddObject(JPy_Module, "JType", (PyObject*) &JType_Type);
 
     /////////////////////////////////////////////////////////////////////////
 
-    if (PyType_Ready(&JMethod_Type) < 0) {
-        JPY_RETURN(NULL);
+    state->jmethodType = JPy_NewTypeObject(state, &JMethod_Type);
+    if (JPy_AddTypeObject(state, "JMethod", state->jmethodType) < 0) {
+        return -1;
     }
-    Py_INCREF(&JMethod_Type);
-    PyModule_AddObject(JPy_Module, "JMethod", (PyObject*) &JMethod_Type);
 
     /////////////////////////////////////////////////////////////////////////
 
-    if (PyType_Ready(&JOverloadedMethod_Type) < 0) {
-        JPY_RETURN(NULL);
+    state->joverloadedMethodType = JPy_NewTypeObject(state, &JOverloadedMethod_Type);
+    if (JPy_AddTypeObject(state, "JOverloadedMethod", state->joverloadedMethodType) < 0) {
+        return -1;
     }
-    Py_INCREF(&JOverloadedMethod_Type);
-    PyModule_AddObject(JPy_Module, "JOverloadedMethod", (PyObject*) &JOverloadedMethod_Type);
 
     /////////////////////////////////////////////////////////////////////////
 
-    if (PyType_Ready(&JField_Type) < 0) {
-        JPY_RETURN(NULL);
+    state->jfieldType = JPy_NewTypeObject(state, &JField_Type);
+    if (JPy_AddTypeObject(state, "JField", state->jfieldType) < 0) {
+        return -1;
     }
-    Py_INCREF(&JField_Type);
-    PyModule_AddObject(JPy_Module, "JField", (PyObject*) &JField_Type);
 
     /////////////////////////////////////////////////////////////////////////
 
-    JException_Type = PyErr_NewException("jpy.JException", NULL, NULL);
-    Py_INCREF(JException_Type);
-    PyModule_AddObject(JPy_Module, "JException", JException_Type);
+    state->exceptionType = PyErr_NewException("jpy.JException", NULL, NULL);
+    Py_INCREF(state->exceptionType);
+    PyModule_AddObject(state->module, "JException", state->exceptionType);
 
     /////////////////////////////////////////////////////////////////////////
 
-    JPy_Types = PyDict_New();
-    Py_INCREF(JPy_Types);
-    PyModule_AddObject(JPy_Module, JPy_MODULE_ATTR_NAME_TYPES, JPy_Types);
+    state->types = PyDict_New();
+    Py_INCREF(state->types);
+    PyModule_AddObject(state->module, JPy_MODULE_ATTR_NAME_TYPES, state->types);
 
     /////////////////////////////////////////////////////////////////////////
 
-    JPy_Type_Callbacks = PyDict_New();
-    Py_INCREF(JPy_Type_Callbacks);
-    PyModule_AddObject(JPy_Module, JPy_MODULE_ATTR_NAME_TYPE_CALLBACKS, JPy_Type_Callbacks);
+    state->typeCallbacks = PyDict_New();
+    Py_INCREF(state->typeCallbacks);
+    PyModule_AddObject(state->module, JPy_MODULE_ATTR_NAME_TYPE_CALLBACKS, state->typeCallbacks);
 
     /////////////////////////////////////////////////////////////////////////
 
-    if (PyType_Ready(&Diag_Type) < 0) {
-        JPY_RETURN(NULL);
+    state->diagType = JPy_NewTypeObject(state, &Diag_Type);
+    if (state->diagType == NULL) {
+        return -1;
     }
     //Py_INCREF(&DiagFlags_Type);
     {
         PyObject* pyDiag = Diag_New();
         Py_INCREF(pyDiag);
-        PyModule_AddObject(JPy_Module, "diag", pyDiag);
+        PyModule_AddObject(state->module, "diag", pyDiag);
     }
 
     /////////////////////////////////////////////////////////////////////////
@@ -340,21 +697,94 @@ PyMODINIT_FUNC JPY_MODULE_INIT_FUNC(void)
         JNIEnv* jenv;
         jenv = JPy_GetJNIEnv();
         if (jenv == NULL) {
-            JPY_RETURN(NULL);
+            return -1;
         }
         // If we have already a running VM, initialize global variables
         if (JPy_InitGlobalVars(jenv) < 0) {
-            JPY_RETURN(NULL);
+            return -1;
         }
     }
 
+    return 0;
+}
+
+#if defined(JPY_COMPAT_33P)
+#define JPY_RETURN(V) return V
+#define JPY_MODULE_INIT_FUNC PyInit_jpy
+#elif defined(JPY_COMPAT_27)
+#define JPY_RETURN(V) return
+#define JPY_MODULE_INIT_FUNC initjpy
+#else
+#error JPY_VERSION_ERROR
+#endif
+
+/**
+ * Called by the Python interpreter's import machinery, e.g. using 'import jpy'.
+ */
+PyMODINIT_FUNC JPY_MODULE_INIT_FUNC(void)
+{
+    //printf("PyInit_jpy: JPy_JVM=%p\n", JPy_JVM);
+
+#if defined(JPY_COMPAT_MODULE_STATE)
+
+    // Multi-phase initialisation, see JPy_exec()
+    return PyModuleDef_Init(&JPy_ModuleDef);
+
+#else
+
+    JPy_ModuleState* state = JPy_GetModuleState();
+
     /////////////////////////////////////////////////////////////////////////
 
+#if defined(JPY_COMPAT_33P)
+    state->module = PyModule_Create(&JPy_ModuleDef);
+    if (state->module == NULL) {
+        JPY_RETURN(NULL);
+    }
+#elif defined(JPY_COMPAT_27)
+    state->module = Py_InitModule3(JPY_MODULE_NAME, JPy_Functions, JPY_MODULE_DOC);
+    if (state->module == NULL) {
+        JPY_RETURN(NULL);
+    }
+#else
+    #error JPY_VERSION_ERROR
+#endif
+
+    if (JPy_InitModule(state) < 0) {
+        JPY_RETURN(NULL);
+    }
+
     //printf("PyInit_jpy: exit\n");
 
-    JPY_RETURN(JPy_Module);
+    JPY_RETURN(state->module);
+
+#endif
 }
 
+#if defined(JPY_COMPAT_MODULE_STATE)
+/**
+ * Executes the 'jpy' module in the current (sub-)interpreter, called once per interpreter which imports 'jpy'.
+ */
+int JPy_exec(PyObject* module)
+{
+    JPy_ModuleState* state;
+
+    state = (JPy_ModuleState*) PyModule_GetState(module);
+    if (state == NULL) {
+        return -1;
+    }
+    // The module object is borrowed, as JPy_Module has been before
+    state->module = module;
+
+    // Register the state first, so that JPy_GetModuleState() finds it from now on
+    if (JPy_RegisterModuleState(state) < 0) {
+        return -1;
+    }
+
+    return JPy_InitModule(state);
+}
+#endif
+
 PyObject* JPy_has_jvm(PyObject* self)
 {
     return PyBool_FromLong(JPy_JVM != NULL);
@@ -477,6 +907,102 @@ PyObject* JPy_get_type(PyObject* self, PyObject* args, PyObject* kwds)
     return (PyObject*) JType_GetTypeForName(jenv, className, (jboolean) (resolve != 0 ? JNI_TRUE : JNI_FALSE));
 }
 
+PyObject* JPy_preload(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    static char* keywords[] = {"names", "background", NULL};
+    PyObject* names;
+    int background;
+    int count;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    background = 0; // False
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|i:preload", keywords, &names, &background)) {
+        return NULL;
+    }
+
+    if (background) {
+        PyObject* threading;
+        PyObject* preload;
+        PyObject* thread;
+        PyObject* result;
+
+        // Call jpy.preload(names) from a new daemon thread
+        threading = PyImport_ImportModule("threading");
+        if (threading == NULL) {
+            return NULL;
+        }
+        preload = PyObject_GetAttrString(JPy_Module, "preload");
+        if (preload == NULL) {
+            Py_DECREF(threading);
+            return NULL;
+        }
+        thread = PyObject_CallMethod(threading, "Thread", "OOs(O)", Py_None, preload, "jpy-preload", names);
+        Py_DECREF(preload);
+        Py_DECREF(threading);
+        if (thread == NULL) {
+            return NULL;
+        }
+        if (PyObject_SetAttrString(thread, "daemon", Py_True) < 0) {
+            Py_DECREF(thread);
+            return NULL;
+        }
+        result = PyObject_CallMethod(thread, "start", NULL);
+        if (result == NULL) {
+            Py_DECREF(thread);
+            return NULL;
+        }
+        Py_DECREF(result);
+        return thread;
+    }
+
+    count = JType_PreloadTypes(jenv, names);
+    if (count < 0) {
+        return NULL;
+    }
+    return JPy_FROM_CLONG(count);
+}
+
+PyObject* JPy_set_identity_cache(PyObject* self, PyObject* args)
+{
+    JNIEnv* jenv;
+    PyObject* objType;
+    JPy_JType* type;
+    int enabled;
+    int wasEnabled;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    if (!PyArg_ParseTuple(args, "Oi:set_identity_cache", &objType, &enabled)) {
+        return NULL;
+    }
+
+    if (JPy_IS_STR(objType)) {
+        const char* typeName = JPy_AS_UTF8(objType);
+        type = JType_GetTypeForName(jenv, typeName, JNI_FALSE);
+        if (type == NULL) {
+            return NULL;
+        }
+    } else if (JType_Check(objType)) {
+        type = (JPy_JType*) objType;
+    } else {
+        PyErr_SetString(PyExc_ValueError, "set_identity_cache: argument 1 (type) must be a Java type name or Java type object");
+        return NULL;
+    }
+
+    if (type->isPrimitive) {
+        PyErr_SetString(PyExc_ValueError, "set_identity_cache: argument 1 (type) must not be a primitive Java type");
+        return NULL;
+    }
+
+    wasEnabled = JType_SetIdentityCache(type, (jboolean) (enabled ? JNI_TRUE : JNI_FALSE));
+    if (wasEnabled < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(wasEnabled);
+}
+
 PyObject* JPy_cast(PyObject* self, PyObject* args)
 {
     JNIEnv* jenv;
@@ -594,6 +1120,324 @@ PyObject* JPy_array(PyObject* self, PyObject* args)
     }
 }
 
+PyObject* JPy_to_numpy(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    static char* keywords[] = {"jarr", "copy", NULL};
+    PyObject* obj;
+    int copy;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    copy = 1; // True
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|i:to_numpy", keywords, &obj, &copy)) {
+        return NULL;
+    }
+
+    if (!JObj_Check(obj)) {
+        PyErr_SetString(PyExc_ValueError, "to_numpy: argument 1 (jarr) must be a Java array");
+        return NULL;
+    }
+
+    return JArray_ToNumPy(jenv, obj, (jboolean) (copy != 0 ? JNI_TRUE : JNI_FALSE));
+}
+
+PyObject* JPy_from_numpy(PyObject* self, PyObject* args)
+{
+    JNIEnv* jenv;
+    JPy_JType* componentType;
+    PyObject* objArray;
+    PyObject* objType;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    if (!PyArg_ParseTuple(args, "OO:from_numpy", &objArray, &objType)) {
+        return NULL;
+    }
+
+    if (JPy_IS_STR(objType)) {
+        const char* typeName;
+        typeName = JPy_AS_UTF8(objType);
+        componentType = JType_GetTypeForName(jenv, typeName, JNI_FALSE);
+        if (componentType == NULL) {
+            return NULL;
+        }
+    } else if (JType_Check(objType)) {
+        componentType = (JPy_JType*) objType;
+    } else {
+        PyErr_SetString(PyExc_ValueError, "from_numpy: argument 2 (type) must be a type name or Java type object");
+        return NULL;
+    }
+
+    if (!componentType->isPrimitive || componentType == JPy_JVoid) {
+        PyErr_SetString(PyExc_ValueError, "from_numpy: argument 2 (type) must be a primitive Java type other than 'void'");
+        return NULL;
+    }
+
+    if (!PyObject_CheckBuffer(objArray)) {
+        PyErr_SetString(PyExc_ValueError, "from_numpy: argument 1 (arr) must be a numpy.ndarray or any other object supporting the buffer protocol");
+        return NULL;
+    }
+
+    return JArray_FromBuffer(jenv, objArray, componentType);
+}
+
+PyObject* JPy_set_nd_buffers(PyObject* self, PyObject* args)
+{
+    PyObject* enabled;
+    jboolean oldValue;
+    int newValue;
+
+    if (!PyArg_ParseTuple(args, "O:set_nd_buffers", &enabled)) {
+        return NULL;
+    }
+
+    newValue = PyObject_IsTrue(enabled);
+    if (newValue < 0) {
+        return NULL;
+    }
+
+    oldValue = JPy_NDBufferExport;
+    JPy_NDBufferExport = (jboolean) (newValue ? JNI_TRUE : JNI_FALSE);
+    return PyBool_FromLong(oldValue);
+}
+
+PyObject* JPy_get_fields(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    static char* keywords[] = {"objs", "names", "as_numpy", NULL};
+    PyObject* objs;
+    PyObject* names;
+    int asNumPy;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    asNumPy = 0; // False
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO|i:get_fields", keywords, &objs, &names, &asNumPy)) {
+        return NULL;
+    }
+
+    return JField_GetColumns(jenv, objs, names, (jboolean) (asNumPy != 0 ? JNI_TRUE : JNI_FALSE));
+}
+
+PyObject* JPy_get_method(PyObject* self, PyObject* args)
+{
+    JNIEnv* jenv;
+    PyObject* target;
+    PyObject* name;
+    const char* signature;
+    JPy_JType* type;
+    PyObject* overloadedMethod;
+    JPy_JMethod* method;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    if (!PyArg_ParseTuple(args, "OOs:get_method", &target, &name, &signature)) {
+        return NULL;
+    }
+
+    if (!JPy_IS_STR(name)) {
+        PyErr_SetString(PyExc_ValueError, "get_method: argument 2 (name) must be a string");
+        return NULL;
+    }
+
+    if (JObj_Check(target)) {
+        type = (JPy_JType*) Py_TYPE(target);
+    } else if (JType_Check(target)) {
+        type = (JPy_JType*) target;
+    } else if (JPy_IS_STR(target)) {
+        type = JType_GetTypeForName(jenv, JPy_AS_UTF8(target), JNI_FALSE);
+        if (type == NULL) {
+            return NULL;
+        }
+    } else {
+        PyErr_SetString(PyExc_ValueError, "get_method: argument 1 (target) must be a Java object, type object or type name");
+        return NULL;
+    }
+
+    if (JType_ResolveType(jenv, type) < 0) {
+        return NULL;
+    }
+
+    overloadedMethod = JType_GetOverloadedMethod(jenv, type, name, JNI_TRUE);
+    if (overloadedMethod == NULL) {
+        return NULL;
+    } else if (overloadedMethod == Py_None) {
+        PyErr_Format(PyExc_ValueError, "Java type '%s' has no method '%s'", type->javaName, JPy_AS_UTF8(name));
+        return NULL;
+    }
+
+    method = JOverloadedMethod_FindExactMethod(jenv, (JPy_JOverloadedMethod*) overloadedMethod, signature, 0, NULL);
+    if (method == NULL) {
+        return NULL;
+    }
+
+    if (JObj_Check(target)) {
+        return JPy_METHOD_NEW((PyObject*) method, target, (PyObject*) type);
+    }
+    Py_INCREF(method);
+    return (PyObject*) method;
+}
+
+PyObject* JPy_map(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    static char* keywords[] = {"method", "args", "as_numpy", "release_gil", NULL};
+    PyObject* method;
+    PyObject* argsSeq;
+    int asNumPy;
+    int releaseGIL;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    asNumPy = 0; // False
+    releaseGIL = 0; // False
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OO|ii:map", keywords, &method, &argsSeq, &asNumPy, &releaseGIL)) {
+        return NULL;
+    }
+
+    return JMethod_Map(jenv, method, argsSeq,
+                       (jboolean) (asNumPy != 0 ? JNI_TRUE : JNI_FALSE),
+                       (jboolean) (releaseGIL != 0 ? JNI_TRUE : JNI_FALSE));
+}
+
+PyObject* JPy_vectorize(PyObject* self, PyObject* args)
+{
+    PyObject* method;
+
+    if (!PyArg_ParseTuple(args, "O:vectorize", &method)) {
+        return NULL;
+    }
+    if (PyMethod_Check(method)) {
+        method = PyMethod_GET_FUNCTION(method);
+    }
+
+    return JMethod_Vectorize(method);
+}
+
+PyObject* JPy_to_java_future(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    static char* keywords[] = {"obj", "loop", NULL};
+    PyObject* obj;
+    PyObject* loop;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    loop = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O:to_java_future", keywords, &obj, &loop)) {
+        return NULL;
+    }
+
+    return JFuture_ToJava(jenv, obj, loop);
+}
+
+/**
+ * Returns the Java type given as type name or type object, java.lang.Object if objType is NULL.
+ */
+static JPy_JType* JPy_GetCollectionTypeArg(JNIEnv* jenv, PyObject* objType, const char* errorMessage)
+{
+    JPy_JType* type;
+
+    if (objType == NULL) {
+        return JPy_JObject;
+    } else if (JPy_IS_STR(objType)) {
+        type = JType_GetTypeForName(jenv, JPy_AS_UTF8(objType), JNI_FALSE);
+        if (type == NULL) {
+            return NULL;
+        }
+    } else if (JType_Check(objType)) {
+        type = (JPy_JType*) objType;
+    } else {
+        PyErr_SetString(PyExc_ValueError, errorMessage);
+        return NULL;
+    }
+
+    if (type == JPy_JVoid) {
+        PyErr_SetString(PyExc_ValueError, errorMessage);
+        return NULL;
+    }
+    return type;
+}
+
+/**
+ * Wraps the given new local reference, which is deleted.
+ */
+static PyObject* JPy_FromNewLocalRef(JNIEnv* jenv, jobject objectRef)
+{
+    PyObject* pyObj;
+
+    pyObj = (PyObject*) JObj_New(jenv, objectRef);
+    (*jenv)->DeleteLocalRef(jenv, objectRef);
+    return pyObj;
+}
+
+PyObject* JPy_to_java_list(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    static char* keywords[] = {"seq", "item_type", NULL};
+    PyObject* obj;
+    PyObject* objItemType;
+    JPy_JType* itemType;
+    jobject listRef;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    objItemType = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|O:to_java_list", keywords, &obj, &objItemType)) {
+        return NULL;
+    }
+
+    itemType = JPy_GetCollectionTypeArg(jenv, objItemType, "to_java_list: argument 2 (item_type) must be a Java type name or Java type object other than 'void'");
+    if (itemType == NULL) {
+        return NULL;
+    }
+
+    if (JColl_ToJavaList(jenv, obj, itemType, &listRef) < 0) {
+        return NULL;
+    }
+    return JPy_FromNewLocalRef(jenv, listRef);
+}
+
+PyObject* JPy_to_java_map(PyObject* self, PyObject* args, PyObject* kwds)
+{
+    JNIEnv* jenv;
+    static char* keywords[] = {"mapping", "key_type", "value_type", NULL};
+    PyObject* obj;
+    PyObject* objKeyType;
+    PyObject* objValueType;
+    JPy_JType* keyType;
+    JPy_JType* valueType;
+    jobject mapRef;
+
+    JPy_GET_JNI_ENV_OR_RETURN(jenv, NULL)
+
+    objKeyType = NULL;
+    objValueType = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "O|OO:to_java_map", keywords, &obj, &objKeyType, &objValueType)) {
+        return NULL;
+    }
+
+    if (!PyDict_Check(obj) && !PyObject_HasAttrString(obj, "items")) {
+        PyErr_SetString(PyExc_ValueError, "to_java_map: argument 1 (mapping) must be a dict or any other mapping");
+        return NULL;
+    }
+
+    keyType = JPy_GetCollectionTypeArg(jenv, objKeyType, "to_java_map: argument 2 (key_type) must be a Java type name or Java type object other than 'void'");
+    if (keyType == NULL) {
+        return NULL;
+    }
+    valueType = JPy_GetCollectionTypeArg(jenv, objValueType, "to_java_map: argument 3 (value_type) must be a Java type name or Java type object other than 'void'");
+    if (valueType == NULL) {
+        return NULL;
+    }
+
+    if (JColl_ToJavaMap(jenv, obj, keyType, valueType, &mapRef) < 0) {
+        return NULL;
+    }
+    return JPy_FromNewLocalRef(jenv, mapRef);
+}
+
 
 JPy_JType* JPy_GetNonObjectJType(JNIEnv* jenv, jclass classRef)
 {
@@ -661,6 +1505,17 @@ jmethodID JPy_GetMethod(JNIEnv* jenv, jclass classRef, const char* name, const c
 }
 
 
+jmethodID JPy_GetStaticMethod(JNIEnv* jenv, jclass classRef, const char* name, const char* sig)
+{
+    jmethodID methodID;
+    methodID = (*jenv)->GetStaticMethodID(jenv, classRef, name, sig);
+    if (methodID == NULL) {
+        PyErr_Format(PyExc_RuntimeError, "jpy: internal error: static method not found: %s%s", name, sig);
+        return NULL;
+    }
+    return methodID;
+}
+
 
 #define DEFINE_CLASS(C, N) \
     C = JPy_GetClass(jenv, N); \
@@ -676,6 +1531,21 @@ jmethodID JPy_GetMethod(JNIEnv* jenv, jclass classRef, const char* name, const c
     }
 
 
+#define DEFINE_STATIC_METHOD(M, C, N, S) \
+    M = JPy_GetStaticMethod(jenv, C, N, S); \
+    if (M == NULL) { \
+        return -1; \
+    }
+
+
+// Fields which are implementation details of the JDK, F is NULL if there is no such field
+#define DEFINE_OPTIONAL_FIELD(F, C, N, S) \
+    F = (*jenv)->GetFieldID(jenv, C, N, S); \
+    if (F == NULL) { \
+        (*jenv)->ExceptionClear(jenv); \
+    }
+
+
 #define DEFINE_NON_OBJECT_TYPE(T, C) \
     T = JPy_GetNonObjectJType(jenv, C); \
     if (T == NULL) { \
@@ -712,12 +1582,11 @@ int initGlobalPyObjectVars(JNIEnv* jenv)
 }
 
 
-int JPy_InitGlobalVars(JNIEnv* jenv)
+/**
+ * Initialises the global references to Java classes and the method IDs. They are shared by all interpreters.
+ */
+int initGlobalClassVars(JNIEnv* jenv)
 {
-    if (JPy_Comparable_JClass != NULL) {
-        return 0;
-    }
-
     DEFINE_CLASS(JPy_Comparable_JClass, "java/lang/Comparable");
     DEFINE_METHOD(JPy_Comparable_CompareTo_MID, JPy_Comparable_JClass, "compareTo", "(Ljava/lang/Object;)I");
 
@@ -752,33 +1621,72 @@ int JPy_InitGlobalVars(JNIEnv* jenv)
     DEFINE_METHOD(JPy_Method_GetParameterTypes_MID, JPy_Method_JClass, "getParameterTypes", "()[Ljava/lang/Class;");
     DEFINE_METHOD(JPy_Method_GetReturnType_MID, JPy_Method_JClass, "getReturnType", "()Ljava/lang/Class;");
 
+    DEFINE_CLASS(JPy_System_JClass, "java/lang/System");
+    DEFINE_STATIC_METHOD(JPy_System_IdentityHashCode_MID, JPy_System_JClass, "identityHashCode", "(Ljava/lang/Object;)I");
+
     DEFINE_CLASS(JPy_RuntimeException_JClass, "java/lang/RuntimeException");
+    DEFINE_CLASS(JPy_CompletionStage_JClass, "java/util/concurrent/CompletionStage");
+
+    DEFINE_CLASS(JPy_Collection_JClass, "java/util/Collection");
+    DEFINE_METHOD(JPy_Collection_Size_MID, JPy_Collection_JClass, "size", "()I");
+    DEFINE_METHOD(JPy_Collection_Contains_MID, JPy_Collection_JClass, "contains", "(Ljava/lang/Object;)Z");
+    DEFINE_METHOD(JPy_Collection_ToArray_MID, JPy_Collection_JClass, "toArray", "()[Ljava/lang/Object;");
+    DEFINE_CLASS(JPy_List_JClass, "java/util/List");
+    DEFINE_METHOD(JPy_List_Get_MID, JPy_List_JClass, "get", "(I)Ljava/lang/Object;");
+    DEFINE_METHOD(JPy_List_Set_MID, JPy_List_JClass, "set", "(ILjava/lang/Object;)Ljava/lang/Object;");
+    DEFINE_METHOD(JPy_List_Add_MID, JPy_List_JClass, "add", "(ILjava/lang/Object;)V");
+    DEFINE_METHOD(JPy_List_Remove_MID, JPy_List_JClass, "remove", "(I)Ljava/lang/Object;");
+    DEFINE_CLASS(JPy_Map_JClass, "java/util/Map");
+    DEFINE_METHOD(JPy_Map_Size_MID, JPy_Map_JClass, "size", "()I");
+    DEFINE_METHOD(JPy_Map_Get_MID, JPy_Map_JClass, "get", "(Ljava/lang/Object;)Ljava/lang/Object;");
+    DEFINE_METHOD(JPy_Map_Put_MID, JPy_Map_JClass, "put", "(Ljava/lang/Object;Ljava/lang/Object;)Ljava/lang/Object;");
+    DEFINE_METHOD(JPy_Map_Remove_MID, JPy_Map_JClass, "remove", "(Ljava/lang/Object;)Ljava/lang/Object;");
+    DEFINE_METHOD(JPy_Map_ContainsKey_MID, JPy_Map_JClass, "containsKey", "(Ljava/lang/Object;)Z");
+    DEFINE_METHOD(JPy_Map_KeySet_MID, JPy_Map_JClass, "keySet", "()Ljava/util/Set;");
+    DEFINE_METHOD(JPy_Map_EntrySet_MID, JPy_Map_JClass, "entrySet", "()Ljava/util/Set;");
+    DEFINE_CLASS(JPy_MapEntry_JClass, "java/util/Map$Entry");
+    DEFINE_METHOD(JPy_MapEntry_GetKey_MID, JPy_MapEntry_JClass, "getKey", "()Ljava/lang/Object;");
+    DEFINE_METHOD(JPy_MapEntry_GetValue_MID, JPy_MapEntry_JClass, "getValue", "()Ljava/lang/Object;");
+    DEFINE_CLASS(JPy_ArrayList_JClass, "java/util/ArrayList");
+    DEFINE_METHOD(JPy_ArrayList_Init_MID, JPy_ArrayList_JClass, "<init>", "(Ljava/util/Collection;)V");
+    DEFINE_CLASS(JPy_Arrays_JClass, "java/util/Arrays");
+    DEFINE_STATIC_METHOD(JPy_Arrays_AsList_MID, JPy_Arrays_JClass, "asList", "([Ljava/lang/Object;)Ljava/util/List;");
+    DEFINE_CLASS(JPy_HashMap_JClass, "java/util/HashMap");
+    DEFINE_METHOD(JPy_HashMap_Init_MID, JPy_HashMap_JClass, "<init>", "(I)V");
 
     DEFINE_CLASS(JPy_Boolean_JClass, "java/lang/Boolean");
-    DEFINE_METHOD(JPy_Boolean_Init_MID, JPy_Boolean_JClass, "<init>", "(Z)V");
+    DEFINE_STATIC_METHOD(JPy_Boolean_ValueOf_MID, JPy_Boolean_JClass, "valueOf", "(Z)Ljava/lang/Boolean;");
+    DEFINE_OPTIONAL_FIELD(JPy_Boolean_Value_FID, JPy_Boolean_JClass, "value", "Z");
     DEFINE_METHOD(JPy_Boolean_BooleanValue_MID, JPy_Boolean_JClass, "booleanValue", "()Z");
 
     DEFINE_CLASS(JPy_Character_JClass, "java/lang/Character");
-    DEFINE_METHOD(JPy_Character_Init_MID, JPy_Character_JClass, "<init>", "(C)V");
+    DEFINE_STATIC_METHOD(JPy_Character_ValueOf_MID, JPy_Character_JClass, "valueOf", "(C)Ljava/lang/Character;");
+    DEFINE_OPTIONAL_FIELD(JPy_Character_Value_FID, JPy_Character_JClass, "value", "C");
     DEFINE_METHOD(JPy_Character_CharValue_MID, JPy_Character_JClass, "charValue", "()C");
 
     DEFINE_CLASS(JPy_Byte_JClass, "java/lang/Byte");
-    DEFINE_METHOD(JPy_Byte_Init_MID, JPy_Byte_JClass, "<init>", "(B)V");
+    DEFINE_STATIC_METHOD(JPy_Byte_ValueOf_MID, JPy_Byte_JClass, "valueOf", "(B)Ljava/lang/Byte;");
+    DEFINE_OPTIONAL_FIELD(JPy_Byte_Value_FID, JPy_Byte_JClass, "value", "B");
 
     DEFINE_CLASS(JPy_Short_JClass, "java/lang/Short");
-    DEFINE_METHOD(JPy_Short_Init_MID, JPy_Short_JClass, "<init>", "(S)V");
+    DEFINE_STATIC_METHOD(JPy_Short_ValueOf_MID, JPy_Short_JClass, "valueOf", "(S)Ljava/lang/Short;");
+    DEFINE_OPTIONAL_FIELD(JPy_Short_Value_FID, JPy_Short_JClass, "value", "S");
 
     DEFINE_CLASS(JPy_Integer_JClass, "java/lang/Integer");
-    DEFINE_METHOD(JPy_Integer_Init_MID, JPy_Integer_JClass, "<init>", "(I)V");
+    DEFINE_STATIC_METHOD(JPy_Integer_ValueOf_MID, JPy_Integer_JClass, "valueOf", "(I)Ljava/lang/Integer;");
+    DEFINE_OPTIONAL_FIELD(JPy_Integer_Value_FID, JPy_Integer_JClass, "value", "I");
 
     DEFINE_CLASS(JPy_Long_JClass, "java/lang/Long");
-    DEFINE_METHOD(JPy_Long_Init_MID, JPy_Long_JClass, "<init>", "(J)V");
+    DEFINE_STATIC_METHOD(JPy_Long_ValueOf_MID, JPy_Long_JClass, "valueOf", "(J)Ljava/lang/Long;");
+    DEFINE_OPTIONAL_FIELD(JPy_Long_Value_FID, JPy_Long_JClass, "value", "J");
 
     DEFINE_CLASS(JPy_Float_JClass, "java/lang/Float");
-    DEFINE_METHOD(JPy_Float_Init_MID, JPy_Float_JClass, "<init>", "(F)V");
+    DEFINE_STATIC_METHOD(JPy_Float_ValueOf_MID, JPy_Float_JClass, "valueOf", "(F)Ljava/lang/Float;");
+    DEFINE_OPTIONAL_FIELD(JPy_Float_Value_FID, JPy_Float_JClass, "value", "F");
 
     DEFINE_CLASS(JPy_Double_JClass, "java/lang/Double");
-    DEFINE_METHOD(JPy_Double_Init_MID, JPy_Double_JClass, "<init>", "(D)V");
+    DEFINE_STATIC_METHOD(JPy_Double_ValueOf_MID, JPy_Double_JClass, "valueOf", "(D)Ljava/lang/Double;");
+    DEFINE_OPTIONAL_FIELD(JPy_Double_Value_FID, JPy_Double_JClass, "value", "D");
 
     DEFINE_CLASS(JPy_Number_JClass, "java/lang/Number");
     DEFINE_METHOD(JPy_Number_IntValue_MID, JPy_Number_JClass, "intValue", "()I");
@@ -789,6 +1697,20 @@ int JPy_InitGlobalVars(JNIEnv* jenv)
 
     DEFINE_CLASS(JPy_String_JClass, "java/lang/String");
 
+    return 0;
+}
+
+
+int JPy_InitGlobalVars(JNIEnv* jenv)
+{
+    // The Java classes are initialised only once, the types once per interpreter
+    if (JPy_Comparable_JClass == NULL && initGlobalClassVars(jenv) < 0) {
+        return -1;
+    }
+    if (JPy_JObject != NULL) {
+        return 0;
+    }
+
     // Non-Object types: Primitive types and void.
     DEFINE_NON_OBJECT_TYPE(JPy_JBoolean, JPy_Boolean_JClass);
     DEFINE_NON_OBJECT_TYPE(JPy_JChar, JPy_Character_JClass);
@@ -827,7 +1749,7 @@ int JPy_InitGlobalVars(JNIEnv* jenv)
     return 0;
 }
 
-void JPy_ClearGlobalVars(JNIEnv* jenv)
+void clearGlobalClassVars(JNIEnv* jenv)
 {
     if (jenv != NULL) {
         (*jenv)->DeleteGlobalRef(jenv, JPy_Comparable_JClass);
@@ -836,7 +1758,16 @@ void JPy_ClearGlobalVars(JNIEnv* jenv)
         (*jenv)->DeleteGlobalRef(jenv, JPy_Constructor_JClass);
         (*jenv)->DeleteGlobalRef(jenv, JPy_Method_JClass);
         (*jenv)->DeleteGlobalRef(jenv, JPy_Field_JClass);
+        (*jenv)->DeleteGlobalRef(jenv, JPy_System_JClass);
         (*jenv)->DeleteGlobalRef(jenv, JPy_RuntimeException_JClass);
+        (*jenv)->DeleteGlobalRef(jenv, JPy_CompletionStage_JClass);
+        (*jenv)->DeleteGlobalRef(jenv, JPy_Collection_JClass);
+        (*jenv)->DeleteGlobalRef(jenv, JPy_List_JClass);
+        (*jenv)->DeleteGlobalRef(jenv, JPy_Map_JClass);
+        (*jenv)->DeleteGlobalRef(jenv, JPy_MapEntry_JClass);
+        (*jenv)->DeleteGlobalRef(jenv, JPy_ArrayList_JClass);
+        (*jenv)->DeleteGlobalRef(jenv, JPy_Arrays_JClass);
+        (*jenv)->DeleteGlobalRef(jenv, JPy_HashMap_JClass);
         (*jenv)->DeleteGlobalRef(jenv, JPy_Boolean_JClass);
         (*jenv)->DeleteGlobalRef(jenv, JPy_Character_JClass);
         (*jenv)->DeleteGlobalRef(jenv, JPy_Byte_JClass);
@@ -856,7 +1787,17 @@ void JPy_ClearGlobalVars(JNIEnv* jenv)
     JPy_Constructor_JClass = NULL;
     JPy_Method_JClass = NULL;
     JPy_Field_JClass = NULL;
+    JPy_System_JClass = NULL;
+    JPy_System_IdentityHashCode_MID = NULL;
     JPy_RuntimeException_JClass = NULL;
+    JPy_CompletionStage_JClass = NULL;
+    JPy_Collection_JClass = NULL;
+    JPy_List_JClass = NULL;
+    JPy_Map_JClass = NULL;
+    JPy_MapEntry_JClass = NULL;
+    JPy_ArrayList_JClass = NULL;
+    JPy_Arrays_JClass = NULL;
+    JPy_HashMap_JClass = NULL;
     JPy_Boolean_JClass = NULL;
     JPy_Character_JClass = NULL;
     JPy_Byte_JClass = NULL;
@@ -890,61 +1831,99 @@ void JPy_ClearGlobalVars(JNIEnv* jenv)
     JPy_Field_GetName_MID = NULL;
     JPy_Field_GetModifiers_MID = NULL;
     JPy_Field_GetType_MID = NULL;
-    JPy_Boolean_Init_MID = NULL;
+    JPy_Collection_Size_MID = NULL;
+    JPy_Collection_Contains_MID = NULL;
+    JPy_Collection_ToArray_MID = NULL;
+    JPy_List_Get_MID = NULL;
+    JPy_List_Set_MID = NULL;
+    JPy_List_Add_MID = NULL;
+    JPy_List_Remove_MID = NULL;
+    JPy_Map_Size_MID = NULL;
+    JPy_Map_Get_MID = NULL;
+    JPy_Map_Put_MID = NULL;
+    JPy_Map_Remove_MID = NULL;
+    JPy_Map_ContainsKey_MID = NULL;
+    JPy_Map_KeySet_MID = NULL;
+    JPy_Map_EntrySet_MID = NULL;
+    JPy_MapEntry_GetKey_MID = NULL;
+    JPy_MapEntry_GetValue_MID = NULL;
+    JPy_ArrayList_Init_MID = NULL;
+    JPy_Arrays_AsList_MID = NULL;
+    JPy_HashMap_Init_MID = NULL;
+    JPy_Boolean_ValueOf_MID = NULL;
+    JPy_Boolean_Value_FID = NULL;
     JPy_Boolean_BooleanValue_MID = NULL;
-    JPy_Character_Init_MID = NULL;
+    JPy_Character_ValueOf_MID = NULL;
+    JPy_Character_Value_FID = NULL;
     JPy_Character_CharValue_MID = NULL;
-    JPy_Byte_Init_MID = NULL;
-    JPy_Short_Init_MID = NULL;
-    JPy_Integer_Init_MID = NULL;
-    JPy_Long_Init_MID = NULL;
-    JPy_Float_Init_MID = NULL;
-    JPy_Double_Init_MID = NULL;
+    JPy_Byte_ValueOf_MID = NULL;
+    JPy_Byte_Value_FID = NULL;
+    JPy_Short_ValueOf_MID = NULL;
+    JPy_Short_Value_FID = NULL;
+    JPy_Integer_ValueOf_MID = NULL;
+    JPy_Integer_Value_FID = NULL;
+    JPy_Long_ValueOf_MID = NULL;
+    JPy_Long_Value_FID = NULL;
+    JPy_Float_ValueOf_MID = NULL;
+    JPy_Float_Value_FID = NULL;
+    JPy_Double_ValueOf_MID = NULL;
+    JPy_Double_Value_FID = NULL;
     JPy_Number_IntValue_MID = NULL;
     JPy_Number_LongValue_MID = NULL;
     JPy_Number_DoubleValue_MID = NULL;
     JPy_PyObject_GetPointer_MID = NULL;
+}
+
+void clearGlobalTypeVars(JPy_ModuleState* state)
+{
+    Py_XDECREF(state->jBoolean);
+    Py_XDECREF(state->jChar);
+    Py_XDECREF(state->jByte);
+    Py_XDECREF(state->jShort);
+    Py_XDECREF(state->jInt);
+    Py_XDECREF(state->jLong);
+    Py_XDECREF(state->jFloat);
+    Py_XDECREF(state->jDouble);
+    Py_XDECREF(state->jVoid);
+    Py_XDECREF(state->jBooleanObj);
+    Py_XDECREF(state->jCharacterObj);
+    Py_XDECREF(state->jByteObj);
+    Py_XDECREF(state->jShortObj);
+    Py_XDECREF(state->jIntegerObj);
+    Py_XDECREF(state->jLongObj);
+    Py_XDECREF(state->jFloatObj);
+    Py_XDECREF(state->jDoubleObj);
+    Py_XDECREF(state->jPyObject);
+    Py_XDECREF(state->jPyModule);
+
+    state->jBoolean = NULL;
+    state->jChar = NULL;
+    state->jByte = NULL;
+    state->jShort = NULL;
+    state->jInt = NULL;
+    state->jLong = NULL;
+    state->jFloat = NULL;
+    state->jDouble = NULL;
+    state->jVoid = NULL;
+    state->jString = NULL;
+    state->jBooleanObj = NULL;
+    state->jCharacterObj = NULL;
+    state->jByteObj = NULL;
+    state->jShortObj = NULL;
+    state->jIntegerObj = NULL;
+    state->jLongObj = NULL;
+    state->jFloatObj = NULL;
+    state->jDoubleObj = NULL;
+    state->jObject = NULL;
+    state->jClass = NULL;
+    state->jPyObject = NULL;
+    state->jPyModule = NULL;
+}
 
-    Py_XDECREF(JPy_JBoolean);
-    Py_XDECREF(JPy_JChar);
-    Py_XDECREF(JPy_JByte);
-    Py_XDECREF(JPy_JShort);
-    Py_XDECREF(JPy_JInt);
-    Py_XDECREF(JPy_JLong);
-    Py_XDECREF(JPy_JFloat);
-    Py_XDECREF(JPy_JDouble);
-    Py_XDECREF(JPy_JVoid);
-    Py_XDECREF(JPy_JBooleanObj);
-    Py_XDECREF(JPy_JCharacterObj);
-    Py_XDECREF(JPy_JByteObj);
-    Py_XDECREF(JPy_JShortObj);
-    Py_XDECREF(JPy_JIntegerObj);
-    Py_XDECREF(JPy_JLongObj);
-    Py_XDECREF(JPy_JFloatObj);
-    Py_XDECREF(JPy_JDoubleObj);
-    Py_XDECREF(JPy_JPyObject);
-    Py_XDECREF(JPy_JPyModule);
-
-    JPy_JBoolean = NULL;
-    JPy_JChar = NULL;
-    JPy_JByte = NULL;
-    JPy_JShort = NULL;
-    JPy_JInt = NULL;
-    JPy_JLong = NULL;
-    JPy_JFloat = NULL;
-    JPy_JDouble = NULL;
-    JPy_JVoid = NULL;
-    JPy_JString = NULL;
-    JPy_JBooleanObj = NULL;
-    JPy_JCharacterObj = NULL;
-    JPy_JByteObj = NULL;
-    JPy_JShortObj = NULL;
-    JPy_JIntegerObj = NULL;
-    JPy_JLongObj = NULL;
-    JPy_JFloatObj = NULL;
-    JPy_JDoubleObj = NULL;
-    JPy_JPyObject = NULL;
-    JPy_JPyModule = NULL;
+void JPy_ClearGlobalVars(JNIEnv* jenv)
+{
+    clearGlobalClassVars(jenv);
+    clearGlobalTypeVars(JPy_GetModuleState());
 }
 
 
@@ -979,16 +1958,56 @@ void JPy_HandleJavaException(JNIEnv* jenv)
     }
 }
 
-void JPy_free(void* unused)
+void JPy_free(void* module)
 {
+    JPy_ModuleState* state;
+    jboolean isMainState;
+    int i;
+
     JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "JPy_free: freeing module data...\n");
-    JPy_ClearGlobalVars(NULL);
 
-    JPy_Module = NULL;
-    JPy_Types = NULL;
-    JPy_Type_Callbacks = NULL;
-    JException_Type = NULL;
+#if defined(JPY_COMPAT_MODULE_STATE)
+    state = (JPy_ModuleState*) PyModule_GetState((PyObject*) module);
+    if (state == NULL) {
+        return;
+    }
+    isMainState = state == JPy_MainModuleState;
+    JPy_UnregisterModuleState(state);
+#else
+    state = JPy_GetModuleState();
+    isMainState = JNI_TRUE;
+#endif
+
+    // The Java classes are shared by all interpreters, so only the main interpreter releases them
+    if (isMainState) {
+        clearGlobalClassVars(NULL);
+    }
+    clearGlobalTypeVars(state);
+
+    for (i = 0; i < JPy_NAME_CACHE_SIZE; i++) {
+        Py_CLEAR(state->nameCache[i].name);
+    }
+
+#if defined(JPY_COMPAT_MODULE_STATE)
+    // Instances of the heap types own references to them, so they outlive the module if required
+    Py_CLEAR(state->jtypeType);
+    Py_CLEAR(state->jmethodType);
+    Py_CLEAR(state->joverloadedMethodType);
+    Py_CLEAR(state->jfieldType);
+    Py_CLEAR(state->diagType);
+#endif
+
+    state->module = NULL;
+    state->types = NULL;
+    state->typeCallbacks = NULL;
+    state->exceptionType = NULL;
+
+#if !defined(JPY_COMPAT_FREE_THREADING)
+    if (state->typeLock != NULL) {
+        PyThread_free_lock(state->typeLock);
+        state->typeLock = NULL;
+    }
+#endif
 
     JPy_DIAG_PRINT(JPy_DIAG_F_ALL, "JPy_free: done freeing module data\n");
 }
-
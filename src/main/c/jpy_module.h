@@ -23,19 +23,106 @@ extern "C" {
 
 #include <Python.h>
 #include <structmember.h>
+#include <pythread.h>
 #include <jni.h>
 
 #include "jpy_compat.h"
 
 #define JPY_JNI_VERSION JNI_VERSION_1_6
 
-extern PyObject* JPy_Module;
-extern PyObject* JPy_Types;
-extern PyObject* JPy_Type_Callbacks;
-extern PyObject* JException_Type;
+struct JPy_JType;
+
+// The number of entries of the name cache, must be a power of 2, see JPy_FromJStringInterned()
+#define JPy_NAME_CACHE_SIZE 128
+// The maximum length of the names stored in the name cache
+#define JPy_NAME_CACHE_MAX_LENGTH 48
+
+typedef struct JPy_NameCacheEntry
+{
+    // The interned Python name, NULL if the entry is unused
+    PyObject* name;
+    jint length;
+    jchar chars[JPy_NAME_CACHE_MAX_LENGTH];
+}
+JPy_NameCacheEntry;
+
+/**
+ * The state of the 'jpy' module in a Python interpreter.
+ *
+ * Python objects must not be shared between interpreters, so every (sub-)interpreter which imports 'jpy'
+ * has its own module, type registry, type objects and JType instances. Use the macros below
+ * (JPy_Module, JPy_Types, JPy_JString, ...) to access the state of the current interpreter.
+ *
+ * In contrast, the global references to Java classes and the method IDs (JPy_XXX_JClass, JPy_XXX_MID)
+ * are valid for all threads of the JVM and therefore shared by all interpreters.
+ */
+typedef struct JPy_ModuleState
+{
+    PyObject* module;
+    PyObject* types;
+    PyObject* typeCallbacks;
+    PyObject* exceptionType;
+
+    // Per-interpreter copies of the static type objects JType_Type, JMethod_Type, ...
+    PyTypeObject* jtypeType;
+    PyTypeObject* jmethodType;
+    PyTypeObject* joverloadedMethodType;
+    PyTypeObject* jfieldType;
+    PyTypeObject* diagType;
+
+    struct JPy_JType* jBoolean;
+    struct JPy_JType* jChar;
+    struct JPy_JType* jByte;
+    struct JPy_JType* jShort;
+    struct JPy_JType* jInt;
+    struct JPy_JType* jLong;
+    struct JPy_JType* jFloat;
+    struct JPy_JType* jDouble;
+    struct JPy_JType* jVoid;
+    struct JPy_JType* jBooleanObj;
+    struct JPy_JType* jCharacterObj;
+    struct JPy_JType* jByteObj;
+    struct JPy_JType* jShortObj;
+    struct JPy_JType* jIntegerObj;
+    struct JPy_JType* jLongObj;
+    struct JPy_JType* jFloatObj;
+    struct JPy_JType* jDoubleObj;
+    struct JPy_JType* jObject;
+    struct JPy_JType* jClass;
+    struct JPy_JType* jString;
+    struct JPy_JType* jPyObject;
+    struct JPy_JType* jPyModule;
+
+    // Recursive lock guarding the creation and resolution of types, see JType_LockTypes()
+#if defined(JPY_COMPAT_FREE_THREADING)
+    PyMutex typeLock;
+#else
+    PyThread_type_lock typeLock;
+#endif
+    unsigned long typeLockOwner;
+    int typeLockDepth;
+
+    // Direct-mapped cache of the interned Python names of Java strings, see JPy_FromJStringInterned()
+    JPy_NameCacheEntry nameCache[JPy_NAME_CACHE_SIZE];
+}
+JPy_ModuleState;
+
+/**
+ * Gets the state of the 'jpy' module of the current Python interpreter.
+ * If the current thread has no Python thread state (e.g. the GIL has been released), the state last used by
+ * this thread is returned, or the main interpreter's state, if there is none.
+ * Never returns NULL; if 'jpy' has not been imported, all members of the returned state are NULL.
+ */
+JPy_ModuleState* JPy_GetModuleState(void);
+
+#define JPy_Module          (JPy_GetModuleState()->module)
+#define JPy_Types           (JPy_GetModuleState()->types)
+#define JPy_Type_Callbacks  (JPy_GetModuleState()->typeCallbacks)
+#define JException_Type     (JPy_GetModuleState()->exceptionType)
 
 extern JavaVM* JPy_JVM;
 extern jboolean JPy_MustDestroyJVM;
+extern jboolean JPy_NDBufferExport;
 
 
 #define JPy_JTYPE_ATTR_NAME_JINIT "__jinit__"
@@ -89,30 +176,28 @@ void JPy_HandleJavaException(JNIEnv* jenv);
     }
 
 
-struct JPy_JType;
-
-extern struct JPy_JType* JPy_JBoolean;
-extern struct JPy_JType* JPy_JChar;
-extern struct JPy_JType* JPy_JByte;
-extern struct JPy_JType* JPy_JShort;
-extern struct JPy_JType* JPy_JInt;
-extern struct JPy_JType* JPy_JLong;
-extern struct JPy_JType* JPy_JFloat;
-extern struct JPy_JType* JPy_JDouble;
-extern struct JPy_JType* JPy_JVoid;
-extern struct JPy_JType* JPy_JBooleanObj;
-extern struct JPy_JType* JPy_JCharacterObj;
-extern struct JPy_JType* JPy_JByteObj;
-extern struct JPy_JType* JPy_JShortObj;
-extern struct JPy_JType* JPy_JIntegerObj;
-extern struct JPy_JType* JPy_JLongObj;
-extern struct JPy_JType* JPy_JFloatObj;
-extern struct JPy_JType* JPy_JDoubleObj;
-extern struct JPy_JType* JPy_JObject;
-extern struct JPy_JType* JPy_JClass;
-extern struct JPy_JType* JPy_JString;
-extern struct JPy_JType* JPy_JPyObject;
-extern struct JPy_JType* JPy_JPyModule;
+#define JPy_JBoolean        (JPy_GetModuleState()->jBoolean)
+#define JPy_JChar           (JPy_GetModuleState()->jChar)
+#define JPy_JByte           (JPy_GetModuleState()->jByte)
+#define JPy_JShort          (JPy_GetModuleState()->jShort)
+#define JPy_JInt            (JPy_GetModuleState()->jInt)
+#define JPy_JLong           (JPy_GetModuleState()->jLong)
+#define JPy_JFloat          (JPy_GetModuleState()->jFloat)
+#define JPy_JDouble         (JPy_GetModuleState()->jDouble)
+#define JPy_JVoid           (JPy_GetModuleState()->jVoid)
+#define JPy_JBooleanObj     (JPy_GetModuleState()->jBooleanObj)
+#define JPy_JCharacterObj   (JPy_GetModuleState()->jCharacterObj)
+#define JPy_JByteObj        (JPy_GetModuleState()->jByteObj)
+#define JPy_JShortObj       (JPy_GetModuleState()->jShortObj)
+#define JPy_JIntegerObj     (JPy_GetModuleState()->jIntegerObj)
+#define JPy_JLongObj        (JPy_GetModuleState()->jLongObj)
+#define JPy_JFloatObj       (JPy_GetModuleState()->jFloatObj)
+#define JPy_JDoubleObj      (JPy_GetModuleState()->jDoubleObj)
+#define JPy_JObject         (JPy_GetModuleState()->jObject)
+#define JPy_JClass          (JPy_GetModuleState()->jClass)
+#define JPy_JString         (JPy_GetModuleState()->jString)
+#define JPy_JPyObject       (JPy_GetModuleState()->jPyObject)
+#define JPy_JPyModule       (JPy_GetModuleState()->jPyModule)
 
 // java.lang.Comparable
 extern jclass JPy_Comparable_JClass;
@@ -149,33 +234,75 @@ extern jmethodID JPy_Field_GetName_MID;
 extern jmethodID JPy_Field_GetModifiers_MID;
 extern jmethodID JPy_Field_GetType_MID;
 
+// java.lang.System
+extern jclass JPy_System_JClass;
+extern jmethodID JPy_System_IdentityHashCode_MID;
+
 extern jclass JPy_RuntimeException_JClass;
+extern jclass JPy_CompletionStage_JClass;
+
+// java.util.Collection, java.util.List, java.util.Map, java.util.Map.Entry
+extern jclass JPy_Collection_JClass;
+extern jmethodID JPy_Collection_Size_MID;
+extern jmethodID JPy_Collection_Contains_MID;
+extern jmethodID JPy_Collection_ToArray_MID;
+extern jclass JPy_List_JClass;
+extern jmethodID JPy_List_Get_MID;
+extern jmethodID JPy_List_Set_MID;
+extern jmethodID JPy_List_Add_MID;
+extern jmethodID JPy_List_Remove_MID;
+extern jclass JPy_Map_JClass;
+extern jmethodID JPy_Map_Size_MID;
+extern jmethodID JPy_Map_Get_MID;
+extern jmethodID JPy_Map_Put_MID;
+extern jmethodID JPy_Map_Remove_MID;
+extern jmethodID JPy_Map_ContainsKey_MID;
+extern jmethodID JPy_Map_KeySet_MID;
+extern jmethodID JPy_Map_EntrySet_MID;
+extern jclass JPy_MapEntry_JClass;
+extern jmethodID JPy_MapEntry_GetKey_MID;
+extern jmethodID JPy_MapEntry_GetValue_MID;
+// java.util.ArrayList, java.util.Arrays, java.util.HashMap
+extern jclass JPy_ArrayList_JClass;
+extern jmethodID JPy_ArrayList_Init_MID;
+extern jclass JPy_Arrays_JClass;
+extern jmethodID JPy_Arrays_AsList_MID;
+extern jclass JPy_HashMap_JClass;
+extern jmethodID JPy_HashMap_Init_MID;
 
 extern jclass JPy_Boolean_JClass;
-extern jmethodID JPy_Boolean_Init_MID;
+extern jmethodID JPy_Boolean_ValueOf_MID;
+extern jfieldID JPy_Boolean_Value_FID;
 extern jmethodID JPy_Boolean_BooleanValue_MID;
 
 extern jclass JPy_Character_JClass;
-extern jmethodID JPy_Character_Init_MID;
+extern jmethodID JPy_Character_ValueOf_MID;
+extern jfieldID JPy_Character_Value_FID;
 extern jmethodID JPy_Character_CharValue_MID;
 
 extern jclass JPy_Byte_JClass;
-extern jmethodID JPy_Byte_Init_MID;
+extern jmethodID JPy_Byte_ValueOf_MID;
+extern jfieldID JPy_Byte_Value_FID;
 
 extern jclass JPy_Short_JClass;
-extern jmethodID JPy_Short_Init_MID;
+extern jmethodID JPy_Short_ValueOf_MID;
+extern jfieldID JPy_Short_Value_FID;
 
 extern jclass JPy_Integer_JClass;
-extern jmethodID JPy_Integer_Init_MID;
+extern jmethodID JPy_Integer_ValueOf_MID;
+extern jfieldID JPy_Integer_Value_FID;
 
 extern jclass JPy_Long_JClass;
-extern jmethodID JPy_Long_Init_MID;
+extern jmethodID JPy_Long_ValueOf_MID;
+extern jfieldID JPy_Long_Value_FID;
 
 extern jclass JPy_Float_JClass;
-extern jmethodID JPy_Float_Init_MID;
+extern jmethodID JPy_Float_ValueOf_MID;
+extern jfieldID JPy_Float_Value_FID;
 
 extern jclass JPy_Double_JClass;
-extern jmethodID JPy_Double_Init_MID;
+extern jmethodID JPy_Double_ValueOf_MID;
+extern jfieldID JPy_Double_Value_FID;
 
 extern jclass JPy_Number_JClass;
 extern jmethodID JPy_Number_IntValue_MID;
@@ -0,0 +1,225 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import java.lang.invoke.MethodHandles;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.InvocationHandler;
+import java.lang.reflect.InvocationTargetException;
+import java.lang.reflect.Method;
+import java.lang.reflect.Modifier;
+import java.lang.reflect.Proxy;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Iterator;
+import java.util.List;
+
+/**
+ * Implements Java functional interfaces, such as {@code Runnable}, {@code Function} or {@code Comparator},
+ * by Python callables. jpy converts a Python callable passed for a parameter of a functional interface type
+ * into an instance created by {@link #create(Class, long)}.
+ * <p>
+ * The proxy class, the constructor and the abstract method of an interface are looked up once and cached,
+ * so that creating an instance is cheap. Calls of the abstract method directly call the Python callable.
+ *
+ * @since 0.9
+ */
+final class PyCallableAdapter implements InvocationHandler {
+
+    private static final ClassValue<InterfaceInfo> INTERFACE_INFOS = new ClassValue<InterfaceInfo>() {
+        @Override
+        protected InterfaceInfo computeValue(Class<?> type) {
+            return new InterfaceInfo(type);
+        }
+    };
+
+    // Handles the calls of the instance created to look up the proxy class of an interface, which is never used
+    private static final InvocationHandler UNUSED_HANDLER = new InvocationHandler() {
+        @Override
+        public Object invoke(Object proxy, Method method, Object[] args) {
+            throw new UnsupportedOperationException();
+        }
+    };
+
+    private final PyObject callable;
+    private final InterfaceInfo interfaceInfo;
+
+    private PyCallableAdapter(PyObject callable, InterfaceInfo interfaceInfo) {
+        this.callable = callable;
+        this.interfaceInfo = interfaceInfo;
+    }
+
+    /**
+     * Tests whether the given type is a functional interface, i.e. an interface with a single abstract method.
+     * Called by jpy's {@code JType_IsFunctionalInterface()}.
+     *
+     * @param type The type.
+     * @return {@code true}, if the type is a functional interface.
+     */
+    static boolean isFunctionalInterface(Class<?> type) {
+        return type.isInterface() && INTERFACE_INFOS.get(type).method != null;
+    }
+
+    /**
+     * Creates an instance of the given functional interface which calls the given Python callable.
+     * Called by jpy's {@code JType_CreateJavaCallableAdapter()}.
+     *
+     * @param type     The functional interface.
+     * @param callable The Python callable. The new instance takes over the ownership of this (new) reference.
+     * @return The instance of the functional interface.
+     */
+    static Object create(Class<?> type, long callable) throws ReflectiveOperationException {
+        PyObject pyCallable = PyObject.wrap(callable);
+        InterfaceInfo interfaceInfo = INTERFACE_INFOS.get(type);
+        if (interfaceInfo.method == null) {
+            throw new IllegalArgumentException(type.getName() + " is not a functional interface");
+        }
+        try {
+            return interfaceInfo.proxyConstructor.newInstance(new PyCallableAdapter(pyCallable, interfaceInfo));
+        } catch (InvocationTargetException e) {
+            throw new IllegalStateException(e.getCause());
+        }
+    }
+
+    @Override
+    public Object invoke(Object proxy, Method method, Object[] args) throws Throwable {
+        if (method.getDeclaringClass() == Object.class) {
+            switch (method.getName()) {
+                case "equals":
+                    return proxy == args[0];
+                case "hashCode":
+                    return System.identityHashCode(proxy);
+                default:
+                    return interfaceInfo.type.getName() + "(" + callable + ")";
+            }
+        }
+        if (method.isDefault()) {
+            return invokeDefault(proxy, method, args);
+        }
+        // The abstract method, or an inherited one it overrides with narrower types, e.g. Function.apply(Object)
+        // of an interface redeclaring Integer apply(Integer). Both take the types of the most specific method.
+        return PyLib.callCallableAndReturnValue(callable.getPointer(),
+                                                args != null ? args.length : 0,
+                                                args,
+                                                interfaceInfo.parameterTypes,
+                                                interfaceInfo.returnType);
+    }
+
+    private static Object invokeDefault(Object proxy, Method method, Object[] args) throws Throwable {
+        Object[] arguments = args != null ? args : new Object[0];
+        try {
+            // Java 16+
+            Method invokeDefault = InvocationHandler.class.getMethod("invokeDefault", Object.class, Method.class, Object[].class);
+            return invokeDefault.invoke(null, proxy, method, arguments);
+        } catch (NoSuchMethodException e) {
+            // Java 8
+            Class<?> declaringClass = method.getDeclaringClass();
+            Constructor<MethodHandles.Lookup> constructor = MethodHandles.Lookup.class.getDeclaredConstructor(Class.class, int.class);
+            constructor.setAccessible(true);
+            MethodHandles.Lookup lookup = constructor.newInstance(declaringClass, MethodHandles.Lookup.PRIVATE);
+            return lookup.unreflectSpecial(method, declaringClass).bindTo(proxy).invokeWithArguments(arguments);
+        } catch (InvocationTargetException e) {
+            throw e.getCause();
+        }
+    }
+
+    private static final class InterfaceInfo {
+        private final Class<?> type;
+        private final Method method;
+        private final Class<?>[] parameterTypes;
+        private final Class<?> returnType;
+        private final Constructor<?> proxyConstructor;
+
+        InterfaceInfo(Class<?> type) {
+            this.type = type;
+            Method method = type.isInterface() ? findAbstractMethod(type) : null;
+            Constructor<?> proxyConstructor = null;
+            if (method != null) {
+                try {
+                    // Proxy.getProxyClass() is deprecated since Java 9, so the class is taken from a first instance
+                    Object proxy = Proxy.newProxyInstance(type.getClassLoader(), new Class<?>[]{type}, UNUSED_HANDLER);
+                    proxyConstructor = proxy.getClass().getConstructor(InvocationHandler.class);
+                } catch (NoSuchMethodException | IllegalArgumentException e) {
+                    method = null;
+                }
+            }
+            this.method = method;
+            this.parameterTypes = method != null ? method.getParameterTypes() : null;
+            this.returnType = method != null ? method.getReturnType() : null;
+            this.proxyConstructor = proxyConstructor;
+        }
+
+        // Returns the single abstract method of the given interface, or null if there is none or more than one.
+        // Public methods of java.lang.Object redeclared by an interface, e.g. Comparator.equals(), don't count.
+        // Abstract methods overridden by a more specific one, e.g. Function.apply(Object) by a redeclared
+        // Integer apply(Integer), collapse into the most specific method.
+        private static Method findAbstractMethod(Class<?> type) {
+            List<Method> abstractMethods = new ArrayList<>();
+            for (Method method : type.getMethods()) {
+                if (!Modifier.isAbstract(method.getModifiers()) || isObjectMethod(method)) {
+                    continue;
+                }
+                boolean overridden = false;
+                for (Iterator<Method> iterator = abstractMethods.iterator(); iterator.hasNext() && !overridden; ) {
+                    Method abstractMethod = iterator.next();
+                    if (overrides(abstractMethod, method)) {
+                        overridden = true;
+                    } else if (overrides(method, abstractMethod)) {
+                        iterator.remove();
+                    }
+                }
+                if (!overridden) {
+                    abstractMethods.add(method);
+                }
+            }
+            return abstractMethods.size() == 1 ? abstractMethods.get(0) : null;
+        }
+
+        // Tests whether method1 has the signature of method2, or redeclares it in a subinterface with
+        // assignable parameter and return types.
+        private static boolean overrides(Method method1, Method method2) {
+            Class<?>[] parameterTypes1 = method1.getParameterTypes();
+            Class<?>[] parameterTypes2 = method2.getParameterTypes();
+            if (!method1.getName().equals(method2.getName()) || parameterTypes1.length != parameterTypes2.length) {
+                return false;
+            }
+            if (Arrays.equals(parameterTypes1, parameterTypes2)) {
+                return true;
+            }
+            if (method1.getDeclaringClass() == method2.getDeclaringClass()
+                || !method2.getDeclaringClass().isAssignableFrom(method1.getDeclaringClass())
+                || !method2.getReturnType().isAssignableFrom(method1.getReturnType())) {
+                return false;
+            }
+            for (int i = 0; i < parameterTypes1.length; i++) {
+                if (!parameterTypes2[i].isAssignableFrom(parameterTypes1[i])) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        private static boolean isObjectMethod(Method method) {
+            try {
+                Object.class.getMethod(method.getName(), method.getParameterTypes());
+                return true;
+            } catch (NoSuchMethodException e) {
+                return false;
+            }
+        }
+    }
+}
@@ -0,0 +1,407 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import java.util.ArrayList;
+import java.util.Collection;
+import java.util.List;
+import java.util.concurrent.Callable;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.Executor;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.locks.LockSupport;
+
+import static org.jpy.PyLib.assertPythonRuns;
+
+/**
+ * Executes calls into Python on a single thread which owns the Python GIL while it runs a batch of calls.
+ * <p>
+ * If many Java threads call into Python directly, every call has to acquire the GIL and the threads contend
+ * for it. Tasks submitted to a {@code PyExecutor} are put into a lock-free queue instead, which is drained by
+ * the executor's thread. The thread acquires the GIL once and then runs up to {@code maxBatchSize} queued tasks,
+ * so that the Python calls made by these tasks do not compete for the GIL.
+ * <p>
+ * Tasks should be short and must not wait for the completion of other tasks submitted to the same executor.
+ *
+ * @since 0.9
+ */
+public class PyExecutor implements Executor, AutoCloseable {
+
+    /**
+     * The default maximum number of tasks run per GIL acquisition.
+     */
+    public static final int DEFAULT_MAX_BATCH_SIZE = 256;
+
+    // The executor whose thread runs a sub-interpreter, if the current thread is such a thread
+    private static final ThreadLocal<PyExecutor> SUB_INTERPRETER_EXECUTOR = new ThreadLocal<>();
+
+    private final ConcurrentLinkedQueue<Runnable> queue;
+    private final int maxBatchSize;
+    private final Thread thread;
+    private final Runnable batch;
+    private volatile boolean idle;
+    private volatile boolean shutdown;
+    // Only used if the executor's thread runs a sub-interpreter
+    private final CountDownLatch started;
+    private volatile Throwable startError;
+    // The first task of the current batch, only accessed by the executor's thread
+    private Runnable firstTask;
+
+    /**
+     * Creates a new executor with a default thread name and batch size.
+     */
+    public PyExecutor() {
+        this("jpy-executor", DEFAULT_MAX_BATCH_SIZE);
+    }
+
+    /**
+     * Creates a new executor and starts its (daemon) thread.
+     *
+     * @param threadName   The name of the executor's thread.
+     * @param maxBatchSize The maximum number of tasks run per GIL acquisition.
+     */
+    public PyExecutor(String threadName, int maxBatchSize) {
+        this(threadName, maxBatchSize, false, false);
+    }
+
+    /**
+     * Creates a new executor and starts its (daemon) thread. If {@code subInterpreter} is {@code true},
+     * the thread creates a new Python sub-interpreter which executes all tasks and which is destroyed
+     * when the executor terminates. Used by {@link PyInterpreterPool}.
+     *
+     * @param threadName     The name of the executor's thread.
+     * @param maxBatchSize   The maximum number of tasks run per GIL acquisition.
+     * @param subInterpreter If {@code true}, the tasks are executed by a new sub-interpreter.
+     * @param ownGil         If {@code true}, the sub-interpreter has its own GIL (requires Python 3.12+).
+     * @throws RuntimeException if the sub-interpreter could not be created.
+     */
+    PyExecutor(String threadName, int maxBatchSize, final boolean subInterpreter, final boolean ownGil) {
+        if (maxBatchSize <= 0) {
+            throw new IllegalArgumentException("maxBatchSize <= 0");
+        }
+        assertPythonRuns();
+        this.queue = new ConcurrentLinkedQueue<>();
+        this.maxBatchSize = maxBatchSize;
+        this.batch = new Runnable() {
+            @Override
+            public void run() {
+                runBatch();
+            }
+        };
+        this.started = subInterpreter ? new CountDownLatch(1) : null;
+        this.thread = new Thread(new Runnable() {
+            @Override
+            public void run() {
+                if (subInterpreter) {
+                    runSubInterpreter(ownGil);
+                } else {
+                    drain();
+                }
+            }
+        }, threadName);
+        this.thread.setDaemon(true);
+        this.thread.start();
+        if (subInterpreter) {
+            awaitStart();
+        }
+    }
+
+    /**
+     * @return The executor whose thread runs the sub-interpreter of the current thread, or {@code null}
+     * if the current thread is not the thread of an executor created by a {@link PyInterpreterPool}.
+     */
+    static PyExecutor getSubInterpreterExecutor() {
+        return SUB_INTERPRETER_EXECUTOR.get();
+    }
+
+    /**
+     * @return The maximum number of tasks run per GIL acquisition.
+     */
+    public int getMaxBatchSize() {
+        return maxBatchSize;
+    }
+
+    /**
+     * Submits a task which calls into Python.
+     *
+     * @param task The task.
+     * @param <T>  The type of the task's result.
+     * @return A future which is completed with the task's result or exception.
+     * @throws RejectedExecutionException if the executor has been shut down.
+     */
+    public <T> CompletableFuture<T> submit(Callable<T> task) {
+        CompletableFuture<T> future = new CompletableFuture<>();
+        execute(newTask(task, future));
+        return future;
+    }
+
+    /**
+     * Submits a batch of tasks which call into Python. Compared to submitting the tasks one by one,
+     * the executor's thread is woken up at most once.
+     *
+     * @param tasks The tasks.
+     * @param <T>   The type of the tasks' results.
+     * @return The futures of the tasks, in the order of the given tasks. The futures of tasks which were
+     * rejected by a concurrent {@link #shutdown()} are completed with a {@link RejectedExecutionException}.
+     * @throws RejectedExecutionException if the executor has been shut down.
+     */
+    public <T> List<CompletableFuture<T>> submitAll(Collection<? extends Callable<T>> tasks) {
+        checkNotShutdown();
+        List<Task<T>> queuedTasks = new ArrayList<>(tasks.size());
+        List<CompletableFuture<T>> futures = new ArrayList<>(tasks.size());
+        for (Callable<T> task : tasks) {
+            Task<T> queuedTask = newTask(task, new CompletableFuture<T>());
+            queue.offer(queuedTask);
+            queuedTasks.add(queuedTask);
+            futures.add(queuedTask.future);
+        }
+        if (shutdown) {
+            // Shut down concurrently, the executor's thread may have terminated before it saw the tasks
+            for (Task<T> queuedTask : queuedTasks) {
+                if (queue.remove(queuedTask)) {
+                    queuedTask.reject();
+                }
+            }
+        }
+        wakeUp();
+        return futures;
+    }
+
+    /**
+     * Executes the given command on the executor's thread.
+     *
+     * @param command The command.
+     * @throws RejectedExecutionException if the executor has been shut down.
+     */
+    @Override
+    public void execute(Runnable command) {
+        if (command == null) {
+            throw new NullPointerException("command");
+        }
+        checkNotShutdown();
+        queue.offer(command);
+        if (shutdown && queue.remove(command)) {
+            // Shut down concurrently, the executor's thread may have terminated before it saw the command
+            throw newRejectedExecutionException();
+        }
+        wakeUp();
+    }
+
+    /**
+     * Shuts down this executor. Tasks already submitted are still executed, new tasks are rejected.
+     */
+    public void shutdown() {
+        shutdown = true;
+        LockSupport.unpark(thread);
+    }
+
+    /**
+     * @return {@code true} if this executor has been shut down.
+     */
+    public boolean isShutdown() {
+        return shutdown;
+    }
+
+    /**
+     * Waits until all tasks have been executed after a shutdown.
+     *
+     * @param timeout The maximum time to wait.
+     * @param unit    The unit of {@code timeout}.
+     * @return {@code true} if the executor's thread terminated, {@code false} if the timeout elapsed before.
+     * @throws InterruptedException if interrupted while waiting.
+     */
+    public boolean awaitTermination(long timeout, TimeUnit unit) throws InterruptedException {
+        thread.join(Math.max(1, unit.toMillis(timeout)));
+        return !thread.isAlive();
+    }
+
+    /**
+     * Shuts down this executor and waits until all submitted tasks have been executed.
+     */
+    @Override
+    public void close() throws InterruptedException {
+        shutdown();
+        thread.join();
+    }
+
+    /**
+     * Decrements the reference count of a Python object of this executor's sub-interpreter on the executor's thread.
+     * If the executor has been shut down, the object is released together with the sub-interpreter.
+     *
+     * @param pointer The Python object.
+     * @param count   The number of references to release.
+     */
+    void decRef(final long pointer, final int count) {
+        if (!shutdown) {
+            Runnable command = new Runnable() {
+                @Override
+                public void run() {
+                    PyLib.decRef(pointer, count);
+                }
+            };
+            queue.offer(command);
+            if (shutdown && queue.remove(command)) {
+                return;
+            }
+            wakeUp();
+        }
+    }
+
+    private static <T> Task<T> newTask(Callable<T> task, CompletableFuture<T> future) {
+        return new Task<>(task, future);
+    }
+
+    private static RejectedExecutionException newRejectedExecutionException() {
+        return new RejectedExecutionException("PyExecutor has been shut down");
+    }
+
+    private void checkNotShutdown() {
+        if (shutdown) {
+            throw newRejectedExecutionException();
+        }
+    }
+
+    private void wakeUp() {
+        // The queue is modified before idle is read, and the executor's thread sets idle before it
+        // checks the queue a last time, so either the thread sees the new task or we see it idle.
+        if (idle) {
+            LockSupport.unpark(thread);
+        }
+    }
+
+    private void runSubInterpreter(boolean ownGil) {
+        try {
+            PyLib.runInSubInterpreter(new Runnable() {
+                @Override
+                public void run() {
+                    SUB_INTERPRETER_EXECUTOR.set(PyExecutor.this);
+                    started.countDown();
+                    try {
+                        drain();
+                    } finally {
+                        SUB_INTERPRETER_EXECUTOR.remove();
+                    }
+                }
+            }, ownGil);
+        } catch (Throwable t) {
+            startError = t;
+            shutdown = true;
+        } finally {
+            started.countDown();
+        }
+    }
+
+    private void awaitStart() {
+        boolean interrupted = false;
+        while (true) {
+            try {
+                started.await();
+                break;
+            } catch (InterruptedException e) {
+                interrupted = true;
+            }
+        }
+        if (interrupted) {
+            Thread.currentThread().interrupt();
+        }
+        if (startError != null) {
+            throw new RuntimeException("Failed to create Python sub-interpreter", startError);
+        }
+    }
+
+    private void drain() {
+        try {
+            while (true) {
+                // Read before polling: submitters check shutdown after they queued a task, so a task
+                // queued after the last poll is always removed again by its submitter.
+                boolean terminating = shutdown;
+                Runnable task = queue.poll();
+                if (task != null) {
+                    firstTask = task;
+                    PyLib.runWithGil(batch);
+                    firstTask = null;
+                } else if (terminating) {
+                    break;
+                } else {
+                    idle = true;
+                    if (queue.isEmpty() && !shutdown) {
+                        LockSupport.park(this);
+                    }
+                    idle = false;
+                }
+            }
+        } finally {
+            shutdown = true;
+            rejectQueuedTasks();
+        }
+    }
+
+    private void rejectQueuedTasks() {
+        // Only finds tasks if drain() terminated abnormally
+        Runnable task;
+        while ((task = queue.poll()) != null) {
+            if (task instanceof Task) {
+                ((Task<?>) task).reject();
+            }
+        }
+    }
+
+    private void runBatch() {
+        Runnable task = firstTask;
+        for (int i = 0; task != null; i++) {
+            runTask(task);
+            task = i + 1 < maxBatchSize ? queue.poll() : null;
+        }
+    }
+
+    private void runTask(Runnable task) {
+        try {
+            task.run();
+        } catch (Throwable t) {
+            Thread.UncaughtExceptionHandler handler = thread.getUncaughtExceptionHandler();
+            if (handler != null) {
+                handler.uncaughtException(thread, t);
+            }
+        }
+    }
+
+    private static final class Task<T> implements Runnable {
+        private final Callable<T> callable;
+        private final CompletableFuture<T> future;
+
+        Task(Callable<T> callable, CompletableFuture<T> future) {
+            this.callable = callable;
+            this.future = future;
+        }
+
+        @Override
+        public void run() {
+            try {
+                future.complete(callable.call());
+            } catch (Throwable t) {
+                future.completeExceptionally(t);
+            }
+        }
+
+        void reject() {
+            future.completeExceptionally(newRejectedExecutionException());
+        }
+    }
+}
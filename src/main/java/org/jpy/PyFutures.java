@@ -0,0 +1,91 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CompletionException;
+import java.util.concurrent.CompletionStage;
+
+/**
+ * Connects Java futures with Python's asyncio and {@code concurrent.futures}.
+ * <p>
+ * This class is used by the Python {@code jpy} module in order to make wrapped {@code CompletionStage}s awaitable
+ * and to convert Python coroutines and futures into {@code CompletableFuture}s. The Python callbacks passed
+ * to the methods of this class are called from the thread that completes the Java future.
+ *
+ * @since 0.9
+ */
+public final class PyFutures {
+
+    /**
+     * Calls the Python callable {@code callback} with the value and the error (or {@code None})
+     * of the given {@code stage} once it is completed.
+     *
+     * @param stage    The completion stage.
+     * @param callback A Python callable accepting two arguments.
+     */
+    public static void whenComplete(CompletionStage<?> stage, final PyObject callback) {
+        stage.whenComplete((value, error) -> {
+            if (error instanceof CompletionException && error.getCause() != null) {
+                error = error.getCause();
+            }
+            callback.call("__call__", value, error);
+        });
+    }
+
+    /**
+     * Cancels the given {@code stage}, if it supports conversion into a {@code CompletableFuture}.
+     *
+     * @param stage The completion stage.
+     */
+    public static void cancel(CompletionStage<?> stage) {
+        try {
+            stage.toCompletableFuture().cancel(false);
+        } catch (UnsupportedOperationException e) {
+            // Can't cancel, the stage will be completed anyway
+        }
+    }
+
+    /**
+     * Creates a new future which calls the Python callable {@code cancelCallback} without arguments if it is cancelled.
+     *
+     * @param cancelCallback A Python callable which cancels the Python future that completes the new future.
+     * @return A new future.
+     */
+    public static CompletableFuture<Object> newFuture(final PyObject cancelCallback) {
+        final CompletableFuture<Object> future = new CompletableFuture<>();
+        future.whenComplete((value, error) -> {
+            if (future.isCancelled()) {
+                cancelCallback.call("__call__");
+            }
+        });
+        return future;
+    }
+
+    /**
+     * Completes the given {@code future} with a {@code RuntimeException} caused by a Python exception.
+     *
+     * @param future  The future.
+     * @param message The Python exception's message.
+     */
+    public static void fail(CompletableFuture<Object> future, String message) {
+        future.completeExceptionally(new RuntimeException(message));
+    }
+
+    private PyFutures() {
+    }
+}
@@ -0,0 +1,238 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.Callable;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+
+import static org.jpy.PyLib.assertPythonRuns;
+
+/**
+ * A pool of Python sub-interpreters which execute calls into Python in parallel.
+ * <p>
+ * All Java threads calling into the main Python interpreter compete for its GIL, so CPU-bound Python code
+ * uses a single core only. Since Python 3.12, sub-interpreters can have their own GIL (PEP 684).
+ * A pool creates a number of such sub-interpreters, each of which is run by the thread of a {@link PyExecutor}.
+ * Every Java thread submitting tasks is pinned to one of the sub-interpreters, which are assigned round-robin
+ * on a thread's first submission. So the modules imported and the global variables set by the tasks of a thread
+ * are visible to its later tasks.
+ * <p>
+ * Sub-interpreters are isolated from each other and from the main interpreter: {@link PyObject}s created by a task
+ * must only be used by tasks running in the same sub-interpreter. Extension modules imported by the tasks
+ * must support sub-interpreters with their own GIL. Each sub-interpreter has its own 'jpy' module and
+ * uses the 'sys.path' of the main interpreter, which must be running, see {@link PyLib#startPython(String...)}.
+ *
+ * @since 0.9
+ */
+public class PyInterpreterPool implements AutoCloseable {
+
+    private final PyExecutor[] executors;
+    private final AtomicInteger nextIndex;
+    private final ThreadLocal<PyExecutor> pinnedExecutor;
+
+    /**
+     * Creates a new pool of sub-interpreters with their own GIL (requires Python 3.12+).
+     *
+     * @param size The number of sub-interpreters.
+     * @throws RuntimeException if the sub-interpreters could not be created.
+     */
+    public PyInterpreterPool(int size) {
+        this(size, true, PyExecutor.DEFAULT_MAX_BATCH_SIZE);
+    }
+
+    /**
+     * Creates a new pool of sub-interpreters.
+     *
+     * @param size         The number of sub-interpreters.
+     * @param ownGil       If {@code true}, each sub-interpreter has its own GIL (requires Python 3.12+),
+     *                     otherwise all sub-interpreters share the GIL of the main interpreter.
+     * @param maxBatchSize The maximum number of tasks run per GIL acquisition.
+     * @throws RuntimeException if the sub-interpreters could not be created.
+     */
+    public PyInterpreterPool(int size, boolean ownGil, int maxBatchSize) {
+        if (size <= 0) {
+            throw new IllegalArgumentException("size <= 0");
+        }
+        if (maxBatchSize <= 0) {
+            throw new IllegalArgumentException("maxBatchSize <= 0");
+        }
+        assertPythonRuns();
+        this.executors = new PyExecutor[size];
+        this.nextIndex = new AtomicInteger();
+        this.pinnedExecutor = new ThreadLocal<PyExecutor>() {
+            @Override
+            protected PyExecutor initialValue() {
+                PyExecutor executor = getOwnExecutor();
+                if (executor != null) {
+                    return executor;
+                }
+                return executors[(nextIndex.getAndIncrement() & Integer.MAX_VALUE) % executors.length];
+            }
+        };
+        try {
+            for (int i = 0; i < size; i++) {
+                executors[i] = new PyExecutor("jpy-interpreter-" + i, maxBatchSize, true, ownGil);
+            }
+        } catch (RuntimeException e) {
+            shutdown();
+            throw e;
+        }
+    }
+
+    /**
+     * @return The number of sub-interpreters.
+     */
+    public int getSize() {
+        return executors.length;
+    }
+
+    /**
+     * @return The index of the sub-interpreter the current thread is pinned to.
+     */
+    public int getInterpreterIndex() {
+        PyExecutor executor = pinnedExecutor.get();
+        for (int i = 0; i < executors.length; i++) {
+            if (executors[i] == executor) {
+                return i;
+            }
+        }
+        throw new IllegalStateException();
+    }
+
+    /**
+     * Submits a task to the sub-interpreter the current thread is pinned to.
+     *
+     * @param task The task.
+     * @param <T>  The type of the task's result.
+     * @return A future which is completed with the task's result or exception.
+     * @throws java.util.concurrent.RejectedExecutionException if the pool has been shut down.
+     */
+    public <T> CompletableFuture<T> submit(Callable<T> task) {
+        return pinnedExecutor.get().submit(task);
+    }
+
+    /**
+     * Calls a task in the sub-interpreter the current thread is pinned to and waits for its result.
+     * If called by a task of this pool, the given task is called directly.
+     *
+     * @param task The task.
+     * @param <T>  The type of the task's result.
+     * @return The task's result.
+     * @throws Exception if the task failed.
+     */
+    public <T> T call(Callable<T> task) throws Exception {
+        if (getOwnExecutor() != null) {
+            return task.call();
+        }
+        try {
+            return submit(task).get();
+        } catch (ExecutionException e) {
+            Throwable cause = e.getCause();
+            if (cause instanceof Exception) {
+                throw (Exception) cause;
+            }
+            if (cause instanceof Error) {
+                throw (Error) cause;
+            }
+            throw e;
+        }
+    }
+
+    /**
+     * Submits a task to every sub-interpreter, e.g. in order to import modules or to initialise global variables.
+     *
+     * @param task The task.
+     * @param <T>  The type of the task's result.
+     * @return The futures of the task, in the order of the sub-interpreters.
+     * @throws java.util.concurrent.RejectedExecutionException if the pool has been shut down.
+     */
+    public <T> List<CompletableFuture<T>> submitToAll(Callable<T> task) {
+        List<CompletableFuture<T>> futures = new ArrayList<>(executors.length);
+        for (PyExecutor executor : executors) {
+            futures.add(executor.submit(task));
+        }
+        return futures;
+    }
+
+    /**
+     * Shuts down this pool. Tasks already submitted are still executed, new tasks are rejected.
+     * The sub-interpreters are destroyed after their last task.
+     */
+    public void shutdown() {
+        for (PyExecutor executor : executors) {
+            if (executor != null) {
+                executor.shutdown();
+            }
+        }
+    }
+
+    /**
+     * @return {@code true} if this pool has been shut down.
+     */
+    public boolean isShutdown() {
+        return executors[0] == null || executors[0].isShutdown();
+    }
+
+    /**
+     * Waits until all sub-interpreters have been destroyed after a shutdown.
+     *
+     * @param timeout The maximum time to wait.
+     * @param unit    The unit of {@code timeout}.
+     * @return {@code true} if all sub-interpreters have been destroyed, {@code false} if the timeout elapsed before.
+     * @throws InterruptedException if interrupted while waiting.
+     */
+    public boolean awaitTermination(long timeout, TimeUnit unit) throws InterruptedException {
+        long deadline = System.nanoTime() + unit.toNanos(timeout);
+        for (PyExecutor executor : executors) {
+            long remaining = deadline - System.nanoTime();
+            if (executor != null && !executor.awaitTermination(Math.max(0, remaining), TimeUnit.NANOSECONDS)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Shuts down this pool and waits until all sub-interpreters have been destroyed.
+     */
+    @Override
+    public void close() throws InterruptedException {
+        shutdown();
+        for (PyExecutor executor : executors) {
+            if (executor != null) {
+                executor.close();
+            }
+        }
+    }
+
+    private PyExecutor getOwnExecutor() {
+        PyExecutor executor = PyExecutor.getSubInterpreterExecutor();
+        if (executor != null) {
+            for (PyExecutor ownExecutor : executors) {
+                if (ownExecutor == executor) {
+                    return executor;
+                }
+            }
+        }
+        return null;
+    }
+}
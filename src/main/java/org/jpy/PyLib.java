@@ -18,6 +18,7 @@ package org.jpy;
 
 import java.io.File;
 import java.util.ArrayList;
+import java.util.List;
 import java.util.Map;
 
 import static org.jpy.PyLibConfig.JPY_LIB_KEY;
@@ -220,7 +221,7 @@ public class PyLib {
 
     static native void incRef(long pointer);
 
-    static native void decRef(long pointer);
+    static native void decRef(long pointer, int count);
 
     static native int getIntValue(long pointer);
 
@@ -232,6 +233,25 @@ public class PyLib {
 
     static native <T> T[] getObjectArrayValue(long pointer, Class<? extends T> itemType);
 
+    /**
+     * Converts the items of a Python sequence or iterable into a new {@code java.util.ArrayList} in a single call.
+     *
+     * @param pointer  Identifies the Python sequence or iterable.
+     * @param itemType The item type, {@code null} for {@code Object}.
+     * @return The new list.
+     */
+    static native <T> List<T> getListValue(long pointer, Class<? extends T> itemType);
+
+    /**
+     * Converts the entries of a Python mapping into a new {@code java.util.HashMap} in a single call.
+     *
+     * @param pointer   Identifies the Python mapping.
+     * @param keyType   The key type, {@code null} for {@code Object}.
+     * @param valueType The value type, {@code null} for {@code Object}.
+     * @return The new map.
+     */
+    static native <K, V> Map<K, V> getMapValue(long pointer, Class<? extends K> keyType, Class<? extends V> valueType);
+
     static native long importModule(String name);
 
     /**
@@ -319,6 +339,48 @@ public class PyLib {
                                            Class<?>[] paramTypes,
                                            Class<T> returnType);
 
+    /**
+     * Calls a Python callable object, such as a bound method, and returns a Java Object.
+     * Arguments and return value are converted as by {@link #callAndReturnValue}, but the callable is not
+     * looked up by name. Used by {@link PyProxyHandler}, which looks up the callable once per interface method.
+     *
+     * @param callable   Identifies the Python callable object.
+     * @param argCount   The argument count (length of the following {@code args} array).
+     * @param args       The arguments.
+     * @param paramTypes Optional array of parameter types for the conversion of the {@code args} into a Python tuple.
+     *                   If not null, it must be an array of the same length as {@code args}.
+     * @param returnType Optional return type.
+     * @return The converted return value.
+     * @since 0.9
+     */
+    static native <T> T callCallableAndReturnValue(long callable,
+                                                   int argCount,
+                                                   Object[] args,
+                                                   Class<?>[] paramTypes,
+                                                   Class<T> returnType);
+
+    /**
+     * Runs the given {@code runnable} in the current thread while holding the Python GIL.
+     * All calls into Python made by the {@code runnable} will then not compete for the GIL.
+     * Used by {@link PyExecutor} to execute a batch of calls per GIL acquisition.
+     *
+     * @param runnable The runnable.
+     * @since 0.9
+     */
+    static native void runWithGil(Runnable runnable);
+
+    /**
+     * Creates a new Python sub-interpreter, imports the 'jpy' module into it and runs the given {@code runnable}
+     * in the current thread. All calls into Python made by the current thread while the {@code runnable} runs
+     * are executed by the sub-interpreter. The sub-interpreter is destroyed when the {@code runnable} returns.
+     * Used by {@link PyInterpreterPool}.
+     *
+     * @param runnable The runnable.
+     * @param ownGil   If {@code true}, the sub-interpreter has its own GIL (requires Python 3.12+).
+     * @since 0.9
+     */
+    static native void runInSubInterpreter(Runnable runnable, boolean ownGil);
+
     private static void loadLib() {
         if (dllLoaded || dllProblem != null) {
             return;
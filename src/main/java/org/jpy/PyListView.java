@@ -0,0 +1,139 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import java.util.AbstractList;
+import java.util.RandomAccess;
+
+import static org.jpy.PyLib.assertPythonRuns;
+
+/**
+ * A live {@code java.util.List} view of a Python sequence, such as a {@code list} or {@code tuple}.
+ * <p>
+ * The items are not copied. Every operation is delegated to the Python object, e.g. {@code get(i)} calls
+ * {@code seq[i]} and converts the item into the view's item type. Modifications of the view modify the Python
+ * sequence and vice versa. Like all Python errors, an {@code IndexError} for an index beyond the end and the
+ * errors of modifying an immutable sequence are thrown as {@code RuntimeException}.
+ * <p>
+ * jpy passes a Python {@code list} or {@code tuple} given for a parameter of type {@code java.util.List},
+ * {@code java.util.Collection}, {@code java.lang.Iterable} or {@code java.lang.Object} as a view with item type
+ * {@code Object}.
+ *
+ * @param <E> The item type.
+ * @see PyObject#asList(Class)
+ * @since 0.9
+ */
+public final class PyListView<E> extends AbstractList<E> implements RandomAccess {
+
+    private static final Class<?>[] INDEX_TYPES = {Integer.class};
+    private static final Class<?>[] INDEX_ITEM_TYPES = {Integer.class, null};
+
+    private final PyObject sequence;
+    private final Class<E> itemType;
+
+    /**
+     * Creates a view of the given Python sequence.
+     *
+     * @param sequence The Python sequence.
+     * @param itemType The item type. Items are converted into this type when they are read.
+     *                 Use {@code PyObject.class} to get the Python items as they are.
+     */
+    public PyListView(PyObject sequence, Class<E> itemType) {
+        if (sequence == null) {
+            throw new NullPointerException("sequence must not be null");
+        }
+        if (itemType == null) {
+            throw new NullPointerException("itemType must not be null");
+        }
+        this.sequence = sequence;
+        this.itemType = itemType;
+    }
+
+    /**
+     * Creates a view with item type {@code Object}.
+     * Called by jpy's {@code JType_CreateJavaView()}.
+     *
+     * @param pointer The Python sequence. The view takes over the ownership of this (new) reference.
+     * @return The view.
+     */
+    static PyListView<Object> wrap(long pointer) {
+        return new PyListView<>(PyObject.wrap(pointer), Object.class);
+    }
+
+    /**
+     * @return The Python sequence.
+     */
+    public PyObject getPyObject() {
+        return sequence;
+    }
+
+    @Override
+    public int size() {
+        assertPythonRuns();
+        return PyLib.callAndReturnValue(sequence.getPointer(), true, "__len__", 0, null, null, Integer.class);
+    }
+
+    @Override
+    public E get(int index) {
+        checkIndex(index);
+        assertPythonRuns();
+        return PyLib.callAndReturnValue(sequence.getPointer(), true, "__getitem__", 1, new Object[]{index}, INDEX_TYPES, itemType);
+    }
+
+    @Override
+    public E set(int index, E item) {
+        E oldItem = get(index);
+        call("__setitem__", index, item);
+        return oldItem;
+    }
+
+    @Override
+    public void add(int index, E item) {
+        checkIndex(index);
+        assertPythonRuns();
+        call("insert", index, item);
+        modCount++;
+    }
+
+    @Override
+    public E remove(int index) {
+        checkIndex(index);
+        assertPythonRuns();
+        E oldItem = PyLib.callAndReturnValue(sequence.getPointer(), true, "pop", 1, new Object[]{index}, INDEX_TYPES, itemType);
+        modCount++;
+        return oldItem;
+    }
+
+    @Override
+    public void clear() {
+        assertPythonRuns();
+        PyLib.decRef(PyLib.callAndReturnObject(sequence.getPointer(), true, "clear", 0, null, null), 1);
+        modCount++;
+    }
+
+    private void call(String name, int index, E item) {
+        long result = PyLib.callAndReturnObject(sequence.getPointer(), true, name, 2, new Object[]{index, item}, INDEX_ITEM_TYPES);
+        PyLib.decRef(result, 1);
+    }
+
+    // Python accepts negative indexes, Java doesn't
+    private static void checkIndex(int index) {
+        if (index < 0) {
+            throw new IndexOutOfBoundsException("Index: " + index);
+        }
+    }
+}
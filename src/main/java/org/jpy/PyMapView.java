@@ -0,0 +1,233 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import java.util.AbstractMap;
+import java.util.AbstractSet;
+import java.util.Iterator;
+import java.util.Map;
+import java.util.NoSuchElementException;
+import java.util.Objects;
+import java.util.Set;
+
+import static org.jpy.PyLib.assertPythonRuns;
+
+/**
+ * A live {@code java.util.Map} view of a Python mapping, such as a {@code dict}.
+ * <p>
+ * The entries are not copied. Every operation is delegated to the Python object, e.g. {@code get(key)} calls
+ * {@code mapping.get(key)} and converts the value into the view's value type. Modifications of the view modify the
+ * Python mapping and vice versa. Iterating the view fetches a snapshot of the keys in a single call, the values
+ * are looked up when an entry's value is read.
+ * <p>
+ * jpy passes a Python {@code dict} given for a parameter of type {@code java.util.Map} or {@code java.lang.Object}
+ * as a view with key and value type {@code Object}.
+ *
+ * @param <K> The key type.
+ * @param <V> The value type.
+ * @see PyObject#asMap(Class, Class)
+ * @since 0.9
+ */
+public final class PyMapView<K, V> extends AbstractMap<K, V> {
+
+    private static final Class<?>[] KEY_VALUE_TYPES = {null, null};
+
+    private final PyObject mapping;
+    private final Class<K> keyType;
+    private final Class<V> valueType;
+    private Set<Map.Entry<K, V>> entrySet;
+
+    /**
+     * Creates a view of the given Python mapping.
+     *
+     * @param mapping   The Python mapping.
+     * @param keyType   The key type. Keys are converted into this type when the view is iterated.
+     * @param valueType The value type. Values are converted into this type when they are read.
+     *                  Use {@code PyObject.class} to get the Python values as they are.
+     */
+    public PyMapView(PyObject mapping, Class<K> keyType, Class<V> valueType) {
+        if (mapping == null) {
+            throw new NullPointerException("mapping must not be null");
+        }
+        if (keyType == null) {
+            throw new NullPointerException("keyType must not be null");
+        }
+        if (valueType == null) {
+            throw new NullPointerException("valueType must not be null");
+        }
+        this.mapping = mapping;
+        this.keyType = keyType;
+        this.valueType = valueType;
+    }
+
+    /**
+     * Creates a view with key and value type {@code Object}.
+     * Called by jpy's {@code JType_CreateJavaView()}.
+     *
+     * @param pointer The Python mapping. The view takes over the ownership of this (new) reference.
+     * @return The view.
+     */
+    static PyMapView<Object, Object> wrap(long pointer) {
+        return new PyMapView<>(PyObject.wrap(pointer), Object.class, Object.class);
+    }
+
+    /**
+     * @return The Python mapping.
+     */
+    public PyObject getPyObject() {
+        return mapping;
+    }
+
+    @Override
+    public int size() {
+        assertPythonRuns();
+        return PyLib.callAndReturnValue(mapping.getPointer(), true, "__len__", 0, null, null, Integer.class);
+    }
+
+    @Override
+    public boolean containsKey(Object key) {
+        assertPythonRuns();
+        return PyLib.callAndReturnValue(mapping.getPointer(), true, "__contains__", 1, new Object[]{key}, null, Boolean.class);
+    }
+
+    @Override
+    public V get(Object key) {
+        assertPythonRuns();
+        return PyLib.callAndReturnValue(mapping.getPointer(), true, "get", 1, new Object[]{key}, null, valueType);
+    }
+
+    @Override
+    public V put(K key, V value) {
+        V oldValue = get(key);
+        long result = PyLib.callAndReturnObject(mapping.getPointer(), true, "__setitem__", 2, new Object[]{key, value}, KEY_VALUE_TYPES);
+        PyLib.decRef(result, 1);
+        return oldValue;
+    }
+
+    @Override
+    public V remove(Object key) {
+        assertPythonRuns();
+        return PyLib.callAndReturnValue(mapping.getPointer(), true, "pop", 2, new Object[]{key, null}, KEY_VALUE_TYPES, valueType);
+    }
+
+    @Override
+    public void clear() {
+        assertPythonRuns();
+        PyLib.decRef(PyLib.callAndReturnObject(mapping.getPointer(), true, "clear", 0, null, null), 1);
+    }
+
+    @Override
+    public Set<Map.Entry<K, V>> entrySet() {
+        if (entrySet == null) {
+            entrySet = new EntrySet();
+        }
+        return entrySet;
+    }
+
+    private K[] getKeys() {
+        assertPythonRuns();
+        PyObject keys = PyModule.getBuiltins().call("list", mapping);
+        return keys.getObjectArrayValue(keyType);
+    }
+
+    private final class EntrySet extends AbstractSet<Map.Entry<K, V>> {
+
+        @Override
+        public int size() {
+            return PyMapView.this.size();
+        }
+
+        @Override
+        public void clear() {
+            PyMapView.this.clear();
+        }
+
+        @Override
+        public Iterator<Map.Entry<K, V>> iterator() {
+            final K[] keys = getKeys();
+            return new Iterator<Map.Entry<K, V>>() {
+                private int index;
+                private boolean removable;
+
+                @Override
+                public boolean hasNext() {
+                    return index < keys.length;
+                }
+
+                @Override
+                public Map.Entry<K, V> next() {
+                    if (index >= keys.length) {
+                        throw new NoSuchElementException();
+                    }
+                    removable = true;
+                    return new Entry(keys[index++]);
+                }
+
+                @Override
+                public void remove() {
+                    if (!removable) {
+                        throw new IllegalStateException();
+                    }
+                    removable = false;
+                    PyMapView.this.remove(keys[index - 1]);
+                }
+            };
+        }
+    }
+
+    private final class Entry implements Map.Entry<K, V> {
+        private final K key;
+
+        Entry(K key) {
+            this.key = key;
+        }
+
+        @Override
+        public K getKey() {
+            return key;
+        }
+
+        @Override
+        public V getValue() {
+            return get(key);
+        }
+
+        @Override
+        public V setValue(V value) {
+            return put(key, value);
+        }
+
+        @Override
+        public boolean equals(Object o) {
+            if (!(o instanceof Map.Entry)) {
+                return false;
+            }
+            Map.Entry<?, ?> entry = (Map.Entry<?, ?>) o;
+            return Objects.equals(key, entry.getKey()) && Objects.equals(getValue(), entry.getValue());
+        }
+
+        @Override
+        public int hashCode() {
+            return Objects.hashCode(key) ^ Objects.hashCode(getValue());
+        }
+
+        @Override
+        public String toString() {
+            return key + "=" + getValue();
+        }
+    }
+}
@@ -90,7 +90,7 @@ public class PyModule extends PyObject {
     public static PyModule importModule(String name) {
         assertPythonRuns();
         long pointer = PyLib.importModule(name);
-        return pointer != 0 ? new PyModule(name, pointer) : null;
+        return wrap(pointer, PyModule.class, module -> module.name.equals(name), p -> new PyModule(name, p));
     }
 
     /**
@@ -116,6 +116,10 @@ public class PyModule extends PyObject {
     /**
      * Create a Java proxy instance of this Python module which contains compatible functions to the ones provided in the
      * interface given by the {@code type} parameter.
+     * <p>
+     * The Python function called by an interface method is looked up once, on the method's first invocation.
+     * Later rebinding of the module's attribute, or a different answer of a dynamic {@code __getattr__()},
+     * doesn't affect the proxy.
      *
      * @param type The interface's type.
      * @param <T>  The interface name.
@@ -16,9 +16,17 @@
 
 package org.jpy;
 
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.WeakReference;
 import java.lang.reflect.InvocationHandler;
 import java.lang.reflect.Proxy;
+import java.util.List;
 import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicIntegerFieldUpdater;
+import java.util.function.LongFunction;
+import java.util.function.Predicate;
 
 import static org.jpy.PyLib.assertPythonRuns;
 
@@ -30,17 +38,107 @@ import static org.jpy.PyLib.assertPythonRuns;
  */
 public class PyObject {
 
+    /**
+     * The maximum number of references an instance adopts, see {@link #wrap(long)}.
+     */
+    private static final int MAX_ADOPTED_REFERENCES = 1 << 16;
+
+    /**
+     * The live instances by pointer, so that native calls returning the same Python object return the same instance.
+     */
+    private static final ConcurrentHashMap<Long, CacheEntry> CACHE = new ConcurrentHashMap<>();
+    private static final ReferenceQueue<PyObject> CACHE_QUEUE = new ReferenceQueue<>();
+
+    private static final AtomicIntegerFieldUpdater<PyObject> REFERENCE_COUNT =
+            AtomicIntegerFieldUpdater.newUpdater(PyObject.class, "referenceCount");
+
     /**
      * The value of the Python/C API {@code PyObject*} which this class represents.
      */
     private final long pointer;
 
+    /**
+     * The executor running the sub-interpreter which owns the Python object, or {@code null} for the main interpreter.
+     */
+    private final PyExecutor subInterpreterExecutor;
+
+    /**
+     * The number of references to the Python object owned by this instance, released by {@link #finalize()}.
+     */
+    private volatile int referenceCount;
+
+    /**
+     * Creates a new instance which takes over the ownership of a (new) reference to the given Python object.
+     *
+     * @param pointer The Python object.
+     */
     PyObject(long pointer) {
         if (pointer == 0) {
             throw new IllegalArgumentException("pointer == 0");
         }
-        PyLib.incRef(pointer);
         this.pointer = pointer;
+        this.subInterpreterExecutor = PyExecutor.getSubInterpreterExecutor();
+        this.referenceCount = 1;
+    }
+
+    /**
+     * Returns an instance for the new reference to a Python object returned by a native call.
+     * If there is a live instance for the same Python object, it adopts the reference and is returned.
+     *
+     * @param pointer The Python object, or 0.
+     * @return The instance, or {@code null} if {@code pointer} is 0.
+     */
+    static PyObject wrap(long pointer) {
+        return wrap(pointer, PyObject.class, pyObject -> true, PyObject::new);
+    }
+
+    /**
+     * Returns an instance of the given type for the new reference to a Python object returned by a native call.
+     *
+     * @param pointer  The Python object, or 0.
+     * @param type     The type of the instance.
+     * @param reusable Tests whether a live instance of the given type can be returned.
+     * @param factory  Creates a new instance of the given type, if there is no reusable one.
+     * @param <T>      The type of the instance.
+     * @return The instance, or {@code null} if {@code pointer} is 0.
+     */
+    static <T extends PyObject> T wrap(long pointer, Class<T> type, Predicate<? super T> reusable, LongFunction<T> factory) {
+        if (pointer == 0) {
+            return null;
+        }
+        expungeStaleEntries();
+        Long key = pointer;
+        CacheEntry entry = CACHE.get(key);
+        PyObject cached = entry != null ? entry.get() : null;
+        if (type.isInstance(cached) && reusable.test(type.cast(cached)) && cached.adoptReference()) {
+            return type.cast(cached);
+        }
+        T pyObject = factory.apply(pointer);
+        CACHE.put(key, new CacheEntry(key, pyObject));
+        return pyObject;
+    }
+
+    private static void expungeStaleEntries() {
+        Reference<? extends PyObject> reference;
+        while ((reference = CACHE_QUEUE.poll()) != null) {
+            CacheEntry entry = (CacheEntry) reference;
+            CACHE.remove(entry.key, entry);
+        }
+    }
+
+    /**
+     * Takes over the ownership of another reference to the Python object, unless this instance already owns too many.
+     * In that case, a new instance is created for the reference.
+     */
+    private boolean adoptReference() {
+        int count;
+        do {
+            count = referenceCount;
+            if (count >= MAX_ADOPTED_REFERENCES) {
+                return false;
+            }
+        } while (!REFERENCE_COUNT.compareAndSet(this, count, count + 1));
+        return true;
     }
 
     /**
@@ -73,11 +171,12 @@ public class PyObject {
         if (mode == null) {
             throw new NullPointerException("mode must not be null");
         }
-        return new PyObject(PyLib.executeCode(code, mode.value(), globals, locals));
+        return wrap(PyLib.executeCode(code, mode.value(), globals, locals));
     }
 
     /**
-     * Decrements the reference count of the Python object which this class represents.
+     * Decrements the reference count of the Python object which this class represents by the number of references
+     * this instance owns.
      *
      * @throws Throwable If any error occurs.
      */
@@ -88,7 +187,12 @@ public class PyObject {
         if (pointer == 0) {
             throw new IllegalStateException("pointer == 0");
         }
-        PyLib.decRef(getPointer());
+        if (subInterpreterExecutor != null) {
+            // The finalizer thread is not pinned to the sub-interpreter
+            subInterpreterExecutor.decRef(getPointer(), referenceCount);
+        } else {
+            PyLib.decRef(getPointer(), referenceCount);
+        }
     }
 
     /**
@@ -152,6 +256,88 @@ public class PyObject {
         return PyLib.getObjectArrayValue(getPointer(), itemType);
     }
 
+    /**
+     * Gets a live {@code List} view of this Python sequence. The items are not copied.
+     *
+     * @param itemType The item type class.
+     * @param <E>      The item type name.
+     * @return A view of this Python sequence.
+     * @see PyListView
+     * @since 0.9
+     */
+    public <E> List<E> asList(Class<E> itemType) {
+        return new PyListView<>(this, itemType);
+    }
+
+    /**
+     * Gets a live {@code Map} view of this Python mapping. The entries are not copied.
+     *
+     * @param keyType   The key type class.
+     * @param valueType The value type class.
+     * @param <K>       The key type name.
+     * @param <V>       The value type name.
+     * @return A view of this Python mapping.
+     * @see PyMapView
+     * @since 0.9
+     */
+    public <K, V> Map<K, V> asMap(Class<K> keyType, Class<V> valueType) {
+        return new PyMapView<>(this, keyType, valueType);
+    }
+
+    /**
+     * Gets the items of this Python sequence or iterable as a new {@code java.util.ArrayList}.
+     * The items are converted in a single call, as by {@link #getObjectArrayValue(Class)}.
+     * Use {@code PyObject.class} as item type to get the Python items as they are.
+     *
+     * @param itemType The item type class.
+     * @param <E>      The item type name.
+     * @return A copy of this Python sequence.
+     * @since 0.9
+     */
+    public <E> List<E> toList(Class<? extends E> itemType) {
+        assertPythonRuns();
+        return PyLib.getListValue(getPointer(), itemType);
+    }
+
+    /**
+     * Gets the items of this Python sequence or iterable as a new {@code java.util.ArrayList} of Java objects.
+     *
+     * @return A copy of this Python sequence.
+     * @see #toList(Class)
+     * @since 0.9
+     */
+    public List<Object> toList() {
+        return toList(Object.class);
+    }
+
+    /**
+     * Gets the entries of this Python mapping as a new {@code java.util.HashMap}.
+     * The entries are converted in a single call.
+     * Use {@code PyObject.class} as value type to get the Python values as they are.
+     *
+     * @param keyType   The key type class.
+     * @param valueType The value type class.
+     * @param <K>       The key type name.
+     * @param <V>       The value type name.
+     * @return A copy of this Python mapping.
+     * @since 0.9
+     */
+    public <K, V> Map<K, V> toMap(Class<? extends K> keyType, Class<? extends V> valueType) {
+        assertPythonRuns();
+        return PyLib.getMapValue(getPointer(), keyType, valueType);
+    }
+
+    /**
+     * Gets the entries of this Python mapping as a new {@code java.util.HashMap} of Java objects.
+     *
+     * @return A copy of this Python mapping.
+     * @see #toMap(Class, Class)
+     * @since 0.9
+     */
+    public Map<Object, Object> toMap() {
+        return toMap(Object.class, Object.class);
+    }
+
     /**
      * Gets the Python value of a Python attribute.
      * <p>
@@ -164,7 +350,7 @@ public class PyObject {
     public PyObject getAttribute(String name) {
         assertPythonRuns();
         long pointer = PyLib.getAttributeObject(getPointer(), name);
-        return pointer != 0 ? new PyObject(pointer) : null;
+        return wrap(pointer);
     }
 
     /**
@@ -229,7 +415,7 @@ public class PyObject {
     public PyObject callMethod(String name, Object... args) {
         assertPythonRuns();
         long pointer = PyLib.callAndReturnObject(getPointer(), true, name, args.length, args, null);
-        return pointer != 0 ? new PyObject(pointer) : null;
+        return wrap(pointer);
     }
 
     /**
@@ -245,12 +431,16 @@ public class PyObject {
     public PyObject call(String name, Object... args) {
         assertPythonRuns();
         long pointer = PyLib.callAndReturnObject(getPointer(), false, name, args.length, args, null);
-        return pointer != 0 ? new PyObject(pointer) : null;
+        return wrap(pointer);
     }
 
     /**
      * Create a Java proxy instance of this Python object which contains compatible methods to the ones provided in the
      * interface given by the {@code type} parameter.
+     * <p>
+     * The Python method called by an interface method is looked up once, on the method's first invocation.
+     * Later rebinding of the Python object's attribute, or a different answer of a dynamic {@code __getattr__()},
+     * doesn't affect the proxy.
      *
      * @param type The interface class.
      * @param <T>  The interface name.
@@ -265,15 +455,20 @@ public class PyObject {
     /**
      * Create a Java proxy instance of this Python object (or module) which contains compatible methods
      * (or functions) to the ones provided in the interfaces given by all the {@code type} parameters.
+     * <p>
+     * The Python method (or function) called by an interface method is looked up once, on the method's first invocation.
+     * Later rebinding of the Python object's (or module's) attribute, or a different answer of a dynamic {@code __getattr__()},
+     * doesn't affect the proxy.
      *
-     * @param callableKind The kind of calls to be made.
+     * @param callableKind The kind of calls to be made. Both kinds look up the callable as an attribute
+     *                     of this Python object (or module), so the value doesn't make a difference.
      * @param types        The interface types.
      * @return A instance implementing the all the given interfaces which serves as a proxy for the given Python object (or module).
      */
     public Object createProxy(PyLib.CallableKind callableKind, Class<?>... types) {
         assertPythonRuns();
         ClassLoader classLoader = types[0].getClassLoader();
-        InvocationHandler invocationHandler = new PyProxyHandler(this, callableKind);
+        InvocationHandler invocationHandler = new PyProxyHandler(this);
         return Proxy.newProxyInstance(classLoader, types, invocationHandler);
     }
 
@@ -317,4 +512,13 @@ public class PyObject {
     public final int hashCode() {
         return (int) (pointer ^ (pointer >>> 32));
     }
+
+    private static final class CacheEntry extends WeakReference<PyObject> {
+        private final Long key;
+
+        CacheEntry(Long key, PyObject pyObject) {
+            super(pyObject, CACHE_QUEUE);
+            this.key = key;
+        }
+    }
 }
@@ -0,0 +1,239 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import java.io.File;
+import java.io.IOException;
+import java.lang.reflect.Constructor;
+import java.lang.reflect.Field;
+import java.lang.reflect.Method;
+import java.net.JarURLConnection;
+import java.net.URI;
+import java.net.URL;
+import java.net.URLConnection;
+import java.net.URLDecoder;
+import java.nio.file.DirectoryStream;
+import java.nio.file.FileSystem;
+import java.nio.file.FileSystems;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Enumeration;
+import java.util.LinkedHashSet;
+import java.util.List;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.jar.JarEntry;
+import java.util.jar.JarFile;
+import java.util.stream.Collectors;
+import java.util.stream.Stream;
+
+/**
+ * Loads Java classes in parallel for the Python function {@code jpy.preload()}.
+ * <p>
+ * Loading a class and computing its reflection data (constructors, methods, fields and their parameter types)
+ * is what makes the first use of a Java type from Python slow. This class does that work on the threads
+ * of the common fork-join pool, while the Python thread which called {@code jpy.preload()} has released the GIL.
+ * The JVM caches the reflection data, so that jpy creates the Python types of the returned classes quickly.
+ *
+ * @since 0.9
+ */
+public final class PyPreloader {
+
+    private static final String CLASS_SUFFIX = ".class";
+
+    /**
+     * Loads the classes with the given names in parallel and computes their reflection data and that of
+     * their super classes. A name may also be a package pattern: {@code "com.acme.*"} stands for all classes
+     * of the package {@code com.acme}, {@code "com.acme.**"} also includes the classes of its sub-packages.
+     * Classes of package patterns which can't be loaded are skipped.
+     *
+     * @param names Class names and package patterns.
+     * @return The loaded classes.
+     * @throws ClassNotFoundException if a class given by its name can't be found.
+     */
+    public static Class<?>[] loadClasses(String[] names) throws ClassNotFoundException {
+        final ClassLoader classLoader = ClassLoader.getSystemClassLoader();
+        final Set<String> classNames = new LinkedHashSet<>();
+        final Set<String> optionalClassNames = new LinkedHashSet<>();
+        for (String name : names) {
+            if (name.endsWith(".**")) {
+                optionalClassNames.addAll(findClassNames(classLoader, name.substring(0, name.length() - 3), true));
+            } else if (name.endsWith(".*")) {
+                optionalClassNames.addAll(findClassNames(classLoader, name.substring(0, name.length() - 2), false));
+            } else {
+                classNames.add(name);
+            }
+        }
+        optionalClassNames.removeAll(classNames);
+
+        final Set<String> missingClassNames = ConcurrentHashMap.newKeySet();
+        final Set<Class<?>> reflectedClasses = ConcurrentHashMap.newKeySet();
+        List<String> allClassNames = new ArrayList<>(classNames);
+        allClassNames.addAll(optionalClassNames);
+        List<Class<?>> classes = allClassNames.parallelStream()
+                .map(className -> {
+                    Class<?> cls = loadClass(classLoader, className);
+                    if (cls == null && classNames.contains(className)) {
+                        missingClassNames.add(className);
+                    }
+                    for (Class<?> c = cls; c != null && reflectedClasses.add(c); c = c.getSuperclass()) {
+                        reflect(c);
+                    }
+                    return cls;
+                })
+                .filter(cls -> cls != null)
+                .collect(Collectors.toList());
+
+        if (!missingClassNames.isEmpty()) {
+            throw new ClassNotFoundException(missingClassNames.iterator().next());
+        }
+        return classes.toArray(new Class<?>[classes.size()]);
+    }
+
+    private static Class<?> loadClass(ClassLoader classLoader, String className) {
+        try {
+            return Class.forName(className, false, classLoader);
+        } catch (ClassNotFoundException | LinkageError e) {
+            return null;
+        }
+    }
+
+    // Computes the reflection data used by jpy's JType_ResolveType(), which the JVM then caches
+    private static void reflect(Class<?> cls) {
+        try {
+            for (Constructor<?> constructor : cls.getDeclaredConstructors()) {
+                constructor.getParameterTypes();
+            }
+            for (Method method : cls.isInterface() ? cls.getMethods() : cls.getDeclaredMethods()) {
+                method.getParameterTypes();
+                method.getReturnType();
+            }
+            for (Field field : cls.isInterface() ? cls.getFields() : cls.getDeclaredFields()) {
+                field.getType();
+            }
+        } catch (LinkageError | SecurityException e) {
+            // jpy will report the problem when it resolves the type
+        }
+    }
+
+    private static Set<String> findClassNames(ClassLoader classLoader, String packageName, boolean recursive) {
+        Set<String> classNames = new LinkedHashSet<>();
+        String packagePath = packageName.replace('.', '/');
+        try {
+            Enumeration<URL> urls = classLoader.getResources(packagePath);
+            while (urls.hasMoreElements()) {
+                URL url = urls.nextElement();
+                if ("file".equals(url.getProtocol())) {
+                    findClassNames(new File(URLDecoder.decode(url.getPath(), "UTF-8")), packageName, recursive, classNames);
+                } else if ("jar".equals(url.getProtocol())) {
+                    URLConnection connection = url.openConnection();
+                    if (connection instanceof JarURLConnection) {
+                        findClassNames(((JarURLConnection) connection).getJarFile(), packagePath, recursive, classNames);
+                    }
+                }
+            }
+        } catch (IOException e) {
+            // Skip the package
+        }
+        if (classNames.isEmpty()) {
+            // Since Java 9, the classes of the JDK are in modules of the 'jrt' file system
+            findClassNamesInModules(packagePath, recursive, classNames);
+        }
+        return classNames;
+    }
+
+    private static void findClassNames(File dir, String packageName, boolean recursive, Set<String> classNames) {
+        File[] files = dir.listFiles();
+        if (files == null) {
+            return;
+        }
+        for (File file : files) {
+            String fileName = file.getName();
+            if (file.isDirectory()) {
+                if (recursive) {
+                    findClassNames(file, packageName + "." + fileName, true, classNames);
+                }
+            } else if (isClassFile(fileName)) {
+                classNames.add(packageName + "." + fileName.substring(0, fileName.length() - CLASS_SUFFIX.length()));
+            }
+        }
+    }
+
+    private static void findClassNames(JarFile jarFile, String packagePath, boolean recursive, Set<String> classNames) {
+        String prefix = packagePath + "/";
+        for (JarEntry entry : Collections.list(jarFile.entries())) {
+            String entryName = entry.getName();
+            if (entryName.startsWith(prefix) && isClassFile(entryName)) {
+                String relativeName = entryName.substring(prefix.length());
+                if (recursive || relativeName.indexOf('/') < 0) {
+                    classNames.add(toClassName(entryName));
+                }
+            }
+        }
+    }
+
+    private static void findClassNamesInModules(String packagePath, boolean recursive, Set<String> classNames) {
+        FileSystem jrt;
+        try {
+            jrt = FileSystems.getFileSystem(URI.create("jrt:/"));
+        } catch (RuntimeException e) {
+            return;
+        }
+        Path modules = jrt.getPath("/modules");
+        try (DirectoryStream<Path> moduleDirs = Files.newDirectoryStream(modules)) {
+            for (Path moduleDir : moduleDirs) {
+                Path packageDir = moduleDir.resolve(packagePath);
+                if (Files.isDirectory(packageDir)) {
+                    try (Stream<Path> files = Files.walk(packageDir, recursive ? Integer.MAX_VALUE : 1)) {
+                        for (Path file : (Iterable<Path>) files::iterator) {
+                            if (isClassFile(file.getFileName().toString())) {
+                                classNames.add(toClassName(moduleDir.relativize(file).toString()));
+                            }
+                        }
+                    }
+                }
+            }
+        } catch (IOException | RuntimeException e) {
+            // Skip the package
+        }
+    }
+
+    // Skips anonymous and local classes (e.g. 'Outer$1') as well as 'package-info' and 'module-info'
+    private static boolean isClassFile(String fileName) {
+        if (!fileName.endsWith(CLASS_SUFFIX) || fileName.endsWith("-info" + CLASS_SUFFIX)) {
+            return false;
+        }
+        int index = fileName.indexOf('$');
+        while (index >= 0) {
+            if (index + 1 < fileName.length() && Character.isDigit(fileName.charAt(index + 1))) {
+                return false;
+            }
+            index = fileName.indexOf('$', index + 1);
+        }
+        return true;
+    }
+
+    private static String toClassName(String classFilePath) {
+        String path = classFilePath.substring(0, classFilePath.length() - CLASS_SUFFIX.length());
+        return path.replace('/', '.');
+    }
+
+    private PyPreloader() {
+    }
+}
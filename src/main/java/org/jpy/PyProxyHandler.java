@@ -18,47 +18,65 @@ package org.jpy;
 
 import java.lang.reflect.InvocationHandler;
 import java.lang.reflect.Method;
-import java.util.Arrays;
+import java.util.concurrent.ConcurrentHashMap;
 
 import static org.jpy.PyLib.assertPythonRuns;
 
 /**
  * The {@code InvocationHandler} for used by the proxy instances created by the
  * {@link PyObject#createProxy(Class)} and {@link PyModule#createProxy(Class)} methods.
+ * <p>
+ * The Python callable of an interface method is looked up once, on the method's first invocation, together
+ * with the method's parameter and return types. Later invocations directly call the callable, so they don't see
+ * rebinding of the Python object's attributes or different answers of a dynamic {@code __getattr__()}.
  *
  * @author Norman Fomferra
  * @since 0.7
  */
 class PyProxyHandler implements InvocationHandler {
     private final PyObject pyObject;
-    private final PyLib.CallableKind callableKind;
+    private final ConcurrentHashMap<Method, MethodCall> methodCalls;
 
-    public PyProxyHandler(PyObject pyObject, PyLib.CallableKind callableKind) {
+    public PyProxyHandler(PyObject pyObject) {
         if (pyObject == null) {
             throw new NullPointerException("pyObject");
         }
         this.pyObject = pyObject;
-        this.callableKind = callableKind;
+        this.methodCalls = new ConcurrentHashMap<>();
     }
 
     @Override
     public Object invoke(Object proxyObject, Method method, Object[] args) throws Throwable {
+        MethodCall methodCall = methodCalls.get(method);
+        if (methodCall == null) {
+            methodCall = getMethodCall(method);
+        }
+        // Diagnostics (PyLib.Diag.F_METH) are printed by the native method
+        return PyLib.callCallableAndReturnValue(methodCall.callable.getPointer(),
+                                                args != null ? args.length : 0,
+                                                args,
+                                                methodCall.parameterTypes,
+                                                methodCall.returnType);
+    }
+
+    private MethodCall getMethodCall(Method method) {
         assertPythonRuns();
+        // Both callable kinds look up an attribute: a bound method of an object or a function of a module
+        PyObject callable = pyObject.getAttribute(method.getName());
+        MethodCall methodCall = new MethodCall(callable, method.getParameterTypes(), method.getReturnType());
+        MethodCall existingMethodCall = methodCalls.putIfAbsent(method, methodCall);
+        return existingMethodCall != null ? existingMethodCall : methodCall;
+    }
 
-        if ((PyLib.Diag.getFlags() & PyLib.Diag.F_METH) != 0) {
-            System.out.printf("org.jpy.PyProxyHandler: invoke: %s(%s) on pyObject=%s in thread %s\n",
-                              method.getName(),
-                              Arrays.toString(args),
-                              Long.toHexString(this.pyObject.getPointer()),
-                              Thread.currentThread());
-        }
+    private static final class MethodCall {
+        private final PyObject callable;
+        private final Class<?>[] parameterTypes;
+        private final Class<?> returnType;
 
-        return PyLib.callAndReturnValue(this.pyObject.getPointer(),
-                                        callableKind == PyLib.CallableKind.METHOD,
-                                        method.getName(),
-                                        args != null ? args.length : 0,
-                                        args,
-                                        method.getParameterTypes(),
-                                        method.getReturnType());
+        MethodCall(PyObject callable, Class<?>[] parameterTypes, Class<?> returnType) {
+            this.callable = callable;
+            this.parameterTypes = parameterTypes;
+            this.returnType = returnType;
+        }
     }
 }
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.runner.Runner;
+import org.openjdk.jmh.runner.options.Options;
+import org.openjdk.jmh.runner.options.OptionsBuilder;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Compares the throughput of calling into Python directly from many Java threads with calling through
+ * a {@link PyExecutor}. Not run as part of the unit tests; run {@link #main(String[])} with the test classpath,
+ * it runs both benchmarks with 1, 8 and 64 caller threads.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.Throughput)
+@OutputTimeUnit(TimeUnit.SECONDS)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+public class PyExecutorBenchmark {
+
+    private PyObject function;
+    private PyExecutor executor;
+
+    @Setup(Level.Trial)
+    public void setUp() {
+        PyLib.startPython();
+        function = PyObject.executeCode("lambda x: x + 1", PyInputMode.EXPRESSION);
+        executor = new PyExecutor();
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() throws InterruptedException {
+        executor.close();
+    }
+
+    @Benchmark
+    public int directCall() {
+        return function.call("__call__", 41).getIntValue();
+    }
+
+    @Benchmark
+    public int executorCall() {
+        return executor.submit(() -> function.call("__call__", 41).getIntValue()).join();
+    }
+
+    public static void main(String[] args) throws Exception {
+        for (int threads : new int[]{1, 8, 64}) {
+            Options options = new OptionsBuilder()
+                    .include(PyExecutorBenchmark.class.getSimpleName())
+                    .threads(threads)
+                    .build();
+            new Runner(options).run();
+        }
+    }
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import org.junit.BeforeClass;
+import org.junit.Test;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.concurrent.Callable;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.TimeUnit;
+
+import static org.junit.Assert.*;
+
+public class PyExecutorTest {
+
+    @BeforeClass
+    public static void setUpClass() throws Exception {
+        PyLib.startPython();
+        assertEquals(true, PyLib.isPythonRunning());
+    }
+
+    @Test
+    public void testSubmitFromManyThreads() throws Exception {
+        final PyModule builtins = PyModule.getBuiltins();
+        try (final PyExecutor executor = new PyExecutor("test-executor", 16)) {
+            final List<CompletableFuture<Integer>> futures = new ArrayList<>();
+            List<Thread> threads = new ArrayList<>();
+            for (int t = 0; t < 8; t++) {
+                final int offset = t * 100;
+                Thread thread = new Thread(() -> {
+                    for (int i = 0; i < 100; i++) {
+                        final int value = offset + i;
+                        CompletableFuture<Integer> future = executor.submit(() -> builtins.call("abs", -value).getIntValue());
+                        synchronized (futures) {
+                            futures.add(future);
+                        }
+                    }
+                });
+                threads.add(thread);
+                thread.start();
+            }
+            for (Thread thread : threads) {
+                thread.join();
+            }
+            int sum = 0;
+            for (CompletableFuture<Integer> future : futures) {
+                sum += future.get(10, TimeUnit.SECONDS);
+            }
+            assertEquals(800, futures.size());
+            assertEquals(799 * 800 / 2, sum);
+        }
+    }
+
+    @Test
+    public void testSubmitAll() throws Exception {
+        final PyModule builtins = PyModule.getBuiltins();
+        try (PyExecutor executor = new PyExecutor()) {
+            List<Callable<String>> tasks = new ArrayList<>();
+            for (int i = 0; i < 10; i++) {
+                final int value = i;
+                tasks.add(() -> builtins.call("str", value).getStringValue());
+            }
+            List<CompletableFuture<String>> futures = executor.submitAll(tasks);
+            assertEquals(10, futures.size());
+            for (int i = 0; i < 10; i++) {
+                assertEquals(String.valueOf(i), futures.get(i).get(10, TimeUnit.SECONDS));
+            }
+        }
+    }
+
+    @Test
+    public void testExceptionsCompleteFuture() throws Exception {
+        try (PyExecutor executor = new PyExecutor()) {
+            CompletableFuture<Object> future = executor.submit(() -> PyModule.importModule("no_such_module_xyz"));
+            try {
+                future.get(10, TimeUnit.SECONDS);
+                fail();
+            } catch (ExecutionException e) {
+                assertNotNull(e.getCause());
+            }
+            // The executor keeps working after a failed task
+            assertEquals(3, (int) executor.submit(() -> PyModule.getBuiltins().call("abs", -3).getIntValue()).get(10, TimeUnit.SECONDS));
+        }
+    }
+
+    @Test
+    public void testShutdown() throws Exception {
+        PyExecutor executor = new PyExecutor();
+        CompletableFuture<Integer> future = executor.submit(() -> PyModule.getBuiltins().call("abs", -7).getIntValue());
+        executor.shutdown();
+        assertTrue(executor.isShutdown());
+        assertTrue(executor.awaitTermination(10, TimeUnit.SECONDS));
+        assertEquals(7, (int) future.get());
+        try {
+            executor.submit(() -> 1);
+            fail();
+        } catch (RejectedExecutionException e) {
+            // ok
+        }
+    }
+
+    @Test
+    public void testSubmitConcurrentlyWithShutdown() throws Exception {
+        for (int round = 0; round < 20; round++) {
+            final PyExecutor executor = new PyExecutor("test-executor", 4);
+            final List<CompletableFuture<Integer>> futures = new ArrayList<>();
+            final Callable<Integer> task = () -> 1;
+            final CountDownLatch ready = new CountDownLatch(4);
+            List<Thread> threads = new ArrayList<>();
+            for (int t = 0; t < 4; t++) {
+                Thread thread = new Thread(() -> {
+                    ready.countDown();
+                    try {
+                        while (true) {
+                            CompletableFuture<Integer> future = executor.submit(task);
+                            List<CompletableFuture<Integer>> batch = executor.submitAll(Collections.nCopies(3, task));
+                            synchronized (futures) {
+                                futures.add(future);
+                                futures.addAll(batch);
+                            }
+                        }
+                    } catch (RejectedExecutionException e) {
+                        // ok, the executor has been shut down
+                    }
+                });
+                threads.add(thread);
+                thread.start();
+            }
+            ready.await();
+            executor.shutdown();
+            for (Thread thread : threads) {
+                thread.join();
+            }
+            assertTrue(executor.awaitTermination(10, TimeUnit.SECONDS));
+            // Every accepted task has either been executed or its future has been rejected, none is left over
+            for (CompletableFuture<Integer> future : futures) {
+                try {
+                    assertEquals(1, (int) future.get(10, TimeUnit.SECONDS));
+                } catch (ExecutionException e) {
+                    assertTrue(e.getCause() instanceof RejectedExecutionException);
+                }
+            }
+        }
+    }
+}
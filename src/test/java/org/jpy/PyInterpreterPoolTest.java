@@ -0,0 +1,146 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import org.junit.BeforeClass;
+import org.junit.Test;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.TimeUnit;
+
+import static org.junit.Assert.*;
+import static org.junit.Assume.assumeTrue;
+
+public class PyInterpreterPoolTest {
+
+    @BeforeClass
+    public static void setUpClass() throws Exception {
+        PyLib.startPython();
+        assertEquals(true, PyLib.isPythonRunning());
+    }
+
+    @Test
+    public void testInterpretersAreIsolated() throws Exception {
+        try (PyInterpreterPool pool = new PyInterpreterPool(2, false, 16)) {
+            assertEquals(2, pool.getSize());
+            pool.call(() -> {
+                PyModule.importModule("sys").setAttribute("jpy_pool_test", 42);
+                return null;
+            });
+            int index = pool.getInterpreterIndex();
+            List<CompletableFuture<Boolean>> found = pool.submitToAll(() -> hasPoolTestAttribute());
+            assertEquals(2, found.size());
+            assertEquals(true, found.get(index).get(10, TimeUnit.SECONDS));
+            assertEquals(false, found.get(1 - index).get(10, TimeUnit.SECONDS));
+            assertEquals(false, hasPoolTestAttribute());
+        }
+    }
+
+    @Test
+    public void testThreadsArePinned() throws Exception {
+        try (final PyInterpreterPool pool = new PyInterpreterPool(2, false, 16)) {
+            final int[] indexes = new int[4];
+            final boolean[] pinned = new boolean[4];
+            List<Thread> threads = new ArrayList<>();
+            for (int t = 0; t < 4; t++) {
+                final int threadIndex = t;
+                Thread thread = new Thread(() -> {
+                    indexes[threadIndex] = pool.getInterpreterIndex();
+                    try {
+                        int value = pool.call(() -> PyModule.getBuiltins().call("abs", -threadIndex).getIntValue());
+                        pinned[threadIndex] = value == threadIndex && pool.getInterpreterIndex() == indexes[threadIndex];
+                    } catch (Exception e) {
+                        pinned[threadIndex] = false;
+                    }
+                });
+                threads.add(thread);
+                thread.start();
+            }
+            for (Thread thread : threads) {
+                thread.join();
+            }
+            int[] counts = new int[2];
+            for (int t = 0; t < 4; t++) {
+                assertTrue(pinned[t]);
+                counts[indexes[t]]++;
+            }
+            assertEquals(2, counts[0]);
+            assertEquals(2, counts[1]);
+        }
+    }
+
+    @Test
+    public void testOwnGil() throws Exception {
+        assumeTrue(isOwnGilSupported());
+        try (final PyInterpreterPool pool = new PyInterpreterPool(4)) {
+            List<CompletableFuture<Integer>> futures = pool.submitToAll(() ->
+                    PyObject.executeCode("sum(i * i for i in range(1000))", PyInputMode.EXPRESSION).getIntValue());
+            for (CompletableFuture<Integer> future : futures) {
+                assertEquals(332833500, future.get(10, TimeUnit.SECONDS).intValue());
+            }
+        }
+    }
+
+    @Test
+    public void testOwnGilInterpretersUseJpy() throws Exception {
+        assumeTrue(isOwnGilSupported());
+        // Each interpreter creates its own jpy types and Java types, and releases them when it is destroyed
+        String code = "(lambda jpy: jpy.get_type('java.lang.Integer').MAX_VALUE % 1000"
+                      + " + jpy.get_type('java.util.ArrayList')([1, 2, 3]).size())(__import__('jpy'))";
+        for (int round = 0; round < 3; round++) {
+            try (PyInterpreterPool pool = new PyInterpreterPool(4)) {
+                List<CompletableFuture<Integer>> futures = new ArrayList<>();
+                for (int i = 0; i < 4; i++) {
+                    futures.addAll(pool.submitToAll(() -> PyObject.executeCode(code, PyInputMode.EXPRESSION).getIntValue()));
+                }
+                for (CompletableFuture<Integer> future : futures) {
+                    assertEquals(Integer.MAX_VALUE % 1000 + 3, future.get(10, TimeUnit.SECONDS).intValue());
+                }
+            }
+        }
+    }
+
+    @Test
+    public void testShutdown() throws Exception {
+        PyInterpreterPool pool = new PyInterpreterPool(1, false, 16);
+        CompletableFuture<Integer> future = pool.submit(() -> PyModule.getBuiltins().call("len", "abc").getIntValue());
+        pool.shutdown();
+        assertTrue(pool.isShutdown());
+        assertTrue(pool.awaitTermination(10, TimeUnit.SECONDS));
+        assertEquals(3, future.get().intValue());
+        try {
+            pool.submit(() -> 0);
+            fail();
+        } catch (RejectedExecutionException e) {
+            // ok
+        }
+    }
+
+    private static boolean hasPoolTestAttribute() {
+        return PyModule.getBuiltins().call("hasattr", PyModule.importModule("sys"), "jpy_pool_test").getIntValue() != 0;
+    }
+
+    private static boolean isOwnGilSupported() {
+        String[] version = PyLib.getPythonVersion().split("[. ]");
+        int major = Integer.parseInt(version[0]);
+        int minor = Integer.parseInt(version[1]);
+        return major > 3 || major == 3 && minor >= 12;
+    }
+}
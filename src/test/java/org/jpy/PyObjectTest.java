@@ -27,6 +27,7 @@ import java.io.IOException;
 import java.util.Arrays;
 import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.concurrent.*;
 
 import static org.junit.Assert.*;
@@ -77,17 +78,27 @@ public class PyObjectTest {
         PyObject pyObject1 = new PyObject(pointer1);
         PyObject pyObject2 = new PyObject(pointer2);
         assertEquals(true, pyObject1.equals(pyObject1));
-        assertEquals(true, pyObject1.equals(new PyObject(pointer1)));
+        assertEquals(true, pyObject1.equals(new PyObject(PyLib.importModule("sys"))));
         assertEquals(false, pyObject1.equals(pyObject2));
-        assertEquals(false, pyObject1.equals(new PyObject(pointer2)));
+        assertEquals(false, pyObject1.equals(new PyObject(PyLib.importModule("os"))));
         assertEquals(false, pyObject1.equals((Object) pointer1));
         assertTrue(0 != pyObject1.hashCode());
         assertTrue(0 != pyObject2.hashCode());
         assertEquals(pyObject1.hashCode(), pyObject1.hashCode());
-        assertEquals(pyObject1.hashCode(), new PyObject(pointer1).hashCode());
+        assertEquals(pyObject1.hashCode(), new PyObject(PyLib.importModule("sys")).hashCode());
         assertTrue(pyObject1.hashCode() != pyObject2.hashCode());
     }
 
+    @Test
+    public void testSameInstanceForSamePythonObject() throws Exception {
+        PyModule sys = PyModule.importModule("sys");
+        assertSame(sys, PyModule.importModule("sys"));
+        PyObject path = sys.getAttribute("path");
+        assertSame(path, sys.getAttribute("path"));
+        assertSame(sys, PyModule.getBuiltins().call("__import__", "sys"));
+        assertNotSame(path, sys.getAttribute("modules"));
+    }
+
     @Test
     public void testExecuteCode_Stmt() throws Exception {
         PyObject pyObject = PyObject.executeCode("pass", PyInputMode.STATEMENT);
@@ -190,6 +201,78 @@ public class PyObjectTest {
         Assert.assertEquals("Tut tut!", a.getStringValue());
     }
 
+    @Test
+    public void testAttributeNamesAreCachedByValue() throws Exception {
+        PyObject myobj = PyModule.importModule("imp").call("new_module", "myobj");
+        for (int i = 0; i < 1000; i++) {
+            // New String instances with equal values, and more names than cache entries
+            String name = new String("attr_" + (i % 300));
+            myobj.setAttribute(name, i);
+            Assert.assertEquals(i, myobj.getAttribute(new String(name), Integer.class).intValue());
+            Assert.assertEquals(i, myobj.getAttribute(name).getIntValue());
+        }
+        String longName = "a_name_which_is_too_long_to_be_stored_in_the_name_cache";
+        myobj.setAttribute(longName, "long");
+        Assert.assertEquals("long", myobj.getAttribute(longName, String.class));
+    }
+
+    @Test
+    public void testListView() throws Exception {
+        PyObject pyList = PyObject.executeCode("[1, 2, 3]", PyInputMode.EXPRESSION);
+        List<Integer> list = pyList.asList(Integer.class);
+        assertEquals(3, list.size());
+        assertEquals(Arrays.asList(1, 2, 3), list);
+
+        list.set(0, 10);
+        list.add(4);
+        list.remove(1);
+        assertEquals(Arrays.asList(10, 3, 4), list);
+        // The Python list has been modified
+        assertEquals(3, PyModule.getBuiltins().call("len", pyList).getIntValue());
+        assertEquals(17, PyModule.getBuiltins().call("sum", pyList).getIntValue());
+    }
+
+    @Test
+    public void testMapView() throws Exception {
+        PyObject pyDict = PyObject.executeCode("{'a': 1, 'b': 2}", PyInputMode.EXPRESSION);
+        Map<String, Integer> map = pyDict.asMap(String.class, Integer.class);
+        assertEquals(2, map.size());
+        assertEquals(Integer.valueOf(1), map.get("a"));
+        assertNull(map.get("c"));
+        assertTrue(map.containsKey("b"));
+
+        assertEquals(Integer.valueOf(2), map.put("b", 20));
+        assertNull(map.put("c", 30));
+        assertEquals(Integer.valueOf(1), map.remove("a"));
+        HashMap<String, Integer> expected = new HashMap<>();
+        expected.put("b", 20);
+        expected.put("c", 30);
+        assertEquals(expected, new HashMap<>(map));
+        // The Python dict has been modified
+        assertEquals(2, PyModule.getBuiltins().call("len", pyDict).getIntValue());
+    }
+
+    @Test
+    public void testToListAndToMap() throws Exception {
+        PyObject pyList = PyObject.executeCode("[1, 2, None, 3]", PyInputMode.EXPRESSION);
+        List<Integer> list = pyList.toList(Integer.class);
+        assertEquals(Arrays.asList(1, 2, null, 3), list);
+        // The list is a copy
+        list.add(4);
+        assertEquals(4, PyModule.getBuiltins().call("len", pyList).getIntValue());
+        assertEquals(Arrays.<Object>asList("a", 1.5, true), PyObject.executeCode("('a', 1.5, True)", PyInputMode.EXPRESSION).toList());
+
+        PyObject pyDict = PyObject.executeCode("{'a': 1, 'b': 2}", PyInputMode.EXPRESSION);
+        Map<String, Long> map = pyDict.toMap(String.class, Long.class);
+        HashMap<String, Long> expected = new HashMap<>();
+        expected.put("a", 1L);
+        expected.put("b", 2L);
+        assertEquals(expected, map);
+        map.clear();
+        assertEquals(2, PyModule.getBuiltins().call("len", pyDict).getIntValue());
+        assertEquals(1, PyObject.executeCode("{1: [2]}", PyInputMode.EXPRESSION).toMap().size());
+    }
+
     @Test
     public void testCreateProxyAndCallSingleThreaded() throws Exception {
         addTestDirToPythonSysPath();
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy;
+
+import org.jpy.fixtures.Thing;
+import org.junit.Test;
+
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+
+import static org.junit.Assert.*;
+
+public class PyPreloaderTest {
+
+    @Test
+    public void testLoadClassesByName() throws Exception {
+        Class<?>[] classes = PyPreloader.loadClasses(new String[]{"java.util.HashMap", "org.jpy.fixtures.Thing"});
+        assertArrayEquals(new Class<?>[]{HashMap.class, Thing.class}, classes);
+    }
+
+    @Test
+    public void testLoadClassesOfPackage() throws Exception {
+        List<Class<?>> classes = Arrays.asList(PyPreloader.loadClasses(new String[]{"org.jpy.fixtures.*"}));
+        assertTrue(classes.contains(Thing.class));
+        for (Class<?> cls : classes) {
+            assertEquals("org.jpy.fixtures", cls.getPackage().getName());
+            assertFalse(cls.isAnonymousClass());
+        }
+    }
+
+    @Test(expected = ClassNotFoundException.class)
+    public void testLoadUnknownClass() throws Exception {
+        PyPreloader.loadClasses(new String[]{"java.util.HashMap", "java.lang.Spring"});
+    }
+}
@@ -36,6 +36,9 @@ public class FieldTestFixture {
     public static final String S_OBJ_STATIC_FIELD = "ABC";
     public static final Thing l_OBJ_STATIC_FIELD = new Thing(123);
 
+    public static int iStaticField;
+    public static String SObjStaticField;
+
     public boolean zInstField;
     public char cInstField;
     public byte bInstField;
@@ -17,6 +17,7 @@
 package org.jpy.fixtures;
 
 import java.lang.reflect.Array;
+import java.util.List;
 
 /**
  * Used as a test class for the test cases in jpy_overload_test.py
@@ -82,6 +83,26 @@ public class MethodOverloadTestFixture {
         }
     }
 
+    /**
+     * Used to test that overridden methods are preferred over the ones in the super class
+     */
+    public static class MethodOverloadTestFixture3 extends MethodOverloadTestFixture2 {
+        @Override
+        public String join(String a, String b, String c) {
+            return "MethodOverloadTestFixture3.join:" + stringifyArgs(a, b, c);
+        }
+    }
+
+    //////////////////////////////////////////////
+
+    public String collect(int[] a) {
+        return stringifyArgs((Object) a);
+    }
+
+    public String collect(List<?> a) {
+        return "List(" + a + ")";
+    }
+
     //////////////////////////////////////////////
 
     // Should never been found, since 'float' is not present in Python
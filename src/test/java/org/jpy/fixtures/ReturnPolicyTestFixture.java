@@ -0,0 +1,67 @@
+/*
+ * Copyright 2015 Brockmann Consult GmbH
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+package org.jpy.fixtures;
+
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * Used as a test class for the return policy test cases in jpy_retval_test.py
+ * Note: Please make sure to not add any method overloads to this class.
+ */
+@SuppressWarnings("UnusedDeclaration")
+public class ReturnPolicyTestFixture {
+
+    public byte[] getBytes(String string) {
+        return string != null ? string.getBytes(StandardCharsets.UTF_8) : null;
+    }
+
+    public int[] getInts(int item0, int item1, int item2) {
+        return new int[]{item0, item1, item2};
+    }
+
+    public double[][] getMatrix(double item00, double item01, double item10, double item11) {
+        return new double[][]{{item00, item01}, {item10, item11}};
+    }
+
+    public String[] getStrings(String item0, String item1) {
+        return new String[]{item0, item1};
+    }
+
+    public Thing[] getThings(Thing item0, Thing item1) {
+        return new Thing[]{item0, item1};
+    }
+
+    public List<Object> getList(Object item0, Object item1) {
+        return new ArrayList<>(Arrays.asList(item0, item1));
+    }
+
+    public Map<String, Integer> getMap(String key, int value) {
+        Map<String, Integer> map = new HashMap<>();
+        map.put(key, value);
+        map.put("none", null);
+        return map;
+    }
+
+    public Thing getThing(int value) {
+        return new Thing(value);
+    }
+}
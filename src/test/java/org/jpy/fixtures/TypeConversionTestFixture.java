@@ -16,6 +16,8 @@
 
 package org.jpy.fixtures;
 
+import java.util.function.Function;
+
 import static org.jpy.fixtures.MethodOverloadTestFixture.stringifyArgs;
 
 /**
@@ -41,4 +43,15 @@ public class TypeConversionTestFixture {
     public String stringifyStringArrayArg(String[] arg) {
         return stringifyArgs((Object) arg);
     }
+
+    // A functional interface which redeclares the inherited abstract method with narrower types
+    public interface IntOp extends Function<Integer, Integer> {
+        @Override
+        Integer apply(Integer x);
+    }
+
+    public String applyIntOp(IntOp op, int x) {
+        Function<Integer, Integer> function = op;
+        return stringifyArgs(op.apply(x), function.apply(x + 1));
+    }
 }
@@ -3,6 +3,11 @@ import sys
 
 import jpyutil
 
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
 
 jpyutil.init_jvm(jvm_maxmem='512M', jvm_classpath=['target/test-classes'])
 import jpy
@@ -98,6 +103,20 @@ class TestJavaArrays(unittest.TestCase):
         self.do_test_array_protocol('java.lang.Object', [None, None, None], [File('A'), 'B', 3])
 
 
+    def test_array_string(self):
+        String = jpy.get_type('java.lang.String')
+        # Latin-1, BMP and non-BMP strings use different representations in Python 3.3+
+        strings = ['', 'ascii', u'caf\u00e9', u'\u20ac' * 200, u'smile \U0001F600', None, String('java')]
+        a = jpy.array('java.lang.String', strings)
+        self.assertEqual(len(a), len(strings))
+        self.assertEqual(list(a), ['', 'ascii', u'caf\u00e9', u'\u20ac' * 200, u'smile \U0001F600', None, 'java'])
+        self.assertEqual([s for s in a], list(a))
+        self.assertEqual(a[4], u'smile \U0001F600')
+
+        with self.assertRaises(ValueError):
+            jpy.array('java.lang.String', ['a', 1])
+
+
     # see https://github.com/bcdev/jpy/issues/52
     def test_array_item_del(self):
         Integer = jpy.get_type('java.lang.Integer')
@@ -201,6 +220,97 @@ class TestJavaArrays(unittest.TestCase):
         self.do_test_buffer_protocol_float('double', 8, [0.12345678, 0.0, -100.123456, 54.3], 8)
 
 
+    @unittest.skipIf(sys.version_info < (3, 0, 0), 'memoryview.release() requires Python 3')
+    def test_buffer_readonly_release(self):
+        a = jpy.array('int', [1, 2, 3])
+        m = memoryview(a)
+        self.assertEqual(m.readonly, True)
+        a[0] = 9
+        # A read-only export must not copy its items back into the Java array
+        m.release()
+        self.assertEqual(a[0], 9)
+
+
+    @unittest.skipIf(sys.version_info < (3, 0, 0), 'struct.pack_into() requires the new buffer protocol')
+    def test_buffer_writable_release(self):
+        import struct
+        a = jpy.array('int', [1, 2, 3])
+        # pack_into() requests a writable export, whose items are copied back into the Java array on release
+        struct.pack_into('i', a, 0, 7)
+        self.assertEqual(a[0], 7)
+        self.assertEqual(a[1], 2)
+
+
+    def test_nd_buffer(self):
+        IntArray = jpy.get_type('[I')
+        a = jpy.array(IntArray, [jpy.array('int', [1, 2, 3]), jpy.array('int', [4, 5, 6])])
+
+        with self.assertRaises(BufferError):
+            memoryview(a)
+
+        old_value = jpy.set_nd_buffers(True)
+        try:
+            m = memoryview(a)
+            self.assertEqual(m.ndim, 2)
+            self.assertEqual(m.shape, (2, 3))
+            self.assertEqual(m.strides, (12, 4))
+            self.assertEqual(m.format, 'i')
+            if sys.version_info >= (3, 0, 0):
+                self.assertEqual(m.tolist(), [[1, 2, 3], [4, 5, 6]])
+                m.release()
+
+            a[1] = jpy.array('int', [4, 5])
+            with self.assertRaises(BufferError):
+                memoryview(a)
+        finally:
+            jpy.set_nd_buffers(old_value)
+
+
+    @unittest.skipIf(np is None, 'numpy not installed')
+    def test_to_numpy(self):
+        a = jpy.array('double', [1.5, -2.0, 3.25])
+        n = jpy.to_numpy(a)
+        self.assertEqual(n.dtype, np.float64)
+        self.assertEqual(n.shape, (3,))
+        self.assertEqual(list(n), [1.5, -2.0, 3.25])
+
+        n = jpy.to_numpy(jpy.array('int', [1, 2, 3]), copy=False)
+        self.assertEqual(n.dtype, np.int32)
+        self.assertEqual(list(n), [1, 2, 3])
+
+
+    @unittest.skipIf(np is None, 'numpy not installed')
+    def test_to_numpy_nested(self):
+        FloatArray = jpy.get_type('[F')
+        a = jpy.array(FloatArray, [jpy.array('float', [1, 2, 3]), jpy.array('float', [4, 5, 6])])
+        n = jpy.to_numpy(a)
+        self.assertEqual(n.dtype, np.float32)
+        self.assertEqual(n.shape, (2, 3))
+        self.assertEqual(n.tolist(), [[1, 2, 3], [4, 5, 6]])
+
+        a[1] = jpy.array('float', [4, 5])
+        with self.assertRaises(ValueError):
+            jpy.to_numpy(a)
+
+
+    @unittest.skipIf(np is None, 'numpy not installed')
+    def test_from_numpy(self):
+        a = jpy.from_numpy(np.array([1.5, -2.0, 3.25]), 'double')
+        self.assertEqual(type(a).__name__, '[D')
+        self.assertEqual(list(a), [1.5, -2.0, 3.25])
+
+        a = jpy.from_numpy(np.arange(6, dtype=np.int64).reshape((2, 3)), 'long')
+        self.assertEqual(type(a).__name__, '[[J')
+        self.assertEqual(len(a), 2)
+        self.assertEqual(list(a[0]), [0, 1, 2])
+        self.assertEqual(list(a[1]), [3, 4, 5])
+
+        with self.assertRaises(ValueError):
+            jpy.from_numpy(np.zeros(3, dtype=np.float64), 'long')
+        with self.assertRaises(ValueError):
+            jpy.from_numpy(np.zeros(3, dtype=np.int32), 'double')
+
+
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
     unittest.main()
@@ -0,0 +1,113 @@
+import asyncio
+import concurrent.futures
+import threading
+import unittest
+
+import jpyutil
+
+# org.jpy.PyFutures is required, which is part of the jpy classes
+jpyutil.init_jvm(jvm_maxmem='512M', jvm_classpath=['target/classes', 'target/test-classes'])
+import jpy
+
+
+class TestAsync(unittest.TestCase):
+    def setUp(self):
+        self.CompletableFuture = jpy.get_type('java.util.concurrent.CompletableFuture')
+        self.loop = asyncio.new_event_loop()
+        asyncio.set_event_loop(self.loop)
+
+    def tearDown(self):
+        asyncio.set_event_loop(None)
+        self.loop.close()
+
+    def test_awaitCompletedFuture(self):
+        async def main():
+            return await self.CompletableFuture.completedFuture('abc')
+
+        self.assertEqual(self.loop.run_until_complete(main()), 'abc')
+
+    def test_awaitFutureCompletedByOtherThread(self):
+        future = self.CompletableFuture()
+
+        async def main():
+            threading.Timer(0.1, lambda: future.complete(42)).start()
+            return await future
+
+        self.assertEqual(self.loop.run_until_complete(main()), 42)
+
+    def test_awaitFailedFuture(self):
+        future = self.CompletableFuture()
+        IllegalStateException = jpy.get_type('java.lang.IllegalStateException')
+
+        async def main():
+            threading.Timer(0.1, lambda: future.completeExceptionally(IllegalStateException('boom'))).start()
+            return await future
+
+        with self.assertRaises(RuntimeError) as e:
+            self.loop.run_until_complete(main())
+        self.assertIn('boom', str(e.exception))
+
+    def test_awaitIsCancelledOnTimeout(self):
+        future = self.CompletableFuture()
+
+        async def main():
+            await asyncio.wait_for(future, 0.1)
+
+        with self.assertRaises(asyncio.TimeoutError):
+            self.loop.run_until_complete(main())
+        self.loop.run_until_complete(asyncio.sleep(0.01))
+        self.assertTrue(future.isCancelled())
+
+    def test_coroutineToJavaFuture(self):
+        async def compute(x):
+            await asyncio.sleep(0.01)
+            return x * 2
+
+        async def main():
+            java_future = jpy.to_java_future(compute(21))
+            self.assertTrue(isinstance(java_future, self.CompletableFuture))
+            return await java_future
+
+        self.assertEqual(self.loop.run_until_complete(main()), 42)
+
+    def test_failingCoroutineToJavaFuture(self):
+        async def compute():
+            raise ValueError('bad value')
+
+        async def main():
+            java_future = jpy.to_java_future(compute())
+            await asyncio.sleep(0.01)
+            self.assertTrue(java_future.isCompletedExceptionally())
+            await java_future
+
+        with self.assertRaises(RuntimeError) as e:
+            self.loop.run_until_complete(main())
+        self.assertIn('ValueError: bad value', str(e.exception))
+
+    def test_cancelJavaFutureCancelsCoroutine(self):
+        async def main():
+            task = asyncio.ensure_future(asyncio.sleep(10))
+            java_future = jpy.to_java_future(task)
+            java_future.cancel(False)
+            await asyncio.sleep(0.01)
+            return task.cancelled()
+
+        self.assertTrue(self.loop.run_until_complete(main()))
+
+    def test_concurrentFutureToJavaFuture(self):
+        with concurrent.futures.ThreadPoolExecutor(max_workers=1) as executor:
+            java_future = jpy.to_java_future(executor.submit(lambda: 'done'))
+
+            async def main():
+                return await java_future
+
+            self.assertEqual(self.loop.run_until_complete(main()), 'done')
+
+    def test_toJavaFutureRejectsOtherObjects(self):
+        with self.assertRaises(ValueError):
+            jpy.to_java_future(42)
+
+
+if __name__ == '__main__':
+    print('\nRunning ' + __file__)
+    unittest.main()
@@ -2,6 +2,11 @@ import unittest
 
 import jpyutil
 
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
 
 jpyutil.init_jvm(jvm_maxmem='512M', jvm_classpath=['target/test-classes'])
 import jpy
@@ -33,6 +38,26 @@ class TestFields(unittest.TestCase):
         self.assertEqual(self.Fixture.l_OBJ_STATIC_FIELD, self.Thing(123))
 
 
+    def test_non_final_static_fields(self):
+        fixture = self.Fixture()
+        fixture.iStaticField = 0
+        self.assertEqual(self.Fixture.iStaticField, 0)
+        self.assertEqual(self.Fixture.SObjStaticField, None)
+
+        # Static fields are read from the Java class on each access
+        fixture.iStaticField = 123
+        fixture.SObjStaticField = 'ABC'
+        self.assertEqual(self.Fixture.iStaticField, 123)
+        self.assertEqual(self.Fixture.SObjStaticField, 'ABC')
+        self.assertEqual(self.Fixture().iStaticField, 123)
+
+        fixture.SObjStaticField = None
+        self.assertEqual(self.Fixture.SObjStaticField, None)
+
+        with self.assertRaises(AttributeError):
+            fixture.i_STATIC_FIELD = 0
+
+
     def test_primitive_instance_fields(self):
         fixture = self.Fixture()
         self.assertEqual(fixture.zInstField, False)
@@ -99,6 +124,47 @@ class TestFields(unittest.TestCase):
         self.assertEqual(fixture.lObjInstField, self.Thing(123))
 
 
+    def new_fixtures(self, count):
+        fixtures = []
+        for i in range(count):
+            fixture = self.Fixture()
+            fixture.iInstField = i
+            fixture.dInstField = i + 0.5
+            fixture.SObjInstField = 'S' + str(i)
+            fixtures.append(fixture)
+        return fixtures
+
+
+    def test_get_fields(self):
+        fixtures = self.new_fixtures(3)
+        i_col, d_col, s_col = jpy.get_fields(fixtures, ['iInstField', 'dInstField', 'SObjInstField'])
+        self.assertEqual(i_col, [0, 1, 2])
+        self.assertEqual(d_col, [0.5, 1.5, 2.5])
+        self.assertEqual(s_col, ['S0', 'S1', 'S2'])
+
+        # From a Java object array, null items give None values
+        a = jpy.array(self.Fixture, fixtures + [None])
+        i_col, s_col = jpy.get_fields(a, ['iInstField', 'SObjInstField'])
+        self.assertEqual(i_col, [0, 1, 2, None])
+        self.assertEqual(s_col, ['S0', 'S1', 'S2', None])
+
+        with self.assertRaises(ValueError):
+            jpy.get_fields(fixtures, ['noSuchField'])
+        with self.assertRaises(ValueError):
+            jpy.get_fields(fixtures, ['i_STATIC_FIELD'])
+
+
+    @unittest.skipIf(np is None, 'numpy not installed')
+    def test_get_fields_as_numpy(self):
+        a = jpy.array(self.Fixture, self.new_fixtures(3))
+        i_col, d_col, s_col = jpy.get_fields(a, ['iInstField', 'dInstField', 'SObjInstField'], as_numpy=True)
+        self.assertEqual(i_col.dtype, np.int32)
+        self.assertEqual(i_col.tolist(), [0, 1, 2])
+        self.assertEqual(d_col.dtype, np.float64)
+        self.assertEqual(d_col.tolist(), [0.5, 1.5, 2.5])
+        self.assertEqual(s_col, ['S0', 'S1', 'S2'])
+
+
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
     unittest.main()
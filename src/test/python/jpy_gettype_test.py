@@ -4,7 +4,8 @@ import sys
 import jpyutil
 
 
-jpyutil.init_jvm(jvm_maxmem='512M', jvm_classpath=['target/test-classes'])
+# org.jpy.PyPreloader is required by jpy.preload(), which is part of the jpy classes
+jpyutil.init_jvm(jvm_maxmem='512M', jvm_classpath=['target/classes', 'target/test-classes'])
 import jpy
 
 
@@ -61,6 +62,28 @@ class TestGetClass(unittest.TestCase):
         self.assertEqual(str(e.exception), "Java class 'int[]' not found")
 
 
+    def test_preload(self):
+        count = jpy.preload(['java.util.LinkedHashMap', 'org.jpy.fixtures.*'])
+        self.assertTrue(count >= 10)
+        self.assertIn('java.util.LinkedHashMap', jpy.types)
+        self.assertIn('java.util.HashMap', jpy.types)
+        self.assertIn('org.jpy.fixtures.Thing', jpy.types)
+        Thing = jpy.types['org.jpy.fixtures.Thing']
+        self.assertEqual(Thing(7).getValue(), 7)
+
+    def test_preload_in_background(self):
+        thread = jpy.preload(['java.util.IdentityHashMap'], background=True)
+        thread.join()
+        self.assertIn('java.util.IdentityHashMap', jpy.types)
+        IdentityHashMap = jpy.get_type('java.util.IdentityHashMap')
+        self.assertEqual(IdentityHashMap().size(), 0)
+
+    def test_preload_unknown_class(self):
+        with self.assertRaises(RuntimeError) as e:
+            jpy.preload(['java.lang.Spring'])
+        self.assertIn('java.lang.Spring', str(e.exception))
+
+
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
     unittest.main()
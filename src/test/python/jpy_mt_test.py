@@ -44,6 +44,41 @@ class TestMultipleThreads(unittest.TestCase):
         self.assertEqual(456, t4.intValue)
 
 
+    def test_concurrent_type_resolution(self):
+        # All threads create and resolve the same (yet unused) types at once, see JType_LockTypes()
+        type_names = ['java.util.concurrent.ConcurrentSkipListMap',
+                      'java.util.concurrent.ConcurrentSkipListSet',
+                      'java.util.concurrent.LinkedTransferQueue']
+        start = threading.Event()
+        results = []
+        errors = []
+
+        def run():
+            start.wait()
+            try:
+                sizes = []
+                for type_name in type_names:
+                    obj = jpy.get_type(type_name)()
+                    if type_name.endswith('Map'):
+                        obj.put(7, 7)
+                    else:
+                        obj.add(7)
+                    sizes.append(obj.size())
+                results.append(sizes)
+            except Exception as e:
+                errors.append(e)
+
+        threads = [threading.Thread(target=run) for _ in range(8)]
+        for t in threads:
+            t.start()
+        start.set()
+        for t in threads:
+            t.join()
+
+        self.assertEqual([], errors)
+        self.assertEqual([[1, 1, 1]] * 8, results)
+
+
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
     unittest.main()
@@ -5,6 +5,11 @@ import jpyutil
 jpyutil.init_jvm(jvm_maxmem='512M', jvm_classpath=['target/test-classes'])
 import jpy
 
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
 
 class TestConstructorOverloads(unittest.TestCase):
     def setUp(self):
@@ -84,6 +89,155 @@ class TestMethodOverloads(unittest.TestCase):
             fixture.join('x', 'y', 'z', 'u', 'v')
         self.assertEqual(str(e.exception), 'no matching Java method overloads found')
 
+    def test_overriddenMethodsArePreferredInSubClass(self):
+        Fixture = jpy.get_type('org.jpy.fixtures.MethodOverloadTestFixture$MethodOverloadTestFixture3')
+        fixture = Fixture()
+
+        self.assertEqual(fixture.join('x'), 'String(x)')
+        self.assertEqual(fixture.join(12, 32), 'Integer(12),Integer(32)')
+        # Only the override in MethodOverloadTestFixture3 marks its result
+        self.assertEqual(fixture.join('x', 'y', 'z'), 'MethodOverloadTestFixture3.join:String(x),String(y),String(z)')
+        self.assertEqual(fixture.join('x', 'y', 'z', 'u'), 'String(x),String(y),String(z),String(u)')
+
+        Fixture2 = jpy.get_type('org.jpy.fixtures.MethodOverloadTestFixture$MethodOverloadTestFixture2')
+        self.assertEqual(Fixture2().join('x', 'y', 'z'), 'String(x),String(y),String(z)')
+
+    def test_sequencesPreferArraysOverCollections(self):
+        fixture = self.Fixture()
+        ArrayList = jpy.get_type('java.util.ArrayList')
+
+        self.assertEqual(fixture.collect([1, 2, 3]), 'int[](1,2,3)')
+        self.assertEqual(fixture.collect((1, 2, 3)), 'int[](1,2,3)')
+        values = ArrayList()
+        self.assertEqual(fixture.collect(values), 'List([])')
+        values.add(1)
+        values.add(2)
+        self.assertEqual(fixture.collect(values), 'List([1, 2])')
+
+    def test_selectMethod(self):
+        fixture = self.Fixture()
+
+        join = self.Fixture.join.select('int', 'double')
+        self.assertEqual(type(join).__name__, 'JMethod')
+        self.assertEqual(join(fixture, 12, 3.2), 'Integer(12),Double(3.2)')
+        # The int argument is not matched against the other overloads
+        self.assertEqual(self.Fixture.join.select('double', 'double')(fixture, 12, 32), 'Double(12.0),Double(32.0)')
+
+        String = jpy.get_type('java.lang.String')
+        join = self.Fixture.join.select(String, String, String)
+        self.assertEqual(join(fixture, 'x', 'y', 'z'), 'String(x),String(y),String(z)')
+
+        with self.assertRaises(ValueError):
+            self.Fixture.join.select('int', 'boolean')
+
+        with self.assertRaises(TypeError):
+            join(fixture, 'x', 'y')
+
+        with self.assertRaises(TypeError):
+            join(String('x'), 'x', 'y', 'z')
+
+    def test_getMethod(self):
+        Fixture = jpy.get_type('org.jpy.fixtures.MethodOverloadTestFixture$MethodOverloadTestFixture2')
+        fixture = Fixture()
+
+        join = jpy.get_method(Fixture, 'join', '(ILjava/lang/String;)Ljava/lang/String;')
+        self.assertEqual(join(fixture, 12, 'abc'), 'Integer(12),String(abc)')
+
+        join = jpy.get_method('org.jpy.fixtures.MethodOverloadTestFixture$MethodOverloadTestFixture2', 'join', '(Ljava/lang/String;Ljava/lang/String;Ljava/lang/String;)')
+        self.assertEqual(join(fixture, 'x', 'y', 'z'), 'String(x),String(y),String(z)')
+
+        join = jpy.get_method(fixture, 'join', '(DD)')
+        self.assertEqual(join(1.2, 3.2), 'Double(1.2),Double(3.2)')
+
+        with self.assertRaises(ValueError):
+            jpy.get_method(Fixture, 'join', '(Z)')
+
+        with self.assertRaises(ValueError):
+            jpy.get_method(Fixture, 'split', '()')
+
+    def test_methodDescriptor(self):
+        fixture = self.Fixture()
+
+        self.assertEqual(type(self.Fixture.join).__name__, 'JOverloadedMethod')
+        self.assertEqual(self.Fixture.join(fixture, 'x', 'y'), 'String(x),String(y)')
+
+        join = fixture.join
+        self.assertIs(join.__self__, fixture)
+        self.assertIs(join.__func__, self.Fixture.join)
+        self.assertEqual(join('x', 'y'), 'String(x),String(y)')
+        self.assertEqual(list(map(fixture.join, ['x', 'y'])), ['String(x)', 'String(y)'])
+
+    def test_map(self):
+        fixture = self.Fixture()
+
+        self.assertEqual(jpy.map(fixture.join, [(1, 2), (3, 4)]), ['Integer(1),Integer(2)', 'Integer(3),Integer(4)'])
+        self.assertEqual(jpy.map(fixture.join, ['x', 'y']), ['String(x)', 'String(y)'])
+        self.assertEqual(self.Fixture.join.map([(fixture, 'x', 'y'), (fixture, 'u', 'v')]),
+                         ['String(x),String(y)', 'String(u),String(v)'])
+        self.assertEqual(jpy.map(fixture.join, []), [])
+
+        join = self.Fixture.join.select('int', 'double')
+        self.assertEqual(jpy.map(join, [(fixture, 1, 2.5)]), ['Integer(1),Double(2.5)'])
+
+        # The overload is resolved once, using the first argument tuple
+        with self.assertRaises(TypeError):
+            jpy.map(fixture.join, [(1, 2), ('x', 'y')])
+
+        Math = jpy.get_type('java.lang.Math')
+        self.assertEqual(jpy.map(Math.max.select('int', 'int'), [(1, 2), (4, 3)], release_gil=True), [2, 4])
+
+    @unittest.skipIf(np is None, 'numpy is not installed')
+    def test_mapAsNumPy(self):
+        Math = jpy.get_type('java.lang.Math')
+        a = jpy.map(Math.max.select('double', 'double'), [(1, 2), (4, 3)], as_numpy=True, release_gil=True)
+        self.assertEqual(a.dtype, np.float64)
+        self.assertEqual(list(a), [2.0, 4.0])
+
+    def test_vectorize(self):
+        import array
+
+        Math = jpy.get_type('java.lang.Math')
+        hypot = jpy.vectorize(Math.hypot)
+
+        out = array.array('d', [0.0, 0.0])
+        self.assertIs(hypot(array.array('d', [3.0, 5.0]), array.array('i', [4, 12]), out=out), out)
+        self.assertEqual(list(out), [5.0, 13.0])
+
+        # Scalars and arrays of length 1 are broadcast
+        hypot(array.array('d', [3.0, 6.0]), 4, out=out)
+        self.assertEqual(list(out), [5.0, 7.211102550927978])
+        hypot(array.array('d', [8.0]), array.array('d', [6.0, 15.0]), out=out)
+        self.assertEqual(list(out), [10.0, 17.0])
+        self.assertEqual(hypot(3.0, 4.0), 5.0)
+
+        # Floating point items are converted into integral parameters like Java casts: NaN becomes 0, others saturate
+        imax = jpy.vectorize(Math.max.select('int', 'int'))
+        iout = array.array('i', [1, 1, 1, 1])
+        imax(array.array('d', [float('nan'), float('inf'), -1e10, -2.7]), -5, out=iout)
+        self.assertEqual(list(iout), [0, 2147483647, -5, -2])
+
+        with self.assertRaises(ValueError):
+            hypot(array.array('d', [1.0, 2.0, 3.0]), array.array('d', [1.0, 2.0]))
+        with self.assertRaises(ValueError):
+            hypot(array.array('d', [1.0, 2.0]), 1.0, out=array.array('f', [0.0, 0.0]))
+        with self.assertRaises(TypeError):
+            hypot(array.array('d', [1.0, 2.0]))
+
+        with self.assertRaises(ValueError):
+            jpy.vectorize(Math.max)
+        with self.assertRaises(ValueError):
+            jpy.vectorize(jpy.get_type('java.lang.String').valueOf.select('java.lang.Object'))
+        with self.assertRaises(ValueError):
+            jpy.vectorize(self.Fixture.join.select('int', 'double'))
+
+    @unittest.skipIf(np is None, 'numpy is not installed')
+    def test_vectorizeAsNumPy(self):
+        Math = jpy.get_type('java.lang.Math')
+        max = jpy.vectorize(Math.max.select('int', 'int'))
+        a = max(np.array([1, 5, 3], dtype=np.int64)[::-1], np.int32(2))
+        self.assertEqual(a.dtype, np.int32)
+        self.assertEqual(list(a), [3, 5, 2])
+
 
 class TestOtherMethodResolutionCases(unittest.TestCase):
 
@@ -2,11 +2,31 @@ import unittest
 
 import jpyutil
 
+try:
+    import numpy as np
+except ImportError:
+    np = None
+
 
 jpyutil.init_jvm(jvm_maxmem='512M', jvm_classpath=['target/test-classes'])
 import jpy
 
 
+def annotate_return_policy_fixture_methods(type, method):
+    if method.name == 'getBytes':
+        method.set_return_policy('bytes')
+    elif method.name == 'getMatrix':
+        method.set_return_policy('numpy')
+    elif method.name in ('getInts', 'getStrings', 'getThings', 'getList'):
+        method.set_return_policy('list')
+    elif method.name == 'getMap':
+        method.set_return_policy('dict')
+    return True
+
+
+jpy.type_callbacks['org.jpy.fixtures.ReturnPolicyTestFixture'] = annotate_return_policy_fixture_methods
+
+
 class TestMethodReturnValues(unittest.TestCase):
     def setUp(self):
         self.Fixture = jpy.get_type('org.jpy.fixtures.MethodReturnValueTestFixture')
@@ -119,6 +139,60 @@ class TestMethodReturnValues(unittest.TestCase):
         self.assertEqual(array[2], self.Thing(9))
 
 
+
+class TestMethodReturnPolicies(unittest.TestCase):
+    def setUp(self):
+        self.Fixture = jpy.get_type('org.jpy.fixtures.ReturnPolicyTestFixture')
+        self.assertIsNotNone(self.Fixture)
+        self.Thing = jpy.get_type('org.jpy.fixtures.Thing')
+        self.assertIsNotNone(self.Thing)
+
+
+    def test_bytes(self):
+        fixture = self.Fixture()
+        self.assertEqual(fixture.getBytes('Hi!'), b'Hi!')
+        self.assertEqual(fixture.getBytes(''), b'')
+        self.assertEqual(fixture.getBytes(None), None)
+
+
+    def test_list(self):
+        fixture = self.Fixture()
+        self.assertEqual(fixture.getInts(1, -2, 3), [1, -2, 3])
+        self.assertEqual(fixture.getStrings('A', None), ['A', None])
+        self.assertEqual(fixture.getThings(self.Thing(7), self.Thing(8)), [self.Thing(7), self.Thing(8)])
+        self.assertEqual(fixture.getList('A', 2), ['A', 2])
+
+
+    def test_dict(self):
+        fixture = self.Fixture()
+        self.assertEqual(fixture.getMap('answer', 42), {'answer': 42, 'none': None})
+
+
+    @unittest.skipIf(np is None, 'numpy not installed')
+    def test_numpy(self):
+        fixture = self.Fixture()
+        a = fixture.getMatrix(1.5, 2.5, 3.5, 4.5)
+        self.assertIsInstance(a, np.ndarray)
+        self.assertEqual(a.tolist(), [[1.5, 2.5], [3.5, 4.5]])
+
+
+    def test_get_and_set_return_policy(self):
+        self.assertEqual(self.Fixture.getBytes.select('java.lang.String').get_return_policy(), 'bytes')
+        method = self.Fixture.getThing.select('int')
+        self.assertEqual(method.get_return_policy(), 'wrapper')
+        self.assertEqual(method(self.Fixture(), 3), self.Thing(3))
+
+        with self.assertRaises(ValueError) as e:
+            method.set_return_policy('list')
+        self.assertIn("return policy 'list' is not applicable", str(e.exception))
+        with self.assertRaises(ValueError) as e:
+            self.Fixture.getInts.select('int', 'int', 'int').set_return_policy('bytes')
+        with self.assertRaises(ValueError) as e:
+            method.set_return_policy('tuple')
+        self.assertIn("unknown return policy 'tuple'", str(e.exception))
+        self.assertEqual(method.get_return_policy(), 'wrapper')
+
+
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
     unittest.main()
@@ -174,6 +174,29 @@ class TestArrayList(unittest.TestCase):
         self.assertEqual(array[3], f)
         self.assertEqual(type(array[3]), type(f))
 
+    def test_sequence_protocol(self):
+        array_list = self.ArrayList()
+        for item in ['A', 12, 3.4]:
+            array_list.add(item)
+
+        self.assertEqual(len(array_list), 3)
+        self.assertEqual(array_list[0], 'A')
+        self.assertEqual(array_list[-1], 3.4)
+        with self.assertRaises(IndexError):
+            array_list[3]
+        self.assertEqual(list(array_list), ['A', 12, 3.4])
+        self.assertTrue(12 in array_list)
+        self.assertFalse('B' in array_list)
+
+        array_list[1] = 'B'
+        del array_list[0]
+        self.assertEqual(list(array_list), ['B', 3.4])
+        self.assertEqual(array_list.size(), 2)
+
+        if sys.version_info >= (3, 3):
+            import collections.abc
+            self.assertTrue(isinstance(array_list, collections.abc.Sequence))
+
 
 class TestHashMap(unittest.TestCase):
     def setUp(self):
@@ -211,6 +234,66 @@ class TestHashMap(unittest.TestCase):
         self.assertEqual(type(hash_map.get(3)), type(f))
         self.assertEqual(hash_map.get(4), fa)
 
+    def test_mapping_protocol(self):
+        hash_map = self.HashMap()
+        hash_map['A'] = 1
+        hash_map['B'] = None
+
+        self.assertEqual(len(hash_map), 2)
+        self.assertEqual(hash_map['A'], 1)
+        self.assertEqual(hash_map['B'], None)
+        with self.assertRaises(KeyError):
+            hash_map['C']
+        self.assertTrue('A' in hash_map)
+        self.assertFalse('C' in hash_map)
+        self.assertEqual(sorted(hash_map), ['A', 'B'])
+
+        del hash_map['B']
+        self.assertEqual(hash_map.size(), 1)
+        with self.assertRaises(KeyError):
+            del hash_map['B']
+
+        if sys.version_info >= (3, 3):
+            import collections.abc
+            self.assertTrue(isinstance(hash_map, collections.abc.Mapping))
+
+
+class TestIdentityCache(unittest.TestCase):
+    def setUp(self):
+        self.ArrayList = jpy.get_type('java.util.ArrayList')
+        self.File = jpy.get_type('java.io.File')
+
+
+    def test_identity_cache(self):
+        self.assertEqual(jpy.set_identity_cache(self.File, True), False)
+        try:
+            f = self.File('/usr/local/bibo')
+            array_list = self.ArrayList()
+            array_list.add(f)
+            array_list.add(f)
+            self.assertIs(array_list.get(0), f)
+            self.assertIs(array_list.get(1), f)
+
+            g = array_list.get(0)
+            del f, g
+            f = array_list.get(0)
+            self.assertIs(array_list.get(1), f)
+            self.assertIsNot(self.File('/usr/local/bibo'), f)
+        finally:
+            self.assertEqual(jpy.set_identity_cache('java.io.File', False), True)
+
+        self.assertIsNot(array_list.get(0), array_list.get(1))
+        self.assertEqual(array_list.get(0), array_list.get(1))
+
+
+    def test_weakref(self):
+        import weakref
+        f = self.File('/usr/local/bibo')
+        ref = weakref.ref(f)
+        self.assertIs(ref(), f)
+        del f
+        self.assertIsNone(ref())
+
 
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
@@ -1,10 +1,11 @@
 import unittest
 import array
+import collections
 
 import jpyutil
 
 
-jpyutil.init_jvm(jvm_maxmem='512M', jvm_classpath=['target/test-classes'])
+jpyutil.init_jvm(jvm_maxmem='512M', jvm_classpath=['target/test-classes', 'target/classes'])
 import jpy
 
 
@@ -55,6 +56,121 @@ class TestTypeConversions(unittest.TestCase):
         self.assertEqual(fixture.stringifyStringArrayArg(['A', 'B', 'C']), 'String[](String(A),String(B),String(C))')
 
 
+    def test_BoxingUsesValueOfCaches(self):
+        # Small integers and booleans are boxed by valueOf(), so the same Java instance is passed twice
+        IdentityHashMap = jpy.get_type('java.util.IdentityHashMap')
+        m = IdentityHashMap()
+        m.put(100, 'a')
+        m.put(True, 'b')
+        self.assertTrue(m.containsKey(100))
+        self.assertTrue(m.containsKey(True))
+        self.assertEqual(m.get(100), 'a')
+
+    def test_Unboxing(self):
+        ArrayList = jpy.get_type('java.util.ArrayList')
+        Short = jpy.get_type('java.lang.Short')
+        Float = jpy.get_type('java.lang.Float')
+        Character = jpy.get_type('java.lang.Character')
+        values = ArrayList()
+        values.add(Short.valueOf(-7))
+        values.add(Float.valueOf(0.5))
+        values.add(Character.valueOf(65))
+        values.add(123456789012)
+        values.add(False)
+        self.assertEqual([values.get(i) for i in range(values.size())], [-7, 0.5, 65, 123456789012, False])
+
+    def test_CallablesAsFunctionalInterfaces(self):
+        ArrayList = jpy.get_type('java.util.ArrayList')
+        Collections = jpy.get_type('java.util.Collections')
+        Optional = jpy.get_type('java.util.Optional')
+        Thread = jpy.get_type('java.lang.Thread')
+
+        values = ArrayList()
+        for s in ['ccc', 'a', 'bb']:
+            values.add(s)
+        Collections.sort(values, lambda a, b: len(a) - len(b))
+        self.assertEqual([values.get(i) for i in range(values.size())], ['a', 'bb', 'ccc'])
+
+        self.assertEqual(Optional.of('abc').map(lambda s: s.upper()).get(), 'ABC')
+        self.assertTrue(Optional.of('abc').filter(lambda s: s.startswith('a')).isPresent())
+        self.assertFalse(Optional.of('abc').filter(lambda s: s.startswith('b')).isPresent())
+
+        calls = []
+        Thread(lambda: calls.append('run')).run()
+        self.assertEqual(calls, ['run'])
+
+        with self.assertRaises(RuntimeError):
+            Collections.sort(values, lambda a, b: 1 / 0)
+
+        # IntOp redeclares Function.apply() with narrower types, both are calls of the callable
+        fixture = self.Fixture()
+        self.assertEqual(fixture.applyIntOp(lambda x: 2 * x, 5), 'Integer(10),Integer(12)')
+
+    def test_ListsAndDictsAsJavaViews(self):
+        Collections = jpy.get_type('java.util.Collections')
+        HashMap = jpy.get_type('java.util.HashMap')
+
+        # The Java methods operate on the Python objects, nothing is copied
+        values = [3, 1, 2]
+        self.assertEqual(Collections.max(values), 3)
+        Collections.sort(values)
+        self.assertEqual(values, [1, 2, 3])
+        Collections.reverse(values)
+        self.assertEqual(values, [3, 2, 1])
+
+        self.assertEqual(Collections.frequency(('a', 'b', 'a'), 'a'), 2)
+
+        d = {'a': 1, 'b': 'x'}
+        hash_map = HashMap(d)
+        self.assertEqual(hash_map.size(), 2)
+        self.assertEqual(hash_map.get('a'), 1)
+        self.assertEqual(hash_map.get('b'), 'x')
+        self.assertEqual(Collections.unmodifiableMap(d).containsKey('b'), True)
+
+    def test_ToJavaListAndMap(self):
+        array_list = jpy.to_java_list([1, 2, None, 3])
+        self.assertEqual(jpy.get_type('java.util.ArrayList'), type(array_list))
+        self.assertEqual(list(array_list), [1, 2, None, 3])
+
+        # Items are converted into the given type, primitive types are boxed
+        Long = jpy.get_type('java.lang.Long')
+        array_list = jpy.to_java_list((x for x in range(3)), 'long')
+        self.assertTrue(array_list.contains(Long(2)))
+        self.assertFalse(jpy.to_java_list([2]).contains(Long(2)))
+        array_list = jpy.to_java_list(['a', 'b'], jpy.get_type('java.lang.String'))
+        self.assertEqual(array_list.toString(), '[a, b]')
+        strings = [u'caf\u00e9', u'\U0001F600', None, 'x' * 1000]
+        self.assertEqual(list(jpy.to_java_list(strings, 'java.lang.String')), strings)
+
+        with self.assertRaises(ValueError):
+            jpy.to_java_list([1, 'a'], 'int')
+        with self.assertRaises(ValueError):
+            jpy.to_java_list([1], 'void')
+        # Java objects must be instances of the item type, or of its boxed type
+        String = jpy.get_type('java.lang.String')
+        Integer = jpy.get_type('java.lang.Integer')
+        self.assertEqual(list(jpy.to_java_list([Integer(3)], 'int')), [3])
+        with self.assertRaises(ValueError):
+            jpy.to_java_list([String('a')], 'int')
+        with self.assertRaises(ValueError):
+            jpy.to_java_map({'a': Long(1)}, 'java.lang.String', 'java.lang.String')
+
+        hash_map = jpy.to_java_map({'a': 1, 'b': 2.5}, 'java.lang.String', 'double')
+        self.assertEqual(jpy.get_type('java.util.HashMap'), type(hash_map))
+        self.assertEqual(hash_map.size(), 2)
+        self.assertIsInstance(hash_map.get('a'), float)
+        self.assertEqual(hash_map.get('a'), 1.0)
+        self.assertEqual(hash_map.get('b'), 2.5)
+
+        hash_map = jpy.to_java_map(collections.OrderedDict([(1, 'x'), (2, None)]))
+        self.assertEqual(hash_map.size(), 2)
+        self.assertEqual(hash_map.get(1), 'x')
+        self.assertTrue(hash_map.containsKey(2))
+
+        with self.assertRaises(ValueError):
+            jpy.to_java_map([1, 2])
+
+
 if __name__ == '__main__':
     print('\nRunning ' + __file__)
     unittest.main()